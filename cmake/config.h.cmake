@@ -44,6 +44,7 @@
 #cmakedefine WITHOUT_PMRRR
 #cmakedefine AVOID_COMPLEX_MPI
 #cmakedefine HAVE_FLA_BSVD
+#cmakedefine HAVE_MMAP
 #cmakedefine HAVE_REDUCE_SCATTER_BLOCK
 #cmakedefine HAVE_MPI_IN_PLACE
 #cmakedefine HAVE_MPI3_NONBLOCKING_COLLECTIVES
@@ -31,6 +31,17 @@ inline void LocalGer
            const DistMatrix<T,yColDist,yRowDist>& y,
                  DistMatrix<T,AColDist,ARowDist>& A );
 
+template<typename T>
+void FusedLocalSymv
+( UpperOrLower uplo, bool conjugate, T alpha, const DistMatrix<T>& A,
+  const T* xMC, const T* xMR, T* zMC, T* zMR, int blocksize );
+
+template<typename T>
+void FusedLocalSymv
+( UpperOrLower uplo, bool conjugate, T alpha, const DistMatrix<T>& A,
+  const Matrix<T>& xMC, const Matrix<T>& xMR,
+        Matrix<T>& zMC,       Matrix<T>& zMR, int blocksize );
+
 
 //----------------------------------------------------------------------------//
 // Local BLAS-like: Level 3                                                   //
@@ -206,6 +217,17 @@ void LocalSymvRowAccumulateU
 // Distributed BLAS-like helpers: Level 3                                     //
 //----------------------------------------------------------------------------//
 
+// Gemm within each layer of the process grid (using only the 2D variants)
+template<typename T>
+void Gemm2D
+( Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const DistMatrix<T>& A, const DistMatrix<T>& B,
+  T beta,        DistMatrix<T>& C );
+
+// Whether or not Gemm should split an inner dimension of size k between the
+// layers of g (which is only possible if it is a Grid3D)
+inline bool UseGemm25D( const Grid& g, int k );
+
 template<typename T>
 void LocalSymmetricAccumulateLL
 ( Orientation orientation, T alpha, 
@@ -700,6 +722,294 @@ inline void LocalGer
 #endif
 }
 
+// z := z + tau a and return a^T x (or a^H x). The dot product is split into
+// four partial sums so that the loop is not bound by the latency of the
+// floating-point additions, and so that, along with the non-aliasing
+// guarantee, the compiler can vectorize it.
+template<typename T>
+inline T
+FusedAxpyDot
+( bool conjugate, int n, T tau,
+  const T* RESTRICT a, const T* RESTRICT x, T* RESTRICT z )
+{
+    T sum0=0, sum1=0, sum2=0, sum3=0;
+    int i=0;
+    if( conjugate )
+    {
+        for( ; i+4<=n; i+=4 )
+        {
+            z[i  ] += tau*a[i  ]; sum0 += Conj(a[i  ])*x[i  ];
+            z[i+1] += tau*a[i+1]; sum1 += Conj(a[i+1])*x[i+1];
+            z[i+2] += tau*a[i+2]; sum2 += Conj(a[i+2])*x[i+2];
+            z[i+3] += tau*a[i+3]; sum3 += Conj(a[i+3])*x[i+3];
+        }
+        for( ; i<n; ++i )
+        {
+            z[i] += tau*a[i];
+            sum0 += Conj(a[i])*x[i];
+        }
+    }
+    else
+    {
+        for( ; i+4<=n; i+=4 )
+        {
+            z[i  ] += tau*a[i  ]; sum0 += a[i  ]*x[i  ];
+            z[i+1] += tau*a[i+1]; sum1 += a[i+1]*x[i+1];
+            z[i+2] += tau*a[i+2]; sum2 += a[i+2]*x[i+2];
+            z[i+3] += tau*a[i+3]; sum3 += a[i+3]*x[i+3];
+        }
+        for( ; i<n; ++i )
+        {
+            z[i] += tau*a[i];
+            sum0 += a[i]*x[i];
+        }
+    }
+    return (sum0+sum1) + (sum2+sum3);
+}
+
+// The same operation for four columns at once, so that each entry of x and z
+// is loaded (and each entry of z stored) once per four columns.
+template<typename T>
+inline void
+FusedAxpyDot4
+( bool conjugate, int n, const T* tau,
+  const T* RESTRICT a0, const T* RESTRICT a1,
+  const T* RESTRICT a2, const T* RESTRICT a3,
+  const T* RESTRICT x, T* RESTRICT z, T* sums )
+{
+    const T tau0=tau[0], tau1=tau[1], tau2=tau[2], tau3=tau[3];
+    T sum0=0, sum1=0, sum2=0, sum3=0;
+    if( conjugate )
+    {
+        for( int i=0; i<n; ++i )
+        {
+            const T chi = x[i];
+            z[i] += tau0*a0[i] + tau1*a1[i] + tau2*a2[i] + tau3*a3[i];
+            sum0 += Conj(a0[i])*chi;
+            sum1 += Conj(a1[i])*chi;
+            sum2 += Conj(a2[i])*chi;
+            sum3 += Conj(a3[i])*chi;
+        }
+    }
+    else
+    {
+        for( int i=0; i<n; ++i )
+        {
+            const T chi = x[i];
+            z[i] += tau0*a0[i] + tau1*a1[i] + tau2*a2[i] + tau3*a3[i];
+            sum0 += a0[i]*chi;
+            sum1 += a1[i]*chi;
+            sum2 += a2[i]*chi;
+            sum3 += a3[i]*chi;
+        }
+    }
+    sums[0] += sum0;
+    sums[1] += sum1;
+    sums[2] += sum2;
+    sums[3] += sum3;
+}
+
+// Fused local kernel for the distributed Symv/Hemv, which forms both
+//
+//   z[MC,* ] += alpha tril(A) x[MR,* ]       and
+//   z[MR,* ] += alpha trils(A)^{T/H} x[MC,* ]
+//
+// (or the analogous update with the upper triangle) while only reading each
+// local entry of the stored triangle of A a single time, rather than once
+// per product. The local columns are traversed four at a time, and the local
+// rows in panels of 'blocksize' rows so that the corresponding pieces of 
+// x[MC,* ] and z[MC,* ] remain in cache. The groups of columns of each panel 
+// are divided among the OpenMP threads, each of which accumulates into a 
+// private copy of z[MC,* ].
+//
+// All four vectors must be stored contiguously.
+template<typename T>
+inline void
+FusedLocalSymv
+( UpperOrLower uplo, bool conjugate, T alpha, const DistMatrix<T>& A,
+  const T* xMC, const T* xMR, T* zMC, T* zMR, int blocksize )
+{
+#ifndef RELEASE
+    PushCallStack("internal::FusedLocalSymv");
+    if( blocksize < 1 )
+        throw std::logic_error("Blocksize must be positive");
+#endif
+    const int localHeight = A.LocalHeight();
+    const int localWidth = A.LocalWidth();
+    const int colShift = A.ColShift();
+    const int rowShift = A.RowShift();
+    const int colStride = A.ColStride();
+    const int rowStride = A.RowStride();
+    const T* ABuffer = A.LockedLocalBuffer();
+    const int ALDim = A.LocalLDim();
+    if( localHeight == 0 || localWidth == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+#ifdef HAVE_OPENMP
+    const int numThreads = omp_get_max_threads();
+#else
+    const int numThreads = 1;
+#endif
+    std::vector<T> zMCThreads( (numThreads-1)*localHeight, 0 );
+    const int numGroups = (localWidth+3)/4;
+
+#ifdef HAVE_OPENMP
+    #pragma omp parallel
+#endif
+    {
+#ifdef HAVE_OPENMP
+        const int thread = omp_get_thread_num();
+#else
+        const int thread = 0;
+#endif
+        T* zMCThread =
+            ( thread==0 ? zMC : &zMCThreads[(thread-1)*localHeight] );
+        for( int iStart=0; iStart<localHeight; iStart+=blocksize )
+        {
+            const int iEnd = std::min(iStart+blocksize,localHeight);
+#ifdef HAVE_OPENMP
+            #pragma omp for
+#endif
+            for( int group=0; group<numGroups; ++group )
+            {
+                const int jLocalStart = 4*group;
+                const int width = std::min(4,localWidth-jLocalStart);
+
+                // Handle the diagonal entries, which only contribute to 
+                // z[MC,* ], and find the range of the local rows of each 
+                // column within the strict triangle (and the panel)
+                const T* a[4];
+                T tau[4], sums[4];
+                int first[4], last[4];
+                int commonFirst=iStart, commonLast=iEnd;
+                for( int k=0; k<width; ++k )
+                {
+                    const int jLocal = jLocalStart + k;
+                    const int j = rowShift + jLocal*rowStride;
+                    const int diag = LocalLength( j, colShift, colStride );
+                    const int diagEnd = LocalLength( j+1, colShift, colStride );
+                    a[k] = &ABuffer[jLocal*ALDim];
+                    tau[k] = alpha*xMR[jLocal];
+                    sums[k] = 0;
+                    if( diag != diagEnd && diag >= iStart && diag < iEnd )
+                        zMCThread[diag] += tau[k]*a[k][diag];
+                    if( uplo == LOWER )
+                    {
+                        first[k] = std::max( diagEnd, iStart );
+                        last[k] = iEnd;
+                    }
+                    else
+                    {
+                        first[k] = iStart;
+                        last[k] = std::min( diag, iEnd );
+                    }
+                    commonFirst = std::max( commonFirst, first[k] );
+                    commonLast = std::min( commonLast, last[k] );
+                }
+
+                // Process the rows shared by all four columns at once, and 
+                // the remaining rows of each column individually
+                const bool fused = ( width == 4 && commonFirst < commonLast );
+                if( fused )
+                    FusedAxpyDot4
+                    ( conjugate, commonLast-commonFirst, tau,
+                      &a[0][commonFirst], &a[1][commonFirst],
+                      &a[2][commonFirst], &a[3][commonFirst],
+                      &xMC[commonFirst], &zMCThread[commonFirst], sums );
+                for( int k=0; k<width; ++k )
+                {
+                    const int headEnd = ( fused ? commonFirst : last[k] );
+                    const int tailStart = ( fused ? commonLast : last[k] );
+                    if( first[k] < headEnd )
+                        sums[k] += FusedAxpyDot
+                        ( conjugate, headEnd-first[k], tau[k],
+                          &a[k][first[k]], &xMC[first[k]],
+                          &zMCThread[first[k]] );
+                    if( tailStart < last[k] )
+                        sums[k] += FusedAxpyDot
+                        ( conjugate, last[k]-tailStart, tau[k],
+                          &a[k][tailStart], &xMC[tailStart],
+                          &zMCThread[tailStart] );
+                    zMR[jLocalStart+k] += alpha*sums[k];
+                }
+            }
+        }
+    }
+
+    // Reduce the threads' contributions to z[MC,* ]
+    for( int thread=1; thread<numThreads; ++thread )
+    {
+        const T* zMCThread = &zMCThreads[(thread-1)*localHeight];
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+            zMC[iLocal] += zMCThread[iLocal];
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// Version for row vectors, which need not be stored contiguously
+template<typename T>
+inline void
+FusedLocalSymv
+( UpperOrLower uplo, bool conjugate, T alpha, const DistMatrix<T>& A,
+  const Matrix<T>& xMC, const Matrix<T>& xMR,
+        Matrix<T>& zMC,       Matrix<T>& zMR, int blocksize )
+{
+#ifndef RELEASE
+    PushCallStack("internal::FusedLocalSymv");
+#endif
+    const int localHeight = A.LocalHeight();
+    const int localWidth = A.LocalWidth();
+    if( localHeight == 0 || localWidth == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+    const int xMCLDim = xMC.LDim();
+    const int xMRLDim = xMR.LDim();
+    const int zMCLDim = zMC.LDim();
+    const int zMRLDim = zMR.LDim();
+    std::vector<T> buffer( 2*localHeight+2*localWidth );
+    T* xMCBuffer = &buffer[0];
+    T* zMCBuffer = &buffer[localHeight];
+    T* xMRBuffer = &buffer[2*localHeight];
+    T* zMRBuffer = &buffer[2*localHeight+localWidth];
+    const T* xMCRow = xMC.LockedBuffer();
+    const T* xMRRow = xMR.LockedBuffer();
+    T* zMCRow = zMC.Buffer();
+    T* zMRRow = zMR.Buffer();
+    for( int iLocal=0; iLocal<localHeight; ++iLocal )
+    {
+        xMCBuffer[iLocal] = xMCRow[iLocal*xMCLDim];
+        zMCBuffer[iLocal] = zMCRow[iLocal*zMCLDim];
+    }
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        xMRBuffer[jLocal] = xMRRow[jLocal*xMRLDim];
+        zMRBuffer[jLocal] = zMRRow[jLocal*zMRLDim];
+    }
+
+    FusedLocalSymv
+    ( uplo, conjugate, alpha, A,
+      xMCBuffer, xMRBuffer, zMCBuffer, zMRBuffer, blocksize );
+
+    for( int iLocal=0; iLocal<localHeight; ++iLocal )
+        zMCRow[iLocal*zMCLDim] = zMCBuffer[iLocal];
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+        zMRRow[jLocal*zMRLDim] = zMRBuffer[jLocal];
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 //
 // Level 3 Local BLAS-like routines
 //
@@ -56,84 +56,11 @@ LocalHemvColAccumulateU
         z_MR_STAR.ColAlignment() != A.RowAlignment() )
         throw std::logic_error("Partial matrix distributions are misaligned");
 #endif
-    const Grid& g = A.Grid();
-
-    // Matrix views
-    DistMatrix<T> A11(g), A12(g);
-    DistMatrix<T> D11(g);
-
-    DistMatrix<T,MC,STAR> x1_MC_STAR(g);
-    DistMatrix<T,MR,STAR> 
-        xT_MR_STAR(g),  x0_MR_STAR(g),
-        xB_MR_STAR(g),  x1_MR_STAR(g),
-                        x2_MR_STAR(g);
-    DistMatrix<T,MC,STAR> z1_MC_STAR(g);
-    DistMatrix<T,MR,STAR> z1_MR_STAR(g),
-                          z2_MR_STAR(g);
-
-    // We want our local gemvs to be of width blocksize, so we will 
-    // temporarily change to max(r,c) times the current blocksize
-    const int ratio = std::max( g.Height(), g.Width() );
-    PushBlocksizeStack( ratio*LocalHemvBlocksize<T>() );
-                 
-    LockedPartitionDown
-    ( x_MR_STAR, xT_MR_STAR,
-                 xB_MR_STAR, 0 );
-    while( xT_MR_STAR.Height() < x_MR_STAR.Height() )
-    {
-        LockedRepartitionDown
-        ( xT_MR_STAR,  x0_MR_STAR,
-         /**********/ /**********/
-                       x1_MR_STAR,
-          xB_MR_STAR,  x2_MR_STAR );
-
-        const int n0 = x0_MR_STAR.Height();
-        const int n1 = x1_MR_STAR.Height();
-        const int n2 = x2_MR_STAR.Height();
-        LockedView( A11, A, n0, n0,    n1, n1 );
-        LockedView( A12, A, n0, n0+n1, n1, n2 );
-        LockedView( x1_MC_STAR, x_MC_STAR, n0, 0, n1, 1 );
-        View( z1_MC_STAR, z_MC_STAR, n0,    0, n1, 1 );
-        View( z1_MR_STAR, z_MR_STAR, n0,    0, n1, 1 );
-        View( z2_MR_STAR, z_MR_STAR, n0+n1, 0, n2, 1 );
-
-        D11.AlignWith( A11 );
-        //--------------------------------------------------------------------//
-        // TODO: The diagonal block updates can be greatly improved
-        D11 = A11;
-        MakeTrapezoidal( LEFT, UPPER, 0, D11 );
-        Gemv
-        ( NORMAL, 
-          alpha, D11.LockedLocalMatrix(), 
-                 x1_MR_STAR.LockedLocalMatrix(),
-          T(1),  z1_MC_STAR.LocalMatrix() );
-        MakeTrapezoidal( LEFT, UPPER, 1, D11 );
-        Gemv
-        ( ADJOINT,
-          alpha, D11.LockedLocalMatrix(),
-                 x1_MC_STAR.LockedLocalMatrix(),
-          T(1),  z1_MR_STAR.LocalMatrix() );
-
-        Gemv
-        ( NORMAL,
-          alpha, A12.LockedLocalMatrix(),
-                 x2_MR_STAR.LockedLocalMatrix(),
-          T(1),  z1_MC_STAR.LocalMatrix() );
-        Gemv
-        ( ADJOINT,
-          alpha, A12.LockedLocalMatrix(),
-                 x1_MC_STAR.LockedLocalMatrix(),
-          T(1),  z2_MR_STAR.LocalMatrix() );
-        //--------------------------------------------------------------------//
-        D11.FreeAlignments();
-
-        SlideLockedPartitionDown
-        ( xT_MR_STAR,  x0_MR_STAR,
-                       x1_MR_STAR,
-         /**********/ /**********/
-          xB_MR_STAR,  x2_MR_STAR );
-    }
-    PopBlocksizeStack();
+    FusedLocalSymv
+    ( UPPER, true, alpha, A,
+      x_MC_STAR.LockedLocalBuffer(), x_MR_STAR.LockedLocalBuffer(),
+      z_MC_STAR.LocalBuffer(), z_MR_STAR.LocalBuffer(),
+      LocalHemvBlocksize<T>() );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -185,76 +112,11 @@ LocalHemvRowAccumulateU
         z_STAR_MR.RowAlignment() != A.RowAlignment() )
         throw std::logic_error("Partial matrix distributions are misaligned");
 #endif
-    const Grid& g = A.Grid();
-
-    // Matrix views
-    DistMatrix<T> A11(g), A12(g);
-    DistMatrix<T> D11(g);
-
-    DistMatrix<T,STAR,MC> x1_STAR_MC(g);
-    DistMatrix<T,STAR,MR> 
-        xL_STAR_MR(g), xR_STAR_MR(g),
-        x0_STAR_MR(g), x1_STAR_MR(g), x2_STAR_MR(g);
-    DistMatrix<T,STAR,MC> z1_STAR_MC(g);
-    DistMatrix<T,STAR,MR> z1_STAR_MR(g), z2_STAR_MR(g);
-
-    // We want our local gemvs to be of width blocksize, so we will 
-    // temporarily change to max(r,c) times the current blocksize
-    const int ratio = std::max( g.Height(), g.Width() );
-    PushBlocksizeStack( ratio*LocalHemvBlocksize<T>() );
-                 
-    LockedPartitionRight( x_STAR_MR,  xL_STAR_MR, xR_STAR_MR, 0 );
-    while( xL_STAR_MR.Width() < x_STAR_MR.Width() )
-    {
-        LockedRepartitionRight
-        ( xL_STAR_MR, /**/ xR_STAR_MR, 
-          x0_STAR_MR, /**/ x1_STAR_MR, x2_STAR_MR );
-
-        const int n0 = x0_STAR_MR.Width();
-        const int n1 = x1_STAR_MR.Width();
-        const int n2 = x2_STAR_MR.Width();
-        LockedView( A11, A, n0, n0,    n1, n1 );
-        LockedView( A12, A, n0, n0+n1, n1, n2 );
-        LockedView( x1_STAR_MC, x_STAR_MC, 0, n0, 1, n1 );
-        View( z1_STAR_MC, z_STAR_MC, 0, n0,    1, n1 );
-        View( z1_STAR_MR, z_STAR_MR, 0, n0,    1, n1 );
-        View( z2_STAR_MR, z_STAR_MR, 0, n0+n1, 1, n2 );
-
-        D11.AlignWith( A11 );
-        //--------------------------------------------------------------------//
-        // TODO: These diagonal block updates can be greatly improved
-        D11 = A11;
-        MakeTrapezoidal( LEFT, UPPER, 0, D11 );
-        Gemv
-        ( NORMAL, 
-          alpha, D11.LockedLocalMatrix(), 
-                 x1_STAR_MR.LockedLocalMatrix(),
-          T(1),  z1_STAR_MC.LocalMatrix() );
-        MakeTrapezoidal( LEFT, UPPER, 1, D11 );
-        Gemv
-        ( ADJOINT,
-          alpha, D11.LockedLocalMatrix(),
-                 x1_STAR_MC.LockedLocalMatrix(),
-          T(1),  z1_STAR_MR.LocalMatrix() );
-
-        Gemv
-        ( NORMAL,
-          alpha, A12.LockedLocalMatrix(),
-                 x2_STAR_MR.LockedLocalMatrix(),
-          T(1),  z1_STAR_MC.LocalMatrix() );
-        Gemv
-        ( ADJOINT,
-          alpha, A12.LockedLocalMatrix(),
-                 x1_STAR_MC.LockedLocalMatrix(),
-          T(1),  z2_STAR_MR.LocalMatrix() );
-        //--------------------------------------------------------------------//
-        D11.FreeAlignments();
-
-        SlideLockedPartitionRight
-        ( xL_STAR_MR,             /**/ xR_STAR_MR,
-          x0_STAR_MR, x1_STAR_MR, /**/ x2_STAR_MR );
-    }
-    PopBlocksizeStack();
+    FusedLocalSymv
+    ( UPPER, true, alpha, A,
+      x_STAR_MC.LockedLocalMatrix(), x_STAR_MR.LockedLocalMatrix(),
+      z_STAR_MC.LocalMatrix(), z_STAR_MR.LocalMatrix(),
+      LocalHemvBlocksize<T>() );
 #ifndef RELEASE
     PopCallStack();
 #endif
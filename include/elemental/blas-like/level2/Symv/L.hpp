@@ -56,84 +56,11 @@ LocalSymvColAccumulateL
         z_MR_STAR.ColAlignment() != A.RowAlignment() )
         throw std::logic_error("Partial matrix distributions are misaligned");
 #endif
-    const Grid& g = A.Grid();
-
-    // Matrix views
-    DistMatrix<T> A11(g),
-                  A21(g);
-    DistMatrix<T> D11(g);
-
-    DistMatrix<T,MC,STAR> 
-        xT_MC_STAR(g),  x0_MC_STAR(g),
-        xB_MC_STAR(g),  x1_MC_STAR(g),
-                        x2_MC_STAR(g);
-    DistMatrix<T,MR,STAR>  x1_MR_STAR(g);
-    DistMatrix<T,MC,STAR> z1_MC_STAR(g),
-                          z2_MC_STAR(g);
-    DistMatrix<T,MR,STAR> z1_MR_STAR(g);
-
-    // We want our local gemvs to be of width blocksize, so we will 
-    // temporarily change to max(r,c) times the current blocksize
-    const int ratio = std::max( g.Height(), g.Width() );
-    PushBlocksizeStack( ratio*LocalSymvBlocksize<T>() );
-    LockedPartitionDown
-    ( x_MC_STAR, xT_MC_STAR,
-                 xB_MC_STAR, 0 );
-    while( xT_MC_STAR.Height() < x_MC_STAR.Height() )
-    {
-        LockedRepartitionDown
-        ( xT_MC_STAR,  x0_MC_STAR,
-         /**********/ /**********/
-                       x1_MC_STAR,
-          xB_MC_STAR,  x2_MC_STAR );
-
-        const int n0 = x0_MC_STAR.Height();
-        const int n1 = x1_MC_STAR.Height();
-        const int n2 = x2_MC_STAR.Height();
-        LockedView( A11, A, n0,    n0, n1, n1 );
-        LockedView( A21, A, n0+n1, n0, n2, n1 );
-        LockedView( x1_MR_STAR, x_MR_STAR, n0, 0, n1, 1 );
-        View( z1_MC_STAR, z_MC_STAR, n0,    0, n1, 1 );
-        View( z2_MC_STAR, z_MC_STAR, n0+n1, 0, n2, 1 );
-        View( z1_MR_STAR, z_MR_STAR, n0,    0, n1, 1 );
- 
-        D11.AlignWith( A11 );
-        //--------------------------------------------------------------------//
-        // TODO: These diagonal block updates can be greatly improved
-        D11 = A11;
-        MakeTrapezoidal( LEFT, LOWER, 0, D11 );
-        Gemv
-        ( NORMAL, 
-          alpha, D11.LockedLocalMatrix(), 
-                 x1_MR_STAR.LockedLocalMatrix(),
-          T(1),  z1_MC_STAR.LocalMatrix() );
-        MakeTrapezoidal( LEFT, LOWER, -1, D11 );
-        Gemv
-        ( TRANSPOSE,
-          alpha, D11.LockedLocalMatrix(),
-                 x1_MC_STAR.LockedLocalMatrix(),
-          T(1),  z1_MR_STAR.LocalMatrix() );
-
-        Gemv
-        ( NORMAL,
-          alpha, A21.LockedLocalMatrix(),
-                 x1_MR_STAR.LockedLocalMatrix(),
-          T(1),  z2_MC_STAR.LocalMatrix() );
-        Gemv
-        ( TRANSPOSE,
-          alpha, A21.LockedLocalMatrix(),
-                 x2_MC_STAR.LockedLocalMatrix(),
-          T(1),  z1_MR_STAR.LocalMatrix() );
-        //--------------------------------------------------------------------//
-        D11.FreeAlignments();
-
-        SlideLockedPartitionDown
-        ( xT_MC_STAR,  x0_MC_STAR,
-                       x1_MC_STAR,
-         /**********/ /**********/
-          xB_MC_STAR,  x2_MC_STAR );
-    }
-    PopBlocksizeStack();
+    FusedLocalSymv
+    ( LOWER, false, alpha, A,
+      x_MC_STAR.LockedLocalBuffer(), x_MR_STAR.LockedLocalBuffer(),
+      z_MC_STAR.LocalBuffer(), z_MR_STAR.LocalBuffer(),
+      LocalSymvBlocksize<T>() );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -185,77 +112,11 @@ LocalSymvRowAccumulateL
         z_STAR_MR.RowAlignment() != A.RowAlignment()   )
         throw std::logic_error("Partial matrix distributions are misaligned");
 #endif
-    const Grid& g = A.Grid();
-
-    // Matrix views
-    DistMatrix<T> A11(g),
-                  A21(g);
-    DistMatrix<T> D11(g);
-
-    DistMatrix<T,STAR,MC> 
-        xL_STAR_MC(g), xR_STAR_MC(g),
-        x0_STAR_MC(g), x1_STAR_MC(g), x2_STAR_MC(g);
-    DistMatrix<T,STAR,MR> x1_STAR_MR(g);
-    DistMatrix<T,STAR,MC> z1_STAR_MC(g), z2_STAR_MC(g);
-    DistMatrix<T,STAR,MR> z1_STAR_MR(g);
-
-    // We want our local gemvs to be of width blocksize, so we will 
-    // temporarily change to max(r,c) times the current blocksize
-    const int ratio = std::max( g.Height(), g.Width() );
-    PushBlocksizeStack( ratio*LocalSymvBlocksize<T>() );
-                 
-    LockedPartitionRight( x_STAR_MC,  xL_STAR_MC, xR_STAR_MC, 0 );
-    while( xL_STAR_MC.Width() < x_STAR_MC.Width() )
-    {
-        LockedRepartitionRight
-        ( xL_STAR_MC, /**/ xR_STAR_MC, 
-          x0_STAR_MC, /**/ x1_STAR_MC, x2_STAR_MC );
-
-        const int n0 = x0_STAR_MC.Width();
-        const int n1 = x1_STAR_MC.Width();
-        const int n2 = x2_STAR_MC.Width();
-        LockedView( A11, A, n0,    n0, n1, n1 );
-        LockedView( A21, A, n0+n1, n0, n2, n1 );
-        LockedView( x1_STAR_MR, x_STAR_MR, 0, n0, 1, n1 );
-        View( z1_STAR_MC, z_STAR_MC, 0, n0,    1, n1 );
-        View( z2_STAR_MC, z_STAR_MC, 0, n0+n1, 1, n2 );
-        View( z1_STAR_MR, z_STAR_MR, 0, n0,    1, n1 );
-
-        D11.AlignWith( A11 );
-        //--------------------------------------------------------------------//
-        // TODO: These diagonal block updates can be greatly improved
-        D11 = A11;
-        MakeTrapezoidal( LEFT, LOWER, 0, D11 );
-        Gemv
-        ( NORMAL, 
-          alpha, D11.LockedLocalMatrix(), 
-                 x1_STAR_MR.LockedLocalMatrix(),
-          T(1),  z1_STAR_MC.LocalMatrix() );
-        MakeTrapezoidal( LEFT, LOWER, -1, D11 );
-        Gemv
-        ( TRANSPOSE,
-          alpha, D11.LockedLocalMatrix(),
-                 x1_STAR_MC.LockedLocalMatrix(),
-          T(1),  z1_STAR_MR.LocalMatrix() );
-
-        Gemv
-        ( NORMAL,
-          alpha, A21.LockedLocalMatrix(),
-                 x1_STAR_MR.LockedLocalMatrix(),
-          T(1),  z2_STAR_MC.LocalMatrix() );
-        Gemv
-        ( TRANSPOSE,
-          alpha, A21.LockedLocalMatrix(),
-                 x2_STAR_MC.LockedLocalMatrix(),
-          T(1),  z1_STAR_MR.LocalMatrix() );
-        //--------------------------------------------------------------------//
-        D11.FreeAlignments();
-
-        SlideLockedPartitionRight
-        ( xL_STAR_MC,             /**/ xR_STAR_MC,
-          x0_STAR_MC, x1_STAR_MC, /**/ x2_STAR_MC );
-    }
-    PopBlocksizeStack();
+    FusedLocalSymv
+    ( LOWER, false, alpha, A,
+      x_STAR_MC.LockedLocalMatrix(), x_STAR_MR.LockedLocalMatrix(),
+      z_STAR_MC.LocalMatrix(), z_STAR_MR.LocalMatrix(),
+      LocalSymvBlocksize<T>() );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -7,10 +7,14 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 
+#include "./level3/CostModel.hpp"
 #include "./level3/Gemm.hpp"
+#include "./level3/Gemm25D.hpp"
+#include "./level3/GemmBatch.hpp"
 #include "./level3/Hemm.hpp"
 #include "./level3/Her2k.hpp"
 #include "./level3/Herk.hpp"
+#include "./level3/Multiply.hpp"
 #include "./level3/Symm.hpp"
 #include "./level3/Syr2k.hpp"
 #include "./level3/Syrk.hpp"
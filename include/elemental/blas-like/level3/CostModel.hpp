@@ -0,0 +1,185 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace internal {
+
+// Predicted costs of the collectives used by the level 3 routines on q
+// processes, where 'bytes' is the amount of data each process ends up with
+// (for AllGather) or starts with (for AllToAll and ReduceScatter).
+
+inline int
+CeilLog2( int q )
+{
+    int log2q = 0;
+    for( int i=1; i<q; i*=2 )
+        ++log2q;
+    return log2q;
+}
+
+inline double
+AllGatherCost( const CostModel& model, int q, double bytes )
+{
+    if( q == 1 )
+        return 0;
+    return CeilLog2(q)*model.latency + 
+           (bytes*(q-1)/q)*model.inverseBandwidth;
+}
+
+inline double
+AllToAllCost( const CostModel& model, int q, double bytes )
+{
+    if( q == 1 )
+        return 0;
+    return (q-1)*model.latency + (bytes*(q-1)/q)*model.inverseBandwidth;
+}
+
+inline double
+ReduceScatterCost
+( const CostModel& model, int q, double bytes, double flopsPerByte )
+{
+    if( q == 1 )
+        return 0;
+    return CeilLog2(q)*model.latency + 
+           (bytes*(q-1)/q)*(model.inverseBandwidth+flopsPerByte*model.flopTime);
+}
+
+enum GemmVariant
+{
+    GEMM_STATIONARY_A,
+    GEMM_STATIONARY_B,
+    GEMM_STATIONARY_C,
+    GEMM_DOT
+};
+
+// The predicted time for a process to run the given distributed Gemm variant 
+// to form an m x n matrix C from an inner dimension of size k. The stationary
+// variants communicate (nearly) the same amount of data regardless of the 
+// orientations of A and B.
+template<typename T>
+inline double
+GemmCost( GemmVariant variant, const Grid& g, int m, int n, int k )
+{
+    const CostModel& model = GetCostModel();
+    const int r = g.Height();
+    const int c = g.Width();
+    const int p = g.Size();
+    const double nb = Blocksize();
+    const double size = sizeof(T);
+    const double flopsPerByte = ( IsComplex<T>::val ? 2 : 1 )/size;
+    const double realFlops = ( IsComplex<T>::val ? 4. : 1. )*2.*m*n*k;
+
+    double cost = (realFlops/p)*model.flopTime;
+    if( variant == GEMM_STATIONARY_A )
+    {
+        // Redistribute and gather each panel of B, then reduce-scatter the 
+        // corresponding panel of C within each process row
+        const double numPanels = std::ceil( n/nb );
+        cost += numPanels*
+            ( AllToAllCost( model, r, size*k*nb/p ) +
+              AllGatherCost( model, r, size*k*nb/c ) +
+              ReduceScatterCost( model, c, size*m*nb/r, flopsPerByte ) );
+    }
+    else if( variant == GEMM_STATIONARY_B )
+    {
+        const double numPanels = std::ceil( m/nb );
+        cost += numPanels*
+            ( AllToAllCost( model, c, size*k*nb/p ) +
+              AllGatherCost( model, c, size*k*nb/r ) +
+              ReduceScatterCost( model, r, size*n*nb/c, flopsPerByte ) );
+    }
+    else if( variant == GEMM_STATIONARY_C )
+    {
+        // Gather a panel of A within each process row and a panel of B within
+        // each process column
+        const double numPanels = std::ceil( k/nb );
+        cost += numPanels*
+            ( AllGatherCost( model, c, size*m*nb/r ) +
+              AllGatherCost( model, r, size*n*nb/c ) );
+    }
+    else
+    {
+        // Redistribute each panel of the longer dimension over all processes,
+        // then sum each nb x nb block of C over the entire grid
+        const double numOuter = std::ceil( std::max(m,n)/nb );
+        const double numInner = std::ceil( std::min(m,n)/nb );
+        cost += numOuter*AllToAllCost( model, p, size*k*nb/p ) +
+                numOuter*numInner*
+                ( AllToAllCost( model, p, size*k*nb/p ) + 
+                  ReduceScatterCost( model, p, size*nb*nb, flopsPerByte ) );
+    }
+    return cost;
+}
+
+// Returns the variant with the lowest predicted cost, or, if the cost model 
+// is not in use, the one chosen by the traditional heuristic
+template<typename T>
+inline GemmVariant
+ChooseGemmVariant( const Grid& g, int m, int n, int k, bool allowDot )
+{
+    if( GetLevel3Selection() == LEVEL3_HEURISTIC )
+    {
+        const float weightTowardsC = 2.0;
+        const float weightAwayFromDot = 10.0;
+        if( allowDot && weightAwayFromDot*m <= k && weightAwayFromDot*n <= k )
+            return GEMM_DOT;
+        else if( m <= n && weightTowardsC*m <= k )
+            return GEMM_STATIONARY_B;
+        else if( n <= m && weightTowardsC*n <= k )
+            return GEMM_STATIONARY_A;
+        else
+            return GEMM_STATIONARY_C;
+    }
+
+    GemmVariant bestVariant = GEMM_STATIONARY_C;
+    double bestCost = GemmCost<T>( GEMM_STATIONARY_C, g, m, n, k );
+    const GemmVariant others[3] = 
+        { GEMM_STATIONARY_A, GEMM_STATIONARY_B, GEMM_DOT };
+    const int numOthers = ( allowDot ? 3 : 2 );
+    for( int i=0; i<numOthers; ++i )
+    {
+        const double cost = GemmCost<T>( others[i], g, m, n, k );
+        if( cost < bestCost )
+        {
+            bestVariant = others[i];
+            bestCost = cost;
+        }
+    }
+    return bestVariant;
+}
+
+// Whether the left-sided Trsm variant which spreads each row panel of X over
+// the entire grid (so that the triangular solves are not redundant) should be
+// preferred over the one which only spreads it within each process column.
+// The former requires an extra all-to-all within each process column.
+template<typename F>
+inline bool
+UseLargeLeftTrsm( const Grid& g, int m, int n )
+{
+    const int p = g.Size();
+    if( GetLevel3Selection() == LEVEL3_HEURISTIC )
+        return n > 5*p;
+
+    const CostModel& model = GetCostModel();
+    const int r = g.Height();
+    const int c = g.Width();
+    const double nb = std::max( std::min( Blocksize(), m ), 1 );
+    const double size = sizeof(F);
+    const double flopFactor = ( IsComplex<F>::val ? 4. : 1. );
+    const double solveFlops = flopFactor*nb*nb*n;
+
+    // The costs for each panel which differ between the two variants
+    const double largeCost = 
+        AllToAllCost( model, r, size*nb*n/c ) + (solveFlops/p)*model.flopTime;
+    const double mediumCost = (solveFlops/c)*model.flopTime;
+    return largeCost < mediumCost;
+}
+
+} // namespace internal
+} // namespace elem
@@ -469,41 +469,51 @@ GemmNNDot
 #endif
 }
 
+// Choose between the two-dimensional (SUMMA) variants within each layer
 template<typename T>
 inline void
-GemmNN
+GemmNN2D
 ( T alpha, const DistMatrix<T>& A,
            const DistMatrix<T>& B,
   T beta,        DistMatrix<T>& C )
 {
 #ifndef RELEASE
-    PushCallStack("internal::GemmNN");
+    PushCallStack("internal::GemmNN2D");
     if( A.Grid() != B.Grid() || B.Grid() != C.Grid() )
         throw std::logic_error
         ("{A,B,C} must be distributed over the same grid");
 #endif
-    const int m = C.Height();
-    const int n = C.Width();
-    const int k = A.Width();
-    const float weightTowardsC = 2.0;
-    const float weightAwayFromDot = 10.0;
-
-    if( weightAwayFromDot*m <= k && weightAwayFromDot*n <= k )
-    {
+    const GemmVariant variant = ChooseGemmVariant<T>
+        ( C.Grid(), C.Height(), C.Width(), A.Width(), true );
+    if( variant == GEMM_DOT )
         GemmNNDot( alpha, A, B, beta, C );
-    }
-    else if( m <= n && weightTowardsC*m <= k )
-    {
-        GemmNNB( alpha, A, B, beta, C );    
-    }
-    else if( n <= m && weightTowardsC*n <= k )
-    {
+    else if( variant == GEMM_STATIONARY_B )
+        GemmNNB( alpha, A, B, beta, C );
+    else if( variant == GEMM_STATIONARY_A )
         GemmNNA( alpha, A, B, beta, C );
-    }
     else
-    {
         GemmNNC( alpha, A, B, beta, C );
-    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// If the matrices are replicated over the layers of a Grid3D, then split the
+// inner dimension between the layers (see Gemm25D)
+template<typename T>
+inline void
+GemmNN
+( T alpha, const DistMatrix<T>& A,
+           const DistMatrix<T>& B,
+  T beta,        DistMatrix<T>& C )
+{
+#ifndef RELEASE
+    PushCallStack("internal::GemmNN");
+#endif
+    if( UseGemm25D( C.Grid(), A.Width() ) )
+        Gemm25D( NORMAL, NORMAL, alpha, A, B, beta, C );
+    else
+        GemmNN2D( alpha, A, B, beta, C );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -311,23 +311,14 @@ GemmNT
         throw std::logic_error
         ("GemmNT requires that B be (Conjugate)Transposed");
 #endif
-    const int m = C.Height();
-    const int n = C.Width();
-    const int k = A.Width();
-    const float weightTowardsC = 2.0;
-
-    if( m <= n && weightTowardsC*m <= k )
-    {
+    const GemmVariant variant = ChooseGemmVariant<T>
+        ( C.Grid(), C.Height(), C.Width(), A.Width(), false );
+    if( variant == GEMM_STATIONARY_B )
         GemmNTB( orientationOfB, alpha, A, B, beta, C );
-    }
-    else if( n <= m && weightTowardsC*n <= k )
-    {
+    else if( variant == GEMM_STATIONARY_A )
         GemmNTA( orientationOfB, alpha, A, B, beta, C );
-    }
     else
-    {
         GemmNTC( orientationOfB, alpha, A, B, beta, C );
-    }
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -309,23 +309,14 @@ GemmTN
     if( orientationOfA == NORMAL )
         throw std::logic_error("GemmTN assumes A is (Conjugate)Transposed");
 #endif
-    const int m = C.Height();
-    const int n = C.Width();
-    const int k = A.Height();
-    const float weightTowardsC = 2.0;
-
-    if( m <= n && weightTowardsC*m <= k )
-    {
+    const GemmVariant variant = ChooseGemmVariant<T>
+        ( C.Grid(), C.Height(), C.Width(), A.Height(), false );
+    if( variant == GEMM_STATIONARY_B )
         GemmTNB( orientationOfA, alpha, A, B, beta, C );
-    }
-    else if( n <= m && weightTowardsC*n <= k )
-    {
+    else if( variant == GEMM_STATIONARY_A )
         GemmTNA( orientationOfA, alpha, A, B, beta, C );
-    }
     else
-    {
         GemmTNC( orientationOfA, alpha, A, B, beta, C );
-    }
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -327,23 +327,14 @@ GemmTT
     if( orientationOfA == NORMAL || orientationOfB == NORMAL )
         throw std::logic_error("GemmTT expects A and B to be transposed");
 #endif
-    const int m = C.Height();
-    const int n = C.Width();
-    const int k = A.Height();
-    const float weightTowardsC = 2.0;
-
-    if( m <= n && weightTowardsC*m <= k )
-    {
+    const GemmVariant variant = ChooseGemmVariant<T>
+        ( C.Grid(), C.Height(), C.Width(), A.Height(), false );
+    if( variant == GEMM_STATIONARY_B )
         GemmTTB( orientationOfA, orientationOfB, alpha, A, B, beta, C );
-    }
-    else if( n <= m && weightTowardsC*n <= k )
-    {
+    else if( variant == GEMM_STATIONARY_A )
         GemmTTA( orientationOfA, orientationOfB, alpha, A, B, beta, C );
-    }
     else
-    {
         GemmTTC( orientationOfA, orientationOfB, alpha, A, B, beta, C );
-    }
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -0,0 +1,161 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace internal {
+
+template<typename T>
+inline void
+Gemm2D
+( Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const DistMatrix<T>& A, const DistMatrix<T>& B,
+  T beta,        DistMatrix<T>& C )
+{
+#ifndef RELEASE
+    PushCallStack("internal::Gemm2D");
+#endif
+    if( orientationOfA == NORMAL && orientationOfB == NORMAL )
+        GemmNN2D( alpha, A, B, beta, C );
+    else if( orientationOfA == NORMAL )
+        GemmNT( orientationOfB, alpha, A, B, beta, C );
+    else if( orientationOfB == NORMAL )
+        GemmTN( orientationOfA, alpha, A, B, beta, C );
+    else
+        GemmTT( orientationOfA, orientationOfB, alpha, A, B, beta, C );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+inline bool
+UseGemm25D( const Grid& g, int k )
+{
+    const Grid3D* grid3D = dynamic_cast<const Grid3D*>(&g);
+    return grid3D != 0 && grid3D->Depth() > 1 && k >= grid3D->Depth();
+}
+
+// Sum the copies of A from each layer so that every layer holds the total
+template<typename T>
+inline void
+SumOverDepth( DistMatrix<T>& A, mpi::Comm depthComm )
+{
+#ifndef RELEASE
+    PushCallStack("internal::SumOverDepth");
+#endif
+    const int localHeight = A.LocalHeight();
+    const int localWidth = A.LocalWidth();
+    const int localSize = localHeight*localWidth;
+    if( localSize == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    if( A.LocalLDim() == localHeight )
+    {
+        mpi::AllReduce( A.LocalBuffer(), localSize, mpi::SUM, depthComm );
+    }
+    else
+    {
+        std::vector<T> buffer( localSize );
+        const int ldim = A.LocalLDim();
+        T* ABuffer = A.LocalBuffer();
+        for( int jLocal=0; jLocal<localWidth; ++jLocal )
+            MemCopy
+            ( &buffer[jLocal*localHeight], &ABuffer[jLocal*ldim],
+              localHeight );
+        mpi::AllReduce( &buffer[0], localSize, mpi::SUM, depthComm );
+        for( int jLocal=0; jLocal<localWidth; ++jLocal )
+            MemCopy
+            ( &ABuffer[jLocal*ldim], &buffer[jLocal*localHeight],
+              localHeight );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace internal
+
+template<typename T>
+inline void
+Gemm25D
+( Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const DistMatrix<T>& A, const DistMatrix<T>& B,
+  T beta,        DistMatrix<T>& C )
+{
+#ifndef RELEASE
+    PushCallStack("Gemm25D");
+    if( A.Grid() != B.Grid() || B.Grid() != C.Grid() )
+        throw std::logic_error
+        ("{A,B,C} must be distributed over the same grid");
+#endif
+    const Grid3D* grid3D = dynamic_cast<const Grid3D*>(&C.Grid());
+    if( grid3D == 0 || grid3D->Depth() == 1 )
+    {
+        internal::Gemm2D
+        ( orientationOfA, orientationOfB, alpha, A, B, beta, C );
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+    const Grid& g = C.Grid();
+    const int depth = grid3D->Depth();
+    const int depthRank = grid3D->DepthRank();
+
+    // Each layer is responsible for a contiguous piece of the inner dimension
+    const int k = ( orientationOfA == NORMAL ? A.Width() : A.Height() );
+    const int kLayer = k/depth + ( depthRank < k % depth ? 1 : 0 );
+    const int kOffset = depthRank*(k/depth) + std::min(depthRank,k % depth);
+
+    DistMatrix<T> ALayer(g), BLayer(g);
+    if( orientationOfA == NORMAL )
+        LockedView( ALayer, A, 0, kOffset, A.Height(), kLayer );
+    else
+        LockedView( ALayer, A, kOffset, 0, kLayer, A.Width() );
+    if( orientationOfB == NORMAL )
+        LockedView( BLayer, B, kOffset, 0, kLayer, B.Width() );
+    else
+        LockedView( BLayer, B, 0, kOffset, B.Height(), kLayer );
+
+    // Only the front layer keeps beta C, and the contributions from each
+    // layer are then summed over the depth
+    const T betaLayer = ( depthRank == 0 ? beta : T(0) );
+    internal::Gemm2D
+    ( orientationOfA, orientationOfB, alpha, ALayer, BLayer, betaLayer, C );
+    internal::SumOverDepth( C, grid3D->DepthComm() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T>
+inline void
+Gemm3D
+( Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const DistMatrix<T>& A, const DistMatrix<T>& B,
+  T beta,        DistMatrix<T>& C )
+{
+#ifndef RELEASE
+    PushCallStack("Gemm3D");
+#endif
+    const Grid3D* grid3D = dynamic_cast<const Grid3D*>(&C.Grid());
+    if( grid3D == 0 || grid3D->Height() != grid3D->Depth() ||
+        grid3D->Width() != grid3D->Depth() )
+        throw std::logic_error("Gemm3D requires a cubic Grid3D");
+    Gemm25D( orientationOfA, orientationOfB, alpha, A, B, beta, C );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
@@ -0,0 +1,133 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace internal {
+
+// The largest dimension for which the batched routines avoid calling BLAS
+const int SMALL_BATCH_SIZE = 16;
+
+// C := alpha A B + beta C for small matrices, one column of C at a time so 
+// that the innermost loop is a unit-stride axpy
+template<typename T>
+inline void
+SmallGemmNN
+( int m, int n, int k, 
+  T alpha, const T* A, int lda, const T* B, int ldb, 
+  T beta,        T* C, int ldc )
+{
+    for( int j=0; j<n; ++j )
+    {
+        T* c = &C[j*ldc];
+        if( beta == T(0) )
+            for( int i=0; i<m; ++i )
+                c[i] = 0;
+        else if( beta != T(1) )
+            for( int i=0; i<m; ++i )
+                c[i] *= beta;
+        for( int l=0; l<k; ++l )
+        {
+            const T gamma = alpha*B[l+j*ldb];
+            const T* a = &A[l*lda];
+            for( int i=0; i<m; ++i )
+                c[i] += a[i]*gamma;
+        }
+    }
+}
+
+} // namespace internal
+
+template<typename T>
+inline void
+Gemm
+( Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const MatrixBatch<T>& A, const MatrixBatch<T>& B,
+  T beta,        MatrixBatch<T>& C )
+{
+#ifndef RELEASE
+    PushCallStack("Gemm");
+    const int AHeight = 
+        ( orientationOfA == NORMAL ? A.Height() : A.Width() );
+    const int AWidth = 
+        ( orientationOfA == NORMAL ? A.Width() : A.Height() );
+    const int BHeight = 
+        ( orientationOfB == NORMAL ? B.Height() : B.Width() );
+    const int BWidth = 
+        ( orientationOfB == NORMAL ? B.Width() : B.Height() );
+    if( AHeight != C.Height() || BWidth != C.Width() || AWidth != BHeight )
+        throw std::logic_error("Nonconformal batched Gemm");
+    if( A.Count() != C.Count() || B.Count() != C.Count() )
+        throw std::logic_error("Batches must be the same size");
+#endif
+    const char transA = OrientationToChar( orientationOfA );
+    const char transB = OrientationToChar( orientationOfB );
+    const int m = C.Height();
+    const int n = C.Width();
+    const int k = ( orientationOfA == NORMAL ? A.Width() : A.Height() );
+    const int count = C.Count();
+    const bool small = 
+        orientationOfA == NORMAL && orientationOfB == NORMAL &&
+        std::max(std::max(m,n),k) <= internal::SMALL_BATCH_SIZE;
+
+    const T* ABuffer = A.LockedBuffer();
+    const T* BBuffer = B.LockedBuffer();
+    T* CBuffer = C.Buffer();
+    const int lda = A.LDim();
+    const int ldb = B.LDim();
+    const int ldc = C.LDim();
+    const int strideA = A.Stride();
+    const int strideB = B.Stride();
+    const int strideC = C.Stride();
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for
+#endif
+    for( int l=0; l<count; ++l )
+    {
+        const T* AMat = &ABuffer[l*strideA];
+        const T* BMat = &BBuffer[l*strideB];
+        T* CMat = &CBuffer[l*strideC];
+        if( small || k == 0 )
+            internal::SmallGemmNN
+            ( m, n, small ? k : 0, 
+              alpha, AMat, lda, BMat, ldb, beta, CMat, ldc );
+        else
+            blas::Gemm
+            ( transA, transB, m, n, k, 
+              alpha, AMat, lda, BMat, ldb, beta, CMat, ldc );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T>
+inline void
+Gemm
+( Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const DistMatrixBatch<T>& A, const DistMatrixBatch<T>& B,
+  T beta,        DistMatrixBatch<T>& C )
+{
+#ifndef RELEASE
+    PushCallStack("Gemm");
+    if( A.Grid() != B.Grid() || B.Grid() != C.Grid() )
+        throw std::logic_error
+        ("{A,B,C} must be distributed over the same grid");
+    if( A.Count() != C.Count() || B.Count() != C.Count() )
+        throw std::logic_error("Batches must be the same size");
+#endif
+    Gemm
+    ( orientationOfA, orientationOfB, 
+      alpha, A.LockedLocalBatch(), B.LockedLocalBatch(), 
+      beta, C.LocalBatch() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
@@ -0,0 +1,93 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+template<typename T>
+inline void
+Multiply
+( T alpha, const DistSparseMatrix<T>& A, const DistMatrix<T,VC,STAR>& X,
+  T beta,        DistMatrix<T,VC,STAR>& Y )
+{
+#ifndef RELEASE
+    PushCallStack("Multiply");
+    if( !A.Consistent() )
+        throw std::logic_error("MakeConsistent must be called first");
+    if( A.Height() != Y.Height() || A.Width() != X.Height() ||
+        X.Width() != Y.Width() )
+        throw std::logic_error("Nonconformal Multiply");
+    if( A.Grid() != Y.Grid() )
+        throw std::logic_error("A and Y must use the same grid");
+    if( Y.ColAlignment() != 0 )
+        throw std::logic_error("Y must have a column alignment of zero");
+#endif
+    // Gather the rows of X which are referenced by our rows of A
+    Matrix<T> XGhostTrans;
+    A.GatherGhosts( X, XGhostTrans );
+
+    const int width = Y.Width();
+    const int localHeight = Y.LocalHeight();
+    const int YLDim = Y.LocalLDim();
+    const int* offsets = A.LockedOffsetBuffer();
+    const int* ghostIndices = A.LockedGhostIndexBuffer();
+    const T* values = A.LockedValueBuffer();
+    const T* XGhostBuffer = XGhostTrans.LockedBuffer();
+    T* YLocalBuffer = Y.LocalBuffer();
+    if( width == 1 )
+    {
+#ifdef HAVE_OPENMP
+        #pragma omp parallel for
+#endif
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+        {
+            T sum = 0;
+            for( int k=offsets[iLocal]; k<offsets[iLocal+1]; ++k )
+                sum += values[k]*XGhostBuffer[ghostIndices[k]];
+            T& upsilon = YLocalBuffer[iLocal];
+            upsilon = ( beta == T(0) ? alpha*sum : alpha*sum + beta*upsilon );
+        }
+    }
+    else
+    {
+        // Accumulate each row of Y contiguously since the ghost rows of X are
+        // stored contiguously
+#ifdef HAVE_OPENMP
+        #pragma omp parallel
+#endif
+        {
+            std::vector<T> sums( width );
+#ifdef HAVE_OPENMP
+            #pragma omp for
+#endif
+            for( int iLocal=0; iLocal<localHeight; ++iLocal )
+            {
+                for( int j=0; j<width; ++j )
+                    sums[j] = 0;
+                for( int k=offsets[iLocal]; k<offsets[iLocal+1]; ++k )
+                {
+                    const T value = values[k];
+                    const T* xGhost = &XGhostBuffer[ghostIndices[k]*width];
+                    for( int j=0; j<width; ++j )
+                        sums[j] += value*xGhost[j];
+                }
+                for( int j=0; j<width; ++j )
+                {
+                    T& upsilon = YLocalBuffer[iLocal+j*YLDim];
+                    upsilon = ( beta == T(0) ? alpha*sums[j]
+                                             : alpha*sums[j] + beta*upsilon );
+                }
+            }
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
@@ -85,19 +85,20 @@ Trsm
             throw std::logic_error("Nonconformal Trsm");
     }
 #endif
-    const int p = B.Grid().Size();
+    const bool useLarge = 
+        internal::UseLargeLeftTrsm<F>( B.Grid(), B.Height(), B.Width() );
     if( side == LEFT && uplo == LOWER )
     {
         if( orientation == NORMAL )
         {
-            if( B.Width() > 5*p )
+            if( useLarge )
                 internal::TrsmLLNLarge( diag, alpha, A, B, checkIfSingular );
             else
                 internal::TrsmLLNMedium( diag, alpha, A, B, checkIfSingular );
         }
         else
         {
-            if( B.Width() > 5*p )
+            if( useLarge )
                 internal::TrsmLLTLarge
                 ( orientation, diag, alpha, A, B, checkIfSingular );
             else
@@ -109,14 +110,14 @@ Trsm
     {
         if( orientation == NORMAL )
         {
-            if( B.Width() > 5*p )
+            if( useLarge )
                 internal::TrsmLUNLarge( diag, alpha, A, B, checkIfSingular );
             else
                 internal::TrsmLUNMedium( diag, alpha, A, B, checkIfSingular );
         }
         else
         {
-            if( B.Width() > 5*p )
+            if( useLarge )
                 internal::TrsmLUTLarge
                 ( orientation, diag, alpha, A, B, checkIfSingular );
             else
@@ -63,6 +63,43 @@ template<> int LocalTrr2kBlocksize<double>();
 template<> int LocalTrr2kBlocksize<scomplex>();
 template<> int LocalTrr2kBlocksize<dcomplex>();
 
+// An alpha-beta-gamma model of the time required by each process: sending a
+// message of n bytes costs latency + n inverseBandwidth seconds, and each 
+// (real) flop costs flopTime seconds
+struct CostModel
+{
+    double latency;          // alpha
+    double inverseBandwidth; // beta
+    double flopTime;         // gamma
+
+    CostModel();
+    CostModel( double latency_, double inverseBandwidth_, double flopTime_ );
+};
+
+// The model used to choose between the variants of the distributed level 3
+// routines when the cost model selection is in use
+void SetCostModel( const CostModel& model );
+const CostModel& GetCostModel();
+
+// Measure the parameters of the cost model on the grid and make it the current
+// model. The second version first attempts to read the parameters from 
+// 'cacheFile' and, if they were not found, writes the measured parameters.
+CostModel CalibrateCostModel( const Grid& g );
+CostModel CalibrateCostModel( const Grid& g, const std::string& cacheFile );
+
+namespace level3_selection_wrapper {
+enum Level3Selection
+{
+    LEVEL3_HEURISTIC, // Fixed ratios of the matrix dimensions
+    LEVEL3_COST_MODEL // The variant with the lowest predicted time
+};
+}
+using namespace level3_selection_wrapper;
+
+// Affects how the distributed Gemm and Trsm choose between their variants
+void SetLevel3Selection( Level3Selection selection );
+Level3Selection GetLevel3Selection();
+
 //----------------------------------------------------------------------------//
 // Level 1 BLAS-like functionality                                            //
 //----------------------------------------------------------------------------//
@@ -718,6 +755,35 @@ void Gemm
   T alpha, const DistMatrix<T>& A, const DistMatrix<T>& B,
   T beta,        DistMatrix<T>& C );
 
+// 2.5D version: A, B, and C should be distributed over a Grid3D, where each
+// layer holds a copy of each matrix. The inner dimension is split between the
+// layers and the partial products are summed so that each layer holds C.
+template<typename T>
+void Gemm25D
+( Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const DistMatrix<T>& A, const DistMatrix<T>& B,
+  T beta,        DistMatrix<T>& C );
+
+// 3D version: the special case of a Grid3D of dimensions p^(1/3) in each
+// direction
+template<typename T>
+void Gemm3D
+( Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const DistMatrix<T>& A, const DistMatrix<T>& B,
+  T beta,        DistMatrix<T>& C );
+
+// Batched versions: C_l := alpha op(A_l) op(B_l) + beta C_l for each l
+template<typename T>
+void Gemm
+( Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const MatrixBatch<T>& A, const MatrixBatch<T>& B,
+  T beta,        MatrixBatch<T>& C );
+template<typename T>
+void Gemm
+( Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const DistMatrixBatch<T>& A, const DistMatrixBatch<T>& B,
+  T beta,        DistMatrixBatch<T>& C );
+
 //
 // Hemm (HErmitian Matrix-Matrix multiplication):
 //
@@ -787,6 +853,20 @@ void Herk
 ( UpperOrLower uplo, Orientation orientation,
   T alpha, const DistMatrix<T>& A, T beta, DistMatrix<T>& C );
 
+//
+// Multiply (sparse matrix times dense matrices):
+//
+// Y := alpha A X + beta Y,
+//
+// where A is a DistSparseMatrix and X and Y have a column alignment of zero.
+// Only the rows of X referenced by each process's entries of A are 
+// communicated, using the plan formed by A.MakeConsistent().
+//
+template<typename T>
+void Multiply
+( T alpha, const DistSparseMatrix<T>& A, const DistMatrix<T,VC,STAR>& X,
+  T beta,        DistMatrix<T,VC,STAR>& Y );
+
 //
 // Symm (SYmmetric Matrix-Matrix multiplication):
 //
@@ -17,6 +17,7 @@
 #include <ctime>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <sstream>
 #include <stack>
@@ -24,6 +25,13 @@
 #include <string>
 #include <vector>
 
+#ifdef HAVE_MMAP
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
 // If defined, the _OPENMP macro contains the date of the specification
 #ifdef HAVE_OPENMP
 # include <omp.h>
@@ -57,6 +65,7 @@
 #include "elemental/core/matrix_decl.hpp"
 #include "elemental/core/imports/mpi.hpp"
 #include "elemental/core/grid_decl.hpp"
+#include "elemental/core/grid3d_decl.hpp"
 #include "elemental/core/dist_matrix_decl.hpp"
 #include "elemental/core/environment_decl.hpp"
 #include "elemental/core/indexing_decl.hpp"
@@ -65,6 +74,7 @@
 #include "elemental/core/imports/lapack.hpp"
 #include "elemental/core/imports/flame.hpp"
 #include "elemental/core/imports/plcg.hpp"
+#include "elemental/core/imports/philox.hpp"
 #ifndef WITHOUT_PMRRR
   #include "elemental/core/imports/pmrrr.hpp"
 #endif
@@ -78,6 +88,7 @@
 #include "elemental/core/types_impl.hpp"
 #include "elemental/core/matrix_impl.hpp"
 #include "elemental/core/grid_impl.hpp"
+#include "elemental/core/grid3d_impl.hpp"
 #include "elemental/core/dist_matrix_impl.hpp"
 #include "elemental/core/environment_impl.hpp"
 #include "elemental/core/indexing_impl.hpp"
@@ -95,3 +106,15 @@
 #include "elemental/core/random_impl.hpp"
 #include "elemental/core/axpy_interface_decl.hpp"
 #include "elemental/core/axpy_interface_impl.hpp"
+#include "elemental/core/redist_plan_decl.hpp"
+#include "elemental/core/redist_plan_impl.hpp"
+#include "elemental/core/matrix_batch_decl.hpp"
+#include "elemental/core/matrix_batch_impl.hpp"
+#include "elemental/core/dist_matrix_batch_decl.hpp"
+#include "elemental/core/dist_matrix_batch_impl.hpp"
+#include "elemental/core/dist_sparse_matrix_decl.hpp"
+#include "elemental/core/dist_sparse_matrix_impl.hpp"
+#include "elemental/core/binary_io_decl.hpp"
+#include "elemental/core/binary_io_impl.hpp"
+#include "elemental/core/out_of_core_matrix_decl.hpp"
+#include "elemental/core/out_of_core_matrix_impl.hpp"
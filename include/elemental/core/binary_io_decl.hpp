@@ -0,0 +1,73 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+// Binary matrix files consist of a 64-byte header followed by the entries of
+// the entire matrix in column-major order (with no padding), independent of
+// the distribution that the matrix was written from. The distribution and
+// alignments are only recorded for informational purposes, so a file may be
+// read into any distribution over any grid.
+struct BinaryHeader
+{
+    char magic[8];
+    int version;
+    int dataType;
+    int colDist, rowDist;
+    int colAlignment, rowAlignment;
+    long long height, width;
+    char padding[16];
+};
+
+// Write A to a binary file. The distributed version opens the file
+// collectively with MPI-IO, and each process writes its local entries
+// directly into their (strided) positions within the file, so no process
+// ever holds more than its own portion of the matrix.
+template<typename T,typename Int>
+void WriteBinary( const Matrix<T,Int>& A, const std::string filename );
+template<typename T,Distribution U,Distribution V,typename Int>
+void WriteBinary
+( const DistMatrix<T,U,V,Int>& A, const std::string filename );
+
+// Read A (which is resized as necessary) from a binary file. The sequential
+// and [* ,* ] versions memory map the file (when available) on each process,
+// whereas the rest read their local entries in parallel with MPI-IO.
+template<typename T,typename Int>
+void ReadBinary( Matrix<T,Int>& A, const std::string filename );
+template<typename T,Distribution U,Distribution V,typename Int>
+void ReadBinary( DistMatrix<T,U,V,Int>& A, const std::string filename );
+template<typename T,typename Int>
+void ReadBinary
+( DistMatrix<T,STAR,STAR,Int>& A, const std::string filename );
+
+// A read-only view of the matrix within a memory-mapped binary file, which
+// is unmapped upon destruction. If memory mapping is not supported, the
+// matrix is instead read into memory owned by the object.
+template<typename T,typename Int=int>
+class MappedMatrix
+{
+public:
+    MappedMatrix( const std::string filename );
+    ~MappedMatrix();
+
+    const BinaryHeader& Header() const;
+    const Matrix<T,Int>& LockedMatrix() const;
+
+private:
+    BinaryHeader header_;
+    void* map_;
+    std::size_t mapSize_;
+    Matrix<T,Int> matrix_;
+
+    // Copying is disallowed since the view refers to map_
+    MappedMatrix( const MappedMatrix& );
+    const MappedMatrix& operator=( const MappedMatrix& );
+};
+
+} // namespace elem
@@ -0,0 +1,402 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace binary_io {
+
+const int VERSION = 1;
+
+template<typename T> struct TypeCode { };
+template<> struct TypeCode<int> { static const int value = 0; };
+template<> struct TypeCode<float> { static const int value = 1; };
+template<> struct TypeCode<double> { static const int value = 2; };
+template<> struct TypeCode<Complex<float> > { static const int value = 3; };
+template<> struct TypeCode<Complex<double> > { static const int value = 4; };
+
+inline void
+FormHeader
+( BinaryHeader& header, int dataType, Distribution colDist,
+  Distribution rowDist, int colAlignment, int rowAlignment,
+  long long height, long long width )
+{
+    MemZero( (char*)&header, sizeof(BinaryHeader) );
+    std::memcpy( header.magic, "ELEMMAT", 8 );
+    header.version = VERSION;
+    header.dataType = dataType;
+    header.colDist = colDist;
+    header.rowDist = rowDist;
+    header.colAlignment = colAlignment;
+    header.rowAlignment = rowAlignment;
+    header.height = height;
+    header.width = width;
+}
+
+inline void
+CheckHeader
+( const BinaryHeader& header, int dataType, const std::string filename )
+{
+    if( std::strncmp( header.magic, "ELEMMAT", 8 ) != 0 )
+    {
+        std::ostringstream msg;
+        msg << filename << " is not an Elemental binary matrix file";
+        throw std::runtime_error( msg.str() );
+    }
+    if( header.version != VERSION )
+    {
+        std::ostringstream msg;
+        msg << filename << " has unsupported version " << header.version;
+        throw std::runtime_error( msg.str() );
+    }
+    if( header.dataType != dataType )
+    {
+        std::ostringstream msg;
+        msg << filename << " has datatype code " << header.dataType
+            << " rather than " << dataType;
+        throw std::runtime_error( msg.str() );
+    }
+    if( header.height < 0 || header.width < 0 )
+    {
+        std::ostringstream msg;
+        msg << filename << " has invalid dimensions";
+        throw std::runtime_error( msg.str() );
+    }
+}
+
+// Form the datatypes which describe where the local entries of A live within
+// the file (relative to the returned displacement) and within the local
+// buffer. The entry (i,j) is stored at offset (i + j height) of the data.
+template<typename T,Distribution U,Distribution V,typename Int>
+inline void
+FormTypes
+( const DistMatrix<T,U,V,Int>& A,
+  mpi::Datatype& entryType, mpi::Datatype& fileType,
+  mpi::Datatype& memType, mpi::Offset& disp )
+{
+#ifndef RELEASE
+    PushCallStack("binary_io::FormTypes");
+#endif
+    const Int height = A.Height();
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    mpi::TypeContiguous( sizeof(T), mpi::BYTE, entryType );
+    mpi::TypeCommit( entryType );
+    disp = sizeof(BinaryHeader);
+    if( localHeight == 0 || localWidth == 0 )
+    {
+        mpi::TypeContiguous( 1, entryType, fileType );
+        mpi::TypeContiguous( 1, entryType, memType );
+    }
+    else
+    {
+        mpi::Datatype colType;
+        mpi::TypeVector( localHeight, 1, A.ColStride(), entryType, colType );
+        mpi::TypeHVector
+        ( localWidth, 1, mpi::Aint(A.RowStride())*height*sizeof(T),
+          colType, fileType );
+        mpi::TypeFree( colType );
+        mpi::TypeVector
+        ( localWidth, localHeight, A.LocalLDim(), entryType, memType );
+        disp +=
+            (mpi::Offset(A.RowShift())*height + A.ColShift())*sizeof(T);
+    }
+    mpi::TypeCommit( fileType );
+    mpi::TypeCommit( memType );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+inline void
+FreeTypes
+( mpi::Datatype& entryType, mpi::Datatype& fileType, mpi::Datatype& memType )
+{
+    mpi::TypeFree( memType );
+    mpi::TypeFree( fileType );
+    mpi::TypeFree( entryType );
+}
+
+// Each process writes its local entries with a single collective call, which
+// requires that every entry be owned by exactly one process
+template<typename T,Distribution U,Distribution V,typename Int>
+inline void
+WriteLocal
+( const DistMatrix<T,U,V,Int>& A, const BinaryHeader& header,
+  const std::string filename )
+{
+#ifndef RELEASE
+    PushCallStack("binary_io::WriteLocal");
+#endif
+    mpi::Comm comm = A.Grid().ViewingComm();
+    mpi::File fh;
+    mpi::FileOpen( comm, filename, mpi::MODE_WRONLY|mpi::MODE_CREATE, fh );
+    mpi::FileSetSize( fh, 0 );
+    if( mpi::CommRank( comm ) == 0 )
+        mpi::FileWriteAt
+        ( fh, 0, (const byte*)&header, sizeof(BinaryHeader) );
+
+    mpi::Datatype entryType, fileType, memType;
+    mpi::Offset disp;
+    FormTypes( A, entryType, fileType, memType, disp );
+    mpi::FileSetView( fh, disp, entryType, fileType );
+    const int count = ( A.LocalHeight()*A.LocalWidth() == 0 ? 0 : 1 );
+    mpi::FileWriteAll
+    ( fh, (const byte*)A.LockedLocalBuffer(), count, memType );
+    mpi::FileClose( fh );
+    FreeTypes( entryType, fileType, memType );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace binary_io
+
+template<typename T,typename Int>
+inline void
+WriteBinary( const Matrix<T,Int>& A, const std::string filename )
+{
+#ifndef RELEASE
+    PushCallStack("WriteBinary");
+#endif
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const Int ldim = A.LDim();
+    BinaryHeader header;
+    binary_io::FormHeader
+    ( header, binary_io::TypeCode<T>::value, STAR, STAR, 0, 0,
+      height, width );
+
+    std::ofstream file( filename.c_str(), std::ios::out|std::ios::binary );
+    if( !file.is_open() )
+    {
+        std::ostringstream msg;
+        msg << "Could not open " << filename;
+        throw std::runtime_error( msg.str() );
+    }
+    file.write( (const char*)&header, sizeof(BinaryHeader) );
+    if( ldim == height )
+        file.write
+        ( (const char*)A.LockedBuffer(),
+          std::streamsize(height)*width*sizeof(T) );
+    else
+        for( Int j=0; j<width; ++j )
+            file.write
+            ( (const char*)A.LockedBuffer(0,j), height*sizeof(T) );
+    if( !file )
+    {
+        std::ostringstream msg;
+        msg << "Could not write " << filename;
+        throw std::runtime_error( msg.str() );
+    }
+    file.close();
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,Distribution U,Distribution V,typename Int>
+inline void
+WriteBinary( const DistMatrix<T,U,V,Int>& A, const std::string filename )
+{
+#ifndef RELEASE
+    PushCallStack("WriteBinary");
+#endif
+    const Grid& g = A.Grid();
+    BinaryHeader header;
+    binary_io::FormHeader
+    ( header, binary_io::TypeCode<T>::value, U, V,
+      A.ColAlignment(), A.RowAlignment(), A.Height(), A.Width() );
+    if( A.ColStride()*A.RowStride() == g.Size() )
+        binary_io::WriteLocal( A, header, filename );
+    else
+    {
+        // The entries are either replicated or only owned by a subset of
+        // the processes, so write from an [MC,MR] copy instead
+        DistMatrix<T,MC,MR,Int> A_MC_MR( g );
+        A_MC_MR = A;
+        binary_io::WriteLocal( A_MC_MR, header, filename );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+ReadBinary( Matrix<T,Int>& A, const std::string filename )
+{
+#ifndef RELEASE
+    PushCallStack("ReadBinary");
+#endif
+    MappedMatrix<T,Int> mappedA( filename );
+    A = mappedA.LockedMatrix();
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,Distribution U,Distribution V,typename Int>
+inline void
+ReadBinary( DistMatrix<T,U,V,Int>& A, const std::string filename )
+{
+#ifndef RELEASE
+    PushCallStack("ReadBinary");
+#endif
+    mpi::Comm comm = A.Grid().ViewingComm();
+    mpi::File fh;
+    mpi::FileOpen( comm, filename, mpi::MODE_RDONLY, fh );
+    BinaryHeader header;
+    if( mpi::CommRank( comm ) == 0 )
+        mpi::FileReadAt( fh, 0, (byte*)&header, sizeof(BinaryHeader) );
+    mpi::Broadcast( (byte*)&header, sizeof(BinaryHeader), 0, comm );
+    binary_io::CheckHeader( header, binary_io::TypeCode<T>::value, filename );
+    A.ResizeTo( header.height, header.width );
+
+    // Since reads may overlap, replicated entries are read directly by each
+    // of their owners
+    mpi::Datatype entryType, fileType, memType;
+    mpi::Offset disp;
+    binary_io::FormTypes( A, entryType, fileType, memType, disp );
+    mpi::FileSetView( fh, disp, entryType, fileType );
+    const int count = ( A.LocalHeight()*A.LocalWidth() == 0 ? 0 : 1 );
+    mpi::FileReadAll( fh, (byte*)A.LocalBuffer(), count, memType );
+    mpi::FileClose( fh );
+    binary_io::FreeTypes( entryType, fileType, memType );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+ReadBinary( DistMatrix<T,STAR,STAR,Int>& A, const std::string filename )
+{
+#ifndef RELEASE
+    PushCallStack("ReadBinary");
+#endif
+    MappedMatrix<T,Int> mappedA( filename );
+    A.ResizeTo( mappedA.LockedMatrix().Height(),
+                mappedA.LockedMatrix().Width() );
+    A.LocalMatrix() = mappedA.LockedMatrix();
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+//
+// MappedMatrix
+//
+
+template<typename T,typename Int>
+inline
+MappedMatrix<T,Int>::MappedMatrix( const std::string filename )
+: map_(0), mapSize_(0)
+{
+#ifndef RELEASE
+    PushCallStack("MappedMatrix::MappedMatrix");
+#endif
+    std::ostringstream msg;
+#ifdef HAVE_MMAP
+    const int fd = open( filename.c_str(), O_RDONLY );
+    if( fd == -1 )
+    {
+        msg << "Could not open " << filename;
+        throw std::runtime_error( msg.str() );
+    }
+    struct stat fileStats;
+    if( fstat( fd, &fileStats ) != 0 ||
+        std::size_t(fileStats.st_size) < sizeof(BinaryHeader) )
+    {
+        close( fd );
+        msg << filename << " is too small to be a binary matrix file";
+        throw std::runtime_error( msg.str() );
+    }
+    mapSize_ = fileStats.st_size;
+    map_ = mmap( 0, mapSize_, PROT_READ, MAP_SHARED, fd, 0 );
+    close( fd );
+    if( map_ == MAP_FAILED )
+    {
+        map_ = 0;
+        msg << "Could not memory map " << filename;
+        throw std::runtime_error( msg.str() );
+    }
+    std::memcpy( &header_, map_, sizeof(BinaryHeader) );
+    try
+    {
+        binary_io::CheckHeader
+        ( header_, binary_io::TypeCode<T>::value, filename );
+        if( mapSize_ < sizeof(BinaryHeader) +
+                       std::size_t(header_.height*header_.width)*sizeof(T) )
+        {
+            msg << filename << " is truncated";
+            throw std::runtime_error( msg.str() );
+        }
+    }
+    catch( ... )
+    {
+        munmap( map_, mapSize_ );
+        map_ = 0;
+        throw;
+    }
+    // The header is 64 bytes, so the data is suitably aligned for any T
+    const T* buffer =
+        (const T*)((const char*)map_ + sizeof(BinaryHeader));
+    matrix_.LockedAttach
+    ( header_.height, header_.width, buffer,
+      std::max(Int(header_.height),Int(1)) );
+#else
+    std::ifstream file( filename.c_str(), std::ios::in|std::ios::binary );
+    if( !file.is_open() )
+    {
+        msg << "Could not open " << filename;
+        throw std::runtime_error( msg.str() );
+    }
+    file.read( (char*)&header_, sizeof(BinaryHeader) );
+    if( !file )
+    {
+        msg << filename << " is too small to be a binary matrix file";
+        throw std::runtime_error( msg.str() );
+    }
+    binary_io::CheckHeader( header_, binary_io::TypeCode<T>::value, filename );
+    matrix_.ResizeTo( header_.height, header_.width,
+                      std::max(Int(header_.height),Int(1)) );
+    file.read
+    ( (char*)matrix_.Buffer(),
+      std::streamsize(header_.height)*header_.width*sizeof(T) );
+    if( !file )
+    {
+        msg << filename << " is truncated";
+        throw std::runtime_error( msg.str() );
+    }
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline
+MappedMatrix<T,Int>::~MappedMatrix()
+{
+#ifdef HAVE_MMAP
+    if( map_ != 0 )
+        munmap( map_, mapSize_ );
+#endif
+}
+
+template<typename T,typename Int>
+inline const BinaryHeader&
+MappedMatrix<T,Int>::Header() const
+{ return header_; }
+
+template<typename T,typename Int>
+inline const Matrix<T,Int>&
+MappedMatrix<T,Int>::LockedMatrix() const
+{ return matrix_; }
+
+} // namespace elem
@@ -294,6 +294,9 @@ protected:
 
     template<typename S,Distribution U,Distribution V,typename Ord>
     friend class DistMatrix;
+    template<typename S,Distribution U,Distribution V,
+                        Distribution W,Distribution Z,typename Ord>
+    friend class RedistPlan;
 };
 
 } // elem
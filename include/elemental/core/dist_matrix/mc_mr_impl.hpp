@@ -1979,14 +1979,21 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,MC,STAR,Int>& A )
         const Int ALDim = A.LocalLDim();
         T* thisLocalBuffer = this->LocalBuffer();
         const Int thisLDim = this->LocalLDim();
+        // There is nothing to copy if we are a view of A's storage
+        const bool aliased =
+            ( thisLocalBuffer == &ALocalBuffer[rowShift*ALDim] &&
+              thisLDim == c*ALDim );
+        if( !aliased )
+        {
 #ifdef HAVE_OPENMP
-        #pragma omp parallel for
+            #pragma omp parallel for
 #endif
-        for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-        {
-            const T* ACol = &ALocalBuffer[(rowShift+jLocal*c)*ALDim];
-            T* thisCol = &thisLocalBuffer[jLocal*thisLDim];
-            MemCopy( thisCol, ACol, localHeight );
+            for( Int jLocal=0; jLocal<localWidth; ++jLocal )
+            {
+                const T* ACol = &ALocalBuffer[(rowShift+jLocal*c)*ALDim];
+                T* thisCol = &thisLocalBuffer[jLocal*thisLDim];
+                MemCopy( thisCol, ACol, localHeight );
+            }
         }
     }
     else
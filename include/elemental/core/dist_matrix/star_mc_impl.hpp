@@ -1808,14 +1808,21 @@ DistMatrix<T,STAR,MC,Int>::operator=( const DistMatrix<T,STAR,STAR,Int>& A )
     const Int thisLDim = this->LocalLDim();
     const T* ALocalBuffer = A.LockedLocalBuffer();
     const Int ALDim = A.LocalLDim();
+    // There is nothing to copy if we are a view of A's storage
+    const bool aliased =
+        ( thisLocalBuffer == &ALocalBuffer[rowShift*ALDim] &&
+          thisLDim == r*ALDim );
+    if( !aliased )
+    {
 #ifdef HAVE_OPENMP
-    #pragma omp parallel for
+        #pragma omp parallel for
 #endif
-    for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-    {
-        const T* ACol = &ALocalBuffer[(rowShift+jLocal*r)*ALDim];
-        T* thisCol = &thisLocalBuffer[jLocal*thisLDim];
-        MemCopy( thisCol, ACol, localHeight );
+        for( Int jLocal=0; jLocal<localWidth; ++jLocal )
+        {
+            const T* ACol = &ALocalBuffer[(rowShift+jLocal*r)*ALDim];
+            T* thisCol = &thisLocalBuffer[jLocal*thisLDim];
+            MemCopy( thisCol, ACol, localHeight );
+        }
     }
 #ifndef RELEASE
     PopCallStack();
@@ -0,0 +1,55 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+// A batch of matrices which is split into contiguous slices over the 
+// processes of a grid (in the order of their VC ranks): each matrix is owned
+// entirely by a single process, which stores its slice as a MatrixBatch.
+template<typename T,typename Int=int>
+class DistMatrixBatch
+{
+public:
+    DistMatrixBatch( const elem::Grid& g=DefaultGrid() );
+    DistMatrixBatch
+    ( Int height, Int width, Int count, const elem::Grid& g=DefaultGrid() );
+    ~DistMatrixBatch();
+
+    const elem::Grid& Grid() const;
+
+    Int Height() const;
+    Int Width() const;
+    // The number of matrices in the entire batch
+    Int Count() const;
+    // The number of matrices owned by this process
+    Int LocalCount() const;
+    // The index (in the entire batch) of the first matrix owned by this process
+    Int FirstLocalIndex() const;
+    // The VC rank of the process which owns matrix k
+    int Owner( Int k ) const;
+
+    MatrixBatch<T,Int>& LocalBatch();
+    const MatrixBatch<T,Int>& LockedLocalBatch() const;
+
+    void Empty();
+    void ResizeTo( Int height, Int width, Int count );
+
+private:
+    const elem::Grid* grid_;
+    Int height_, width_, count_;
+    MatrixBatch<T,Int> localBatch_;
+
+    Int FirstIndex( int rank ) const;
+
+    // Disable copying since a batch is typically enormous
+    const DistMatrixBatch<T,Int>& operator=( const DistMatrixBatch<T,Int>& );
+    DistMatrixBatch( const DistMatrixBatch<T,Int>& );
+};
+
+} // namespace elem
@@ -0,0 +1,128 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+template<typename T,typename Int>
+inline
+DistMatrixBatch<T,Int>::DistMatrixBatch( const elem::Grid& g )
+: grid_(&g), height_(0), width_(0), count_(0), localBatch_()
+{ }
+
+template<typename T,typename Int>
+inline
+DistMatrixBatch<T,Int>::DistMatrixBatch
+( Int height, Int width, Int count, const elem::Grid& g )
+: grid_(&g), height_(0), width_(0), count_(0), localBatch_()
+{ ResizeTo( height, width, count ); }
+
+template<typename T,typename Int>
+inline
+DistMatrixBatch<T,Int>::~DistMatrixBatch()
+{ }
+
+template<typename T,typename Int>
+inline const elem::Grid&
+DistMatrixBatch<T,Int>::Grid() const
+{ return *grid_; }
+
+template<typename T,typename Int>
+inline Int
+DistMatrixBatch<T,Int>::Height() const
+{ return height_; }
+
+template<typename T,typename Int>
+inline Int
+DistMatrixBatch<T,Int>::Width() const
+{ return width_; }
+
+template<typename T,typename Int>
+inline Int
+DistMatrixBatch<T,Int>::Count() const
+{ return count_; }
+
+template<typename T,typename Int>
+inline Int
+DistMatrixBatch<T,Int>::LocalCount() const
+{ return localBatch_.Count(); }
+
+template<typename T,typename Int>
+inline Int
+DistMatrixBatch<T,Int>::FirstIndex( int rank ) const
+{
+    const int p = grid_->Size();
+    const Int q = count_ / p;
+    const Int r = count_ % p;
+    return rank*q + std::min(Int(rank),r);
+}
+
+template<typename T,typename Int>
+inline Int
+DistMatrixBatch<T,Int>::FirstLocalIndex() const
+{ return FirstIndex( grid_->VCRank() ); }
+
+template<typename T,typename Int>
+inline int
+DistMatrixBatch<T,Int>::Owner( Int k ) const
+{
+#ifndef RELEASE
+    PushCallStack("DistMatrixBatch::Owner");
+    if( k < 0 || k >= count_ )
+        throw std::logic_error("Batch index is out of bounds");
+    PopCallStack();
+#endif
+    const int p = grid_->Size();
+    const Int q = count_ / p;
+    const Int r = count_ % p;
+    // The first r processes own q+1 matrices and the rest own q
+    if( k < r*(q+1) )
+        return k / (q+1);
+    else
+        return r + (k-r*(q+1)) / q;
+}
+
+template<typename T,typename Int>
+inline MatrixBatch<T,Int>&
+DistMatrixBatch<T,Int>::LocalBatch()
+{ return localBatch_; }
+
+template<typename T,typename Int>
+inline const MatrixBatch<T,Int>&
+DistMatrixBatch<T,Int>::LockedLocalBatch() const
+{ return localBatch_; }
+
+template<typename T,typename Int>
+inline void
+DistMatrixBatch<T,Int>::Empty()
+{
+    localBatch_.Empty();
+    height_ = 0;
+    width_ = 0;
+    count_ = 0;
+}
+
+template<typename T,typename Int>
+inline void
+DistMatrixBatch<T,Int>::ResizeTo( Int height, Int width, Int count )
+{
+#ifndef RELEASE
+    PushCallStack("DistMatrixBatch::ResizeTo");
+#endif
+    height_ = height;
+    width_ = width;
+    count_ = count;
+    const int rank = grid_->VCRank();
+    const Int localCount = FirstIndex(rank+1) - FirstIndex(rank);
+    localBatch_.ResizeTo( height, width, localCount );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
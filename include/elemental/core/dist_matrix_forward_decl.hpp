@@ -16,4 +16,8 @@ template<typename T,Distribution ColDist=MC,Distribution RowDist=MR,
          typename Int=int>
 class DistMatrix;
 
+template<typename T,Distribution U,Distribution V,
+                    Distribution W,Distribution Z,typename Int=int>
+class RedistPlan;
+
 } // namespace elem
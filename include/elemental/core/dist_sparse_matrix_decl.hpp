@@ -0,0 +1,108 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+// A sparse matrix whose rows are distributed like those of a
+// DistMatrix<T,VC,STAR> with zero alignment: row i is owned by the process
+// with VC rank i mod p, which stores its rows in compressed sparse row (CSR)
+// format.
+//
+// Entries are queued with Update (which may only refer to locally owned rows)
+// and MakeConsistent then sorts them, sums any duplicates, and forms the CSR
+// arrays. Since MakeConsistent is collective, it also plans the communication
+// for products with a DistMatrix<T,VC,STAR>: the rows of the input which are
+// referenced by each process's entries (its "ghost" rows) are determined once
+// so that every subsequent product only requires a single AllToAll.
+template<typename T,typename Int=int>
+class DistSparseMatrix
+{
+public:
+    DistSparseMatrix( const elem::Grid& g=DefaultGrid() );
+    DistSparseMatrix
+    ( Int height, Int width, const elem::Grid& g=DefaultGrid() );
+    ~DistSparseMatrix();
+
+    const elem::Grid& Grid() const;
+    Int Height() const;
+    Int Width() const;
+
+    // Row i is owned by the process with VC rank i mod ColStride(), and local
+    // row iLocal corresponds to the global row ColShift() + iLocal*ColStride()
+    Int ColShift() const;
+    Int ColStride() const;
+    Int LocalHeight() const;
+    Int GlobalRow( Int iLocal ) const;
+
+    void Empty();
+    void ResizeTo( Int height, Int width );
+
+    //
+    // Assembly
+    //
+
+    void Reserve( Int numLocalEntries );
+    // Queue A(i,j) += value, where row i must be owned by this process
+    void Update( Int i, Int j, T value );
+    // Collectively form the CSR arrays and the communication plan
+    void MakeConsistent();
+    bool Consistent() const;
+
+    //
+    // Local CSR access (only valid after MakeConsistent)
+    //
+
+    Int NumLocalEntries() const;
+    // The entries of local row iLocal are those in
+    // [LocalEntryOffset(iLocal),LocalEntryOffset(iLocal+1))
+    Int LocalEntryOffset( Int iLocal ) const;
+    Int NumConnections( Int iLocal ) const;
+    Int Col( Int localEntry ) const;
+    T Value( Int localEntry ) const;
+
+    const Int* LockedOffsetBuffer() const;
+    const Int* LockedColBuffer() const;
+    const T* LockedValueBuffer() const;
+
+    //
+    // Communication plan (only valid after MakeConsistent)
+    //
+
+    Int NumGhosts() const;
+    // The index of the column of a local entry within the ghost rows
+    Int GhostIndex( Int localEntry ) const;
+    const Int* LockedGhostIndexBuffer() const;
+
+    // Form the transpose of the ghost rows of X, so that column g of 
+    // XGhostTrans holds the row of X corresponding to the g'th ghost
+    void GatherGhosts
+    ( const DistMatrix<T,VC,STAR,Int>& X, Matrix<T,Int>& XGhostTrans ) const;
+
+private:
+    const elem::Grid* grid_;
+    Int height_, width_;
+    bool consistent_;
+
+    std::vector<Int> rows_, cols_;
+    std::vector<T> values_;
+    std::vector<Int> offsets_, ghostIndices_;
+
+    // The number of ghost rows requested from each process, and the local
+    // indices of the rows of X requested by each process
+    std::vector<int> recvSizes_, recvOffsets_, sendSizes_, sendOffsets_;
+    std::vector<Int> sendIndices_;
+
+    void FormPlan();
+
+    // Disable copying since the matrix is typically enormous
+    const DistSparseMatrix<T,Int>& operator=( const DistSparseMatrix<T,Int>& );
+    DistSparseMatrix( const DistSparseMatrix<T,Int>& );
+};
+
+} // namespace elem
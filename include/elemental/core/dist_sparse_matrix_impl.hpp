@@ -0,0 +1,385 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+namespace dist_sparse_matrix {
+
+template<typename T,typename Int>
+struct Triplet
+{
+    Int i, j;
+    T value;
+};
+
+template<typename T,typename Int>
+inline bool
+CompareTriplets( const Triplet<T,Int>& a, const Triplet<T,Int>& b )
+{ return a.i < b.i || (a.i == b.i && a.j < b.j); }
+
+// Order the ghost columns by their owning process and then by index
+template<typename Int>
+struct GhostOrder
+{
+    Int p;
+    GhostOrder( Int stride ) : p(stride) { }
+    bool operator()( Int a, Int b ) const
+    { return a % p < b % p || (a % p == b % p && a < b); }
+};
+
+} // namespace dist_sparse_matrix
+
+template<typename T,typename Int>
+inline
+DistSparseMatrix<T,Int>::DistSparseMatrix( const elem::Grid& g )
+: grid_(&g), height_(0), width_(0), consistent_(true)
+{ Empty(); }
+
+template<typename T,typename Int>
+inline
+DistSparseMatrix<T,Int>::DistSparseMatrix
+( Int height, Int width, const elem::Grid& g )
+: grid_(&g), height_(0), width_(0), consistent_(true)
+{ ResizeTo( height, width ); }
+
+template<typename T,typename Int>
+inline
+DistSparseMatrix<T,Int>::~DistSparseMatrix()
+{ }
+
+template<typename T,typename Int>
+inline const elem::Grid&
+DistSparseMatrix<T,Int>::Grid() const
+{ return *grid_; }
+
+template<typename T,typename Int>
+inline Int
+DistSparseMatrix<T,Int>::Height() const
+{ return height_; }
+
+template<typename T,typename Int>
+inline Int
+DistSparseMatrix<T,Int>::Width() const
+{ return width_; }
+
+template<typename T,typename Int>
+inline Int
+DistSparseMatrix<T,Int>::ColShift() const
+{ return grid_->VCRank(); }
+
+template<typename T,typename Int>
+inline Int
+DistSparseMatrix<T,Int>::ColStride() const
+{ return grid_->Size(); }
+
+template<typename T,typename Int>
+inline Int
+DistSparseMatrix<T,Int>::LocalHeight() const
+{ return LocalLength<Int>( height_, ColShift(), ColStride() ); }
+
+template<typename T,typename Int>
+inline Int
+DistSparseMatrix<T,Int>::GlobalRow( Int iLocal ) const
+{ return ColShift() + iLocal*ColStride(); }
+
+template<typename T,typename Int>
+inline void
+DistSparseMatrix<T,Int>::Empty()
+{
+    height_ = 0;
+    width_ = 0;
+    rows_.clear();
+    cols_.clear();
+    values_.clear();
+    offsets_.assign( 1, 0 );
+    consistent_ = true;
+
+    // An empty matrix does not reference any rows of X
+    const int p = grid_->Size();
+    ghostIndices_.clear();
+    recvSizes_.assign( p, 0 );
+    recvOffsets_.assign( p, 0 );
+    sendSizes_.assign( p, 0 );
+    sendOffsets_.assign( p, 0 );
+    sendIndices_.clear();
+}
+
+template<typename T,typename Int>
+inline void
+DistSparseMatrix<T,Int>::ResizeTo( Int height, Int width )
+{
+#ifndef RELEASE
+    PushCallStack("DistSparseMatrix::ResizeTo");
+    if( height < 0 || width < 0 )
+        throw std::logic_error("Height and width must be non-negative");
+#endif
+    Empty();
+    height_ = height;
+    width_ = width;
+    offsets_.assign( LocalHeight()+1, 0 );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+DistSparseMatrix<T,Int>::Reserve( Int numLocalEntries )
+{
+    rows_.reserve( numLocalEntries );
+    cols_.reserve( numLocalEntries );
+    values_.reserve( numLocalEntries );
+}
+
+template<typename T,typename Int>
+inline void
+DistSparseMatrix<T,Int>::Update( Int i, Int j, T value )
+{
+#ifndef RELEASE
+    PushCallStack("DistSparseMatrix::Update");
+    if( i < 0 || i >= height_ || j < 0 || j >= width_ )
+        throw std::logic_error("Entry is out of bounds");
+    if( i % ColStride() != ColShift() )
+        throw std::logic_error("Row is not owned by this process");
+    PopCallStack();
+#endif
+    rows_.push_back( (i-ColShift()) / ColStride() );
+    cols_.push_back( j );
+    values_.push_back( value );
+    consistent_ = false;
+}
+
+template<typename T,typename Int>
+inline void
+DistSparseMatrix<T,Int>::MakeConsistent()
+{
+#ifndef RELEASE
+    PushCallStack("DistSparseMatrix::MakeConsistent");
+#endif
+    typedef dist_sparse_matrix::Triplet<T,Int> Triplet;
+
+    // Sort the local entries and sum any duplicates
+    const Int numQueued = rows_.size();
+    std::vector<Triplet> triplets( numQueued );
+    for( Int k=0; k<numQueued; ++k )
+    {
+        triplets[k].i = rows_[k];
+        triplets[k].j = cols_[k];
+        triplets[k].value = values_[k];
+    }
+    std::sort
+    ( triplets.begin(), triplets.end(),
+      dist_sparse_matrix::CompareTriplets<T,Int> );
+    Int numEntries = 0;
+    for( Int k=0; k<numQueued; ++k )
+    {
+        if( numEntries > 0 && triplets[k].i == triplets[numEntries-1].i &&
+                              triplets[k].j == triplets[numEntries-1].j )
+            triplets[numEntries-1].value += triplets[k].value;
+        else
+            triplets[numEntries++] = triplets[k];
+    }
+    rows_.resize( numEntries );
+    cols_.resize( numEntries );
+    values_.resize( numEntries );
+    for( Int k=0; k<numEntries; ++k )
+    {
+        rows_[k] = triplets[k].i;
+        cols_[k] = triplets[k].j;
+        values_[k] = triplets[k].value;
+    }
+
+    // Form the row offsets
+    const Int localHeight = LocalHeight();
+    offsets_.assign( localHeight+1, 0 );
+    for( Int k=0; k<numEntries; ++k )
+        ++offsets_[rows_[k]+1];
+    for( Int iLocal=0; iLocal<localHeight; ++iLocal )
+        offsets_[iLocal+1] += offsets_[iLocal];
+
+    FormPlan();
+    consistent_ = true;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline bool
+DistSparseMatrix<T,Int>::Consistent() const
+{ return consistent_; }
+
+template<typename T,typename Int>
+inline Int
+DistSparseMatrix<T,Int>::NumLocalEntries() const
+{ return cols_.size(); }
+
+template<typename T,typename Int>
+inline Int
+DistSparseMatrix<T,Int>::LocalEntryOffset( Int iLocal ) const
+{ return offsets_[iLocal]; }
+
+template<typename T,typename Int>
+inline Int
+DistSparseMatrix<T,Int>::NumConnections( Int iLocal ) const
+{ return offsets_[iLocal+1] - offsets_[iLocal]; }
+
+template<typename T,typename Int>
+inline Int
+DistSparseMatrix<T,Int>::Col( Int localEntry ) const
+{ return cols_[localEntry]; }
+
+template<typename T,typename Int>
+inline T
+DistSparseMatrix<T,Int>::Value( Int localEntry ) const
+{ return values_[localEntry]; }
+
+template<typename T,typename Int>
+inline const Int*
+DistSparseMatrix<T,Int>::LockedOffsetBuffer() const
+{ return &offsets_[0]; }
+
+template<typename T,typename Int>
+inline const Int*
+DistSparseMatrix<T,Int>::LockedColBuffer() const
+{ return ( cols_.size() ? &cols_[0] : 0 ); }
+
+template<typename T,typename Int>
+inline const T*
+DistSparseMatrix<T,Int>::LockedValueBuffer() const
+{ return ( values_.size() ? &values_[0] : 0 ); }
+
+template<typename T,typename Int>
+inline Int
+DistSparseMatrix<T,Int>::NumGhosts() const
+{ return recvOffsets_.back() + recvSizes_.back(); }
+
+template<typename T,typename Int>
+inline Int
+DistSparseMatrix<T,Int>::GhostIndex( Int localEntry ) const
+{ return ghostIndices_[localEntry]; }
+
+template<typename T,typename Int>
+inline const Int*
+DistSparseMatrix<T,Int>::LockedGhostIndexBuffer() const
+{ return ( ghostIndices_.size() ? &ghostIndices_[0] : 0 ); }
+
+template<typename T,typename Int>
+inline void
+DistSparseMatrix<T,Int>::FormPlan()
+{
+#ifndef RELEASE
+    PushCallStack("DistSparseMatrix::FormPlan");
+#endif
+    const int p = grid_->Size();
+    mpi::Comm comm = grid_->VCComm();
+
+    // Find the distinct columns referenced by our entries, ordered first by
+    // the process which owns the corresponding row of X
+    std::vector<Int> ghosts( cols_ );
+    std::sort( ghosts.begin(), ghosts.end() );
+    ghosts.erase( std::unique( ghosts.begin(), ghosts.end() ), ghosts.end() );
+    dist_sparse_matrix::GhostOrder<Int> order( p );
+    std::sort( ghosts.begin(), ghosts.end(), order );
+    const Int numGhosts = ghosts.size();
+
+    recvSizes_.assign( p, 0 );
+    recvOffsets_.resize( p );
+    for( Int g=0; g<numGhosts; ++g )
+        ++recvSizes_[ghosts[g] % p];
+    for( int q=0, offset=0; q<p; offset+=recvSizes_[q], ++q )
+        recvOffsets_[q] = offset;
+
+    const Int numEntries = cols_.size();
+    ghostIndices_.resize( numEntries );
+    for( Int k=0; k<numEntries; ++k )
+        ghostIndices_[k] =
+            std::lower_bound
+            ( ghosts.begin(), ghosts.end(), cols_[k], order ) - ghosts.begin();
+
+    // Tell each process which of its rows of X we require
+    sendSizes_.resize( p );
+    sendOffsets_.resize( p );
+    mpi::AllToAll( &recvSizes_[0], 1, &sendSizes_[0], 1, comm );
+    int totalSend = 0;
+    for( int q=0; q<p; totalSend+=sendSizes_[q], ++q )
+        sendOffsets_[q] = totalSend;
+    std::vector<int> requests( std::max(numGhosts,Int(1)) ),
+                     requested( std::max(totalSend,1) );
+    for( Int g=0; g<numGhosts; ++g )
+        requests[g] = ghosts[g] / p;
+    mpi::AllToAll
+    ( &requests[0], &recvSizes_[0], &recvOffsets_[0],
+      &requested[0], &sendSizes_[0], &sendOffsets_[0], comm );
+    sendIndices_.resize( totalSend );
+    for( int s=0; s<totalSend; ++s )
+        sendIndices_[s] = requested[s];
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+DistSparseMatrix<T,Int>::GatherGhosts
+( const DistMatrix<T,VC,STAR,Int>& X, Matrix<T,Int>& XGhostTrans ) const
+{
+#ifndef RELEASE
+    PushCallStack("DistSparseMatrix::GatherGhosts");
+    if( !consistent_ )
+        throw std::logic_error("MakeConsistent must be called first");
+    if( X.Height() != width_ )
+        throw std::logic_error("X must have as many rows as A has columns");
+    if( X.Grid() != *grid_ )
+        throw std::logic_error("X must be distributed over the same grid");
+    if( X.ColAlignment() != 0 )
+        throw std::logic_error("X must have a column alignment of zero");
+#endif
+    const int p = grid_->Size();
+    const Int width = X.Width();
+    const Int totalSend = sendIndices_.size();
+
+    // Pack the requested rows of X (each row contiguously)
+    std::vector<T> sendBuffer( std::max(totalSend*width,Int(1)) );
+    const T* XLocalBuffer = X.LockedLocalBuffer();
+    const Int XLDim = X.LocalLDim();
+    for( Int s=0; s<totalSend; ++s )
+    {
+        const Int iLocal = sendIndices_[s];
+        for( Int j=0; j<width; ++j )
+            sendBuffer[s*width+j] = XLocalBuffer[iLocal+j*XLDim];
+    }
+
+    // Exchange them directly into the transposed ghost rows
+    std::vector<int> sendSizes(p), sendOffsets(p), recvSizes(p), recvOffsets(p);
+    for( int q=0; q<p; ++q )
+    {
+        sendSizes[q] = sendSizes_[q]*width;
+        sendOffsets[q] = sendOffsets_[q]*width;
+        recvSizes[q] = recvSizes_[q]*width;
+        recvOffsets[q] = recvOffsets_[q]*width;
+    }
+    const Int numGhosts = NumGhosts();
+    XGhostTrans.ResizeTo( width, numGhosts, std::max(width,Int(1)) );
+    std::vector<T> recvBuffer;
+    T* recvPtr = XGhostTrans.Buffer();
+    if( numGhosts == 0 || width == 0 )
+    {
+        recvBuffer.resize( 1 );
+        recvPtr = &recvBuffer[0];
+    }
+    mpi::AllToAll
+    ( &sendBuffer[0], &sendSizes[0], &sendOffsets[0],
+      recvPtr, &recvSizes[0], &recvOffsets[0], grid_->VCComm() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
@@ -0,0 +1,53 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+namespace internal {
+
+// Splits a communicator into 'depth' layers of consecutive ranks. This is a
+// base class of Grid3D so that the communicator for each layer exists before
+// the Grid describing that layer is constructed.
+class DepthSplit
+{
+protected:
+    DepthSplit( mpi::Comm comm, int depth );
+    ~DepthSplit();
+
+    int depth_, depthRank_;
+    mpi::Comm meshComm_, depthComm_;
+};
+
+} // namespace internal
+
+// A three-dimensional process grid formed from 'depth' layers, each of which
+// is a two-dimensional grid (or 'mesh') of consecutive ranks of the
+// communicator. The Grid base class describes the layer of the calling
+// process, so a DistMatrix over a Grid3D is replicated across the layers:
+// each layer holds a full copy of the matrix, and routines which are unaware
+// of the third dimension operate on each copy redundantly.
+class Grid3D : private internal::DepthSplit, public Grid
+{
+public:
+    Grid3D( mpi::Comm comm, int depth );
+    Grid3D( mpi::Comm comm, int height, int width, int depth );
+    ~Grid3D();
+
+    int Depth() const;          // number of layers
+    int DepthRank() const;      // layer of this process
+    mpi::Comm DepthComm() const; // processes with the same position in a layer
+    mpi::Comm MeshComm() const;  // processes in the same layer
+
+private:
+    // Disable copying this class due to MPI_Comm ownership issues
+    const Grid3D& operator=( Grid3D& );
+    Grid3D( const Grid3D& );
+};
+
+} // namespace elem
@@ -0,0 +1,88 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+namespace internal {
+
+inline
+DepthSplit::DepthSplit( mpi::Comm comm, int depth )
+: depth_(depth)
+{
+#ifndef RELEASE
+    PushCallStack("DepthSplit::DepthSplit");
+#endif
+    const int rank = mpi::CommRank( comm );
+    const int size = mpi::CommSize( comm );
+    if( depth <= 0 || size % depth != 0 )
+        throw std::logic_error
+        ("Grid depth must be a positive divisor of the number of processes");
+    const int meshSize = size / depth;
+
+    depthRank_ = rank / meshSize;
+    mpi::CommSplit( comm, depthRank_, rank % meshSize, meshComm_ );
+    mpi::CommSplit( comm, rank % meshSize, depthRank_, depthComm_ );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+inline
+DepthSplit::~DepthSplit()
+{
+    if( !mpi::Finalized() )
+    {
+        mpi::CommFree( meshComm_ );
+        mpi::CommFree( depthComm_ );
+    }
+}
+
+} // namespace internal
+
+inline
+Grid3D::Grid3D( mpi::Comm comm, int depth )
+: internal::DepthSplit( comm, depth ), Grid( meshComm_ )
+{ }
+
+inline
+Grid3D::Grid3D( mpi::Comm comm, int height, int width, int depth )
+: internal::DepthSplit( comm, depth ), Grid( meshComm_, height, width )
+{
+#ifndef RELEASE
+    PushCallStack("Grid3D::Grid3D");
+#endif
+    if( height*width*depth != mpi::CommSize( comm ) )
+        throw std::logic_error
+        ("Height, width, and depth of grid do not match number of processes");
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+inline
+Grid3D::~Grid3D()
+{ }
+
+inline int
+Grid3D::Depth() const
+{ return depth_; }
+
+inline int
+Grid3D::DepthRank() const
+{ return depthRank_; }
+
+inline mpi::Comm
+Grid3D::DepthComm() const
+{ return depthComm_; }
+
+inline mpi::Comm
+Grid3D::MeshComm() const
+{ return meshComm_; }
+
+} // namespace elem
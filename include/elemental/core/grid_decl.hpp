@@ -15,7 +15,7 @@ class Grid
 public:
     Grid( mpi::Comm comm=mpi::COMM_WORLD );
     Grid( mpi::Comm comm, int height, int width );
-    ~Grid();
+    virtual ~Grid();
 
     // Simple interface (simpler version of distributed-based interface)
     int Row() const;           // same as MCRank()
@@ -175,7 +175,6 @@ Grid::SetUpGrid()
         vectorColRank_ = mpi::UNDEFINED;
         vectorRowRank_ = mpi::UNDEFINED;
     }
-    mpi::Broadcast( &diagPathsAndRanks_[0], 2*size_, 0, viewingComm_ );
 
     // Set up the map from the VC group to the viewingGroup_ ranks.
     // Since the VC communicator preserves the ordering of the owningGroup_
@@ -187,6 +186,12 @@ Grid::SetUpGrid()
     mpi::GroupTranslateRanks
     ( owningGroup_, size_, &ranks[0], viewingGroup_, 
       &vectorColToViewingMap_[0] );
+
+    // Viewing rank 0 need not be a member of the grid, so the diagonal path 
+    // information must be broadcast from the root of the owning group
+    mpi::Broadcast
+    ( &diagPathsAndRanks_[0], 2*size_, vectorColToViewingMap_[0], 
+      viewingComm_ );
 #ifndef RELEASE
     PopCallStack();
 #endif
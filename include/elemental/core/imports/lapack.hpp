@@ -158,5 +158,48 @@ void HessenbergEig( int n, double* H, int ldh, dcomplex* w );
 void HessenbergEig( int n, scomplex* H, int ldh, scomplex* w );
 void HessenbergEig( int n, dcomplex* H, int ldh, dcomplex* w );
 
+//
+// Compute selected eigenpairs (or eigenvalues, if jobz='N') of a Hermitian 
+// matrix using MRRR. The range may be 'A' (all), 'V' (eigenvalues in the 
+// half-open interval (vl,vu]), or 'I' (the one-based, inclusive index range 
+// il,...,iu). The number of computed eigenvalues is returned.
+//
+
+int HermitianEig
+( char jobz, char range, char uplo, int n, float* A, int lda, 
+  float vl, float vu, int il, int iu, float abstol, 
+  float* w, float* Z, int ldz );
+int HermitianEig
+( char jobz, char range, char uplo, int n, double* A, int lda, 
+  double vl, double vu, int il, int iu, double abstol, 
+  double* w, double* Z, int ldz );
+int HermitianEig
+( char jobz, char range, char uplo, int n, scomplex* A, int lda, 
+  float vl, float vu, int il, int iu, float abstol, 
+  float* w, scomplex* Z, int ldz );
+int HermitianEig
+( char jobz, char range, char uplo, int n, dcomplex* A, int lda, 
+  double vl, double vu, int il, int iu, double abstol, 
+  double* w, dcomplex* Z, int ldz );
+
+//
+// Cholesky factorization of a Hermitian positive-definite matrix
+//
+
+void Cholesky( char uplo, int n, float* A, int lda );
+void Cholesky( char uplo, int n, double* A, int lda );
+void Cholesky( char uplo, int n, scomplex* A, int lda );
+void Cholesky( char uplo, int n, dcomplex* A, int lda );
+
+//
+// LU factorization with partial pivoting, where p[j] is the (zero-based) 
+// index of the row which was swapped with row j
+//
+
+void LU( int m, int n, float* A, int lda, int* p );
+void LU( int m, int n, double* A, int lda, int* p );
+void LU( int m, int n, scomplex* A, int lda, int* p );
+void LU( int m, int n, dcomplex* A, int lda, int* p );
+
 } // namespace lapack
 } // namespace elem
@@ -13,6 +13,7 @@ namespace mpi {
 #if defined(HAVE_MPI3_NONBLOCKING_COLLECTIVES) || \
     defined(HAVE_MPIX_NONBLOCKING_COLLECTIVES)
 #define HAVE_NONBLOCKING 1
+#define HAVE_NONBLOCKING_COLLECTIVES
 #else
 #define HAVE_NONBLOCKING 0
 #endif
@@ -26,10 +27,13 @@ namespace mpi {
 #endif
 
 // Datatype definitions
+typedef MPI_Aint Aint;
 typedef MPI_Comm Comm;
 typedef MPI_Datatype Datatype;
 typedef MPI_Errhandler ErrorHandler;
+typedef MPI_File File;
 typedef MPI_Group Group;
+typedef MPI_Offset Offset;
 typedef MPI_Op Op;
 typedef MPI_Request Request;
 typedef MPI_Status Status;
@@ -48,6 +52,11 @@ const Comm COMM_WORLD = MPI_COMM_WORLD;
 const ErrorHandler ERRORS_RETURN = MPI_ERRORS_RETURN;
 const ErrorHandler ERRORS_ARE_FATAL = MPI_ERRORS_ARE_FATAL;
 const Group GROUP_EMPTY = MPI_GROUP_EMPTY;
+const Datatype BYTE = MPI_BYTE;
+const int MODE_RDONLY = MPI_MODE_RDONLY;
+const int MODE_WRONLY = MPI_MODE_WRONLY;
+const int MODE_RDWR = MPI_MODE_RDWR;
+const int MODE_CREATE = MPI_MODE_CREATE;
 const Request REQUEST_NULL = MPI_REQUEST_NULL;
 const Op MAX = MPI_MAX;
 const Op MIN = MPI_MIN;
@@ -200,6 +209,44 @@ void SendRecv
 ( const dcomplex* sbuf, int sc, int to,   int stag,
         dcomplex* rbuf, int rc, int from, int rtag, Comm comm );
 
+// Persistent point-to-point communication
+
+void SendInit
+( const byte* buf, int count, int to, int tag, Comm comm, 
+  Request& request );
+void SendInit
+( const int* buf, int count, int to, int tag, Comm comm, 
+  Request& request );
+void SendInit
+( const float* buf, int count, int to, int tag, Comm comm, 
+  Request& request );
+void SendInit
+( const double* buf, int count, int to, int tag, Comm comm, 
+  Request& request );
+void SendInit
+( const scomplex* buf, int count, int to, int tag, Comm comm, 
+  Request& request );
+void SendInit
+( const dcomplex* buf, int count, int to, int tag, Comm comm, 
+  Request& request );
+
+void RecvInit
+( byte* buf, int count, int from, int tag, Comm comm, Request& request );
+void RecvInit
+( int* buf, int count, int from, int tag, Comm comm, Request& request );
+void RecvInit
+( float* buf, int count, int from, int tag, Comm comm, Request& request );
+void RecvInit
+( double* buf, int count, int from, int tag, Comm comm, Request& request );
+void RecvInit
+( scomplex* buf, int count, int from, int tag, Comm comm, Request& request );
+void RecvInit
+( dcomplex* buf, int count, int from, int tag, Comm comm, Request& request );
+
+void Start( Request& request );
+void StartAll( int numRequests, Request* requests );
+void RequestFree( Request& request );
+
 // Collective communication
 
 void Broadcast( byte* buf, int count, int root, Comm comm );
@@ -667,5 +714,33 @@ void IReduceScatter
   Op op, Comm comm, Request& request );
 #endif
 
+// Derived datatypes
+void TypeContiguous( int count, Datatype oldType, Datatype& newType );
+void TypeVector
+( int count, int blocklength, int stride, Datatype oldType, 
+  Datatype& newType );
+void TypeHVector
+( int count, int blocklength, Aint stride, Datatype oldType, 
+  Datatype& newType );
+void TypeCommit( Datatype& type );
+void TypeFree( Datatype& type );
+
+// Parallel file I/O (a std::runtime_error is thrown if a file cannot be 
+// opened, even in RELEASE mode)
+void FileOpen( Comm comm, const std::string filename, int amode, File& fh );
+void FileClose( File& fh );
+void FileSetSize( File fh, Offset size );
+void FileSetView( File fh, Offset disp, Datatype etype, Datatype filetype );
+void FileWriteAt( File fh, Offset offset, const byte* buf, int count );
+void FileReadAt( File fh, Offset offset, byte* buf, int count );
+void FileWriteAll( File fh, const byte* buf, int count, Datatype type );
+void FileReadAll( File fh, byte* buf, int count, Datatype type );
+void FileIWriteAt
+( File fh, Offset offset, const byte* buf, int count, Datatype type, 
+  Request& request );
+void FileIReadAt
+( File fh, Offset offset, byte* buf, int count, Datatype type, 
+  Request& request );
+
 } // mpi
 } // elem
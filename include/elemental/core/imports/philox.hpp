@@ -0,0 +1,79 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+// The counter-based Philox4x32-10 generator of Salmon et al., "Parallel
+// random numbers: as easy as 1, 2, 3" (SC11). Unlike the parallel LCG, each
+// output is a pure function of a 128-bit counter and a 64-bit key, so that
+// any process (or thread) can directly compute the sample associated with
+// any counter without communication or shared state.
+namespace philox {
+
+// As in the parallel LCG, we avoid relying upon 64-bit integers
+typedef unsigned UInt32;
+struct Counter
+{
+    UInt32 d[4];
+    UInt32& operator[]( int i ) { return d[i]; }
+    const UInt32& operator[]( int i ) const { return d[i]; }
+};
+struct Key
+{
+    UInt32 d[2];
+    UInt32& operator[]( int i ) { return d[i]; }
+    const UInt32& operator[]( int i ) const { return d[i]; }
+};
+
+// Form the upper and lower 32 bits of the 64-bit product a b
+void MulHiLo( UInt32 a, UInt32 b, UInt32& hi, UInt32& lo );
+
+Counter Philox4x32( Counter counter, Key key );
+
+//----------------------------------------------------------------------------//
+// Header implementations                                                     //
+//----------------------------------------------------------------------------//
+
+// a = 2^16 a1 + a0 and b = 2^16 b1 + b0, where a_j, b_j < 2^16, so that
+// a b = 2^32 ( a1 b1 ) + 2^16 ( a1 b0 + a0 b1 ) + a0 b0
+inline void
+MulHiLo( UInt32 a, UInt32 b, UInt32& hi, UInt32& lo )
+{
+    const UInt32 a0 = a & 0xFFFF, a1 = (a >> 16) & 0xFFFF;
+    const UInt32 b0 = b & 0xFFFF, b1 = (b >> 16) & 0xFFFF;
+    const UInt32 p00 = a0*b0;
+    const UInt32 p01 = a0*b1;
+    const UInt32 p10 = a1*b0;
+    const UInt32 p11 = a1*b1;
+    const UInt32 middle = (p00 >> 16) + (p01 & 0xFFFF) + (p10 & 0xFFFF);
+    hi = p11 + (p01 >> 16) + (p10 >> 16) + (middle >> 16);
+    lo = a*b;
+}
+
+inline Counter
+Philox4x32( Counter counter, Key key )
+{
+    const UInt32 multiplier0 = 0xD2511F53U, multiplier1 = 0xCD9E8D57U;
+    const UInt32 weyl0 = 0x9E3779B9U, weyl1 = 0xBB67AE85U;
+    for( int round=0; round<10; ++round )
+    {
+        UInt32 hi0, lo0, hi1, lo1;
+        MulHiLo( multiplier0, counter[0], hi0, lo0 );
+        MulHiLo( multiplier1, counter[2], hi1, lo1 );
+        Counter next;
+        next[0] = hi1 ^ counter[1] ^ key[0];
+        next[1] = lo1;
+        next[2] = hi0 ^ counter[3] ^ key[1];
+        next[3] = lo0;
+        counter = next;
+        key[0] += weyl0;
+        key[1] += weyl1;
+    }
+    return counter;
+}
+
+} // namespace philox
@@ -0,0 +1,97 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+// A batch of 'count' matrices of the same dimensions stored in a single 
+// buffer: entry (i,j) of matrix k is stored at buffer[i+j*ldim+k*stride]. 
+// Each matrix is column-major, so any one of them may be viewed as a Matrix.
+template<typename T,typename Int=int>
+class MatrixBatch
+{
+public:
+    //
+    // Constructors
+    //
+
+    MatrixBatch();
+    MatrixBatch( Int height, Int width, Int count );
+    MatrixBatch( Int height, Int width, Int count, Int ldim, Int stride );
+    MatrixBatch
+    ( Int height, Int width, Int count, 
+      const T* buffer, Int ldim, Int stride );
+    MatrixBatch
+    ( Int height, Int width, Int count, T* buffer, Int ldim, Int stride );
+
+    ~MatrixBatch();
+
+    //
+    // Basic information
+    //
+
+    Int Height() const;
+    Int Width() const;
+    Int Count() const;
+    Int LDim() const;
+    Int Stride() const;
+
+    T* Buffer();
+    T* Buffer( Int k );
+    const T* LockedBuffer() const;
+    const T* LockedBuffer( Int k ) const;
+
+    //
+    // Entry manipulation
+    //
+
+    T Get( Int i, Int j, Int k ) const;
+    void Set( Int i, Int j, Int k, T alpha );
+    void Update( Int i, Int j, Int k, T alpha );
+
+    //
+    // Viewing other buffers
+    //
+
+    bool Viewing() const;
+    bool LockedView() const;
+
+    void Attach
+    ( Int height, Int width, Int count, T* buffer, Int ldim, Int stride );
+    void LockedAttach
+    ( Int height, Int width, Int count, 
+      const T* buffer, Int ldim, Int stride );
+
+    //
+    // Utilities
+    //
+
+    void Empty();
+    void ResizeTo( Int height, Int width, Int count );
+
+private:
+    bool viewing_, lockedView_;
+    Int height_, width_, count_, ldim_, stride_;
+    T* data_;
+    const T* lockedData_;
+    Memory<T> memory_;
+
+    void AssertValidEntry( Int i, Int j, Int k ) const;
+
+    // Disable copying since a batch is typically enormous
+    const MatrixBatch<T,Int>& operator=( const MatrixBatch<T,Int>& );
+    MatrixBatch( const MatrixBatch<T,Int>& );
+};
+
+// View (or lock) the k'th matrix of a batch
+template<typename T,typename Int>
+void View( Matrix<T,Int>& A, MatrixBatch<T,Int>& batch, Int k );
+template<typename T,typename Int>
+void LockedView( Matrix<T,Int>& A, const MatrixBatch<T,Int>& batch, Int k );
+
+} // namespace elem
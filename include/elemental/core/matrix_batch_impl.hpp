@@ -0,0 +1,393 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+//
+// Constructors
+//
+
+template<typename T,typename Int>
+inline
+MatrixBatch<T,Int>::MatrixBatch()
+: viewing_(false), lockedView_(false),
+  height_(0), width_(0), count_(0), ldim_(1), stride_(0), 
+  data_(0), lockedData_(0), memory_()
+{ }
+
+template<typename T,typename Int>
+inline
+MatrixBatch<T,Int>::MatrixBatch( Int height, Int width, Int count )
+: viewing_(false), lockedView_(false),
+  height_(0), width_(0), count_(0), ldim_(1), stride_(0), 
+  data_(0), lockedData_(0), memory_()
+{
+#ifndef RELEASE
+    PushCallStack("MatrixBatch::MatrixBatch");
+#endif
+    ResizeTo( height, width, count );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline
+MatrixBatch<T,Int>::MatrixBatch
+( Int height, Int width, Int count, Int ldim, Int stride )
+: viewing_(false), lockedView_(false),
+  height_(height), width_(width), count_(count), ldim_(ldim), 
+  stride_(stride), lockedData_(0)
+{
+#ifndef RELEASE
+    PushCallStack("MatrixBatch::MatrixBatch");
+    if( height < 0 || width < 0 || count < 0 )
+        throw std::logic_error("Dimensions must be non-negative");
+    if( ldim < std::max(height,Int(1)) )
+        throw std::logic_error("ldim must be at least max(height,1)");
+    if( count > 1 && stride < ldim*width )
+        throw std::logic_error("The matrices of a batch cannot overlap");
+#endif
+    memory_.Require( count == 0 ? 0 : (count-1)*stride+ldim*width );
+    data_ = memory_.Buffer();
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline
+MatrixBatch<T,Int>::MatrixBatch
+( Int height, Int width, Int count, const T* buffer, Int ldim, Int stride )
+: viewing_(true), lockedView_(true),
+  height_(height), width_(width), count_(count), ldim_(ldim), 
+  stride_(stride), data_(0), lockedData_(buffer)
+{
+#ifndef RELEASE
+    PushCallStack("MatrixBatch::MatrixBatch");
+    if( height < 0 || width < 0 || count < 0 )
+        throw std::logic_error("Dimensions must be non-negative");
+    if( ldim < std::max(height,Int(1)) )
+        throw std::logic_error("ldim must be at least max(height,1)");
+    if( count > 1 && stride < ldim*width )
+        throw std::logic_error("The matrices of a batch cannot overlap");
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline
+MatrixBatch<T,Int>::MatrixBatch
+( Int height, Int width, Int count, T* buffer, Int ldim, Int stride )
+: viewing_(true), lockedView_(false),
+  height_(height), width_(width), count_(count), ldim_(ldim), 
+  stride_(stride), data_(buffer), lockedData_(0)
+{
+#ifndef RELEASE
+    PushCallStack("MatrixBatch::MatrixBatch");
+    if( height < 0 || width < 0 || count < 0 )
+        throw std::logic_error("Dimensions must be non-negative");
+    if( ldim < std::max(height,Int(1)) )
+        throw std::logic_error("ldim must be at least max(height,1)");
+    if( count > 1 && stride < ldim*width )
+        throw std::logic_error("The matrices of a batch cannot overlap");
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline
+MatrixBatch<T,Int>::~MatrixBatch()
+{ }
+
+//
+// Basic information
+//
+
+template<typename T,typename Int>
+inline Int 
+MatrixBatch<T,Int>::Height() const
+{ return height_; }
+
+template<typename T,typename Int>
+inline Int 
+MatrixBatch<T,Int>::Width() const
+{ return width_; }
+
+template<typename T,typename Int>
+inline Int 
+MatrixBatch<T,Int>::Count() const
+{ return count_; }
+
+template<typename T,typename Int>
+inline Int 
+MatrixBatch<T,Int>::LDim() const
+{ return ldim_; }
+
+template<typename T,typename Int>
+inline Int 
+MatrixBatch<T,Int>::Stride() const
+{ return stride_; }
+
+template<typename T,typename Int>
+inline T*
+MatrixBatch<T,Int>::Buffer()
+{
+#ifndef RELEASE
+    PushCallStack("MatrixBatch::Buffer");
+    if( lockedView_ )
+        throw std::logic_error
+        ("Cannot return non-const buffer of locked MatrixBatch");
+    PopCallStack();
+#endif
+    return data_;
+}
+
+template<typename T,typename Int>
+inline T*
+MatrixBatch<T,Int>::Buffer( Int k )
+{
+#ifndef RELEASE
+    PushCallStack("MatrixBatch::Buffer");
+    if( k < 0 || k >= count_ )
+        throw std::logic_error("Batch index is out of bounds");
+    if( lockedView_ )
+        throw std::logic_error
+        ("Cannot return non-const buffer of locked MatrixBatch");
+    PopCallStack();
+#endif
+    return &data_[k*stride_];
+}
+
+template<typename T,typename Int>
+inline const T*
+MatrixBatch<T,Int>::LockedBuffer() const
+{
+    if( lockedView_ )
+        return lockedData_;
+    else
+        return data_;
+}
+
+template<typename T,typename Int>
+inline const T*
+MatrixBatch<T,Int>::LockedBuffer( Int k ) const
+{
+#ifndef RELEASE
+    PushCallStack("MatrixBatch::LockedBuffer");
+    if( k < 0 || k >= count_ )
+        throw std::logic_error("Batch index is out of bounds");
+    PopCallStack();
+#endif
+    if( lockedView_ )
+        return &lockedData_[k*stride_];
+    else
+        return &data_[k*stride_];
+}
+
+//
+// Entry manipulation
+//
+
+template<typename T,typename Int>
+inline T
+MatrixBatch<T,Int>::Get( Int i, Int j, Int k ) const
+{
+#ifndef RELEASE
+    PushCallStack("MatrixBatch::Get");
+    AssertValidEntry( i, j, k );
+    PopCallStack();
+#endif
+    if( lockedView_ )
+        return lockedData_[i+j*ldim_+k*stride_];
+    else
+        return data_[i+j*ldim_+k*stride_];
+}
+
+template<typename T,typename Int>
+inline void
+MatrixBatch<T,Int>::Set( Int i, Int j, Int k, T alpha )
+{
+#ifndef RELEASE
+    PushCallStack("MatrixBatch::Set");
+    AssertValidEntry( i, j, k );
+    if( lockedView_ )
+        throw std::logic_error("Cannot modify data of locked matrices");
+#endif
+    data_[i+j*ldim_+k*stride_] = alpha;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+MatrixBatch<T,Int>::Update( Int i, Int j, Int k, T alpha )
+{
+#ifndef RELEASE
+    PushCallStack("MatrixBatch::Update");
+    AssertValidEntry( i, j, k );
+    if( lockedView_ )
+        throw std::logic_error("Cannot modify data of locked matrices");
+#endif
+    data_[i+j*ldim_+k*stride_] += alpha;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+//
+// Viewing other buffers
+//
+
+template<typename T,typename Int>
+inline bool
+MatrixBatch<T,Int>::Viewing() const
+{ return viewing_; }
+
+template<typename T,typename Int>
+inline bool
+MatrixBatch<T,Int>::LockedView() const
+{ return lockedView_; }
+
+template<typename T,typename Int>
+inline void
+MatrixBatch<T,Int>::Attach
+( Int height, Int width, Int count, T* buffer, Int ldim, Int stride )
+{
+#ifndef RELEASE
+    PushCallStack("MatrixBatch::Attach");
+#endif
+    Empty();
+
+    height_ = height;
+    width_ = width;
+    count_ = count;
+    ldim_ = ldim;
+    stride_ = stride;
+    data_ = buffer;
+    viewing_ = true;
+    lockedView_ = false;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+MatrixBatch<T,Int>::LockedAttach
+( Int height, Int width, Int count, const T* buffer, Int ldim, Int stride )
+{
+#ifndef RELEASE
+    PushCallStack("MatrixBatch::LockedAttach");
+#endif
+    Empty();
+
+    height_ = height;
+    width_ = width;
+    count_ = count;
+    ldim_ = ldim;
+    stride_ = stride;
+    lockedData_ = buffer;
+    viewing_ = true;
+    lockedView_ = true;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+//
+// Utilities
+//
+
+template<typename T,typename Int>
+inline void
+MatrixBatch<T,Int>::Empty()
+{
+    memory_.Empty();
+    height_ = 0;
+    width_ = 0;
+    count_ = 0;
+    ldim_ = 1;
+    stride_ = 0;
+    data_ = 0;
+    lockedData_ = 0;
+    viewing_ = false;
+    lockedView_ = false;
+}
+
+// The matrices are packed contiguously
+template<typename T,typename Int>
+inline void
+MatrixBatch<T,Int>::ResizeTo( Int height, Int width, Int count )
+{
+#ifndef RELEASE
+    PushCallStack("MatrixBatch::ResizeTo");
+    if( height < 0 || width < 0 || count < 0 )
+        throw std::logic_error("Dimensions must be non-negative");
+    if( viewing_ )
+        throw std::logic_error("Cannot resize a view of a batch");
+#endif
+    height_ = height;
+    width_ = width;
+    count_ = count;
+    ldim_ = std::max( height, Int(1) );
+    stride_ = ldim_*width;
+
+    memory_.Require( count*stride_ );
+    data_ = memory_.Buffer();
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+MatrixBatch<T,Int>::AssertValidEntry( Int i, Int j, Int k ) const
+{
+    if( i < 0 || j < 0 || k < 0 )
+        throw std::logic_error("Indices must be non-negative");
+    if( i >= height_ || j >= width_ || k >= count_ )
+    {
+        std::ostringstream msg;
+        msg << "Out of bounds: "
+            << "(" << i << "," << j << "," << k << ") of " 
+            << height_ << " x " << width_ << " x " << count_ << " batch.";
+        throw std::logic_error( msg.str() );
+    }
+}
+
+template<typename T,typename Int>
+inline void
+View( Matrix<T,Int>& A, MatrixBatch<T,Int>& batch, Int k )
+{
+#ifndef RELEASE
+    PushCallStack("View");
+#endif
+    A.Attach( batch.Height(), batch.Width(), batch.Buffer(k), batch.LDim() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+LockedView( Matrix<T,Int>& A, const MatrixBatch<T,Int>& batch, Int k )
+{
+#ifndef RELEASE
+    PushCallStack("LockedView");
+#endif
+    A.LockedAttach
+    ( batch.Height(), batch.Width(), batch.LockedBuffer(k), batch.LDim() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
@@ -791,6 +791,14 @@ Matrix<T,Int>::operator=( const Matrix<T,Int>& A )
     const Int ldim = LDim();
     const Int ldimOfA = A.LDim();
     const T* data = A.LockedBuffer();
+    if( data == data_ && ldim == ldimOfA )
+    {
+        // We are a view of the same data (or vice versa)
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return *this;
+    }
 #ifdef HAVE_OPENMP
     #pragma omp parallel for
 #endif
@@ -836,8 +844,12 @@ Matrix<T,Int>::ResizeTo( Int height, Int width )
     height_ = height;
     width_ = width;
 
-    memory_.Require(ldim_*width);
-    data_ = memory_.Buffer();
+    // A view keeps pointing at the viewed data
+    if( !viewing_ )
+    {
+        memory_.Require(ldim_*width);
+        data_ = memory_.Buffer();
+    }
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -864,8 +876,11 @@ Matrix<T,Int>::ResizeTo( Int height, Int width, Int ldim )
     width_ = width;
     ldim_ = ldim;
 
-    memory_.Require(ldim*width);
-    data_ = memory_.Buffer();
+    if( !viewing_ )
+    {
+        memory_.Require(ldim*width);
+        data_ = memory_.Buffer();
+    }
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -9,6 +9,39 @@
 
 namespace elem {
 
+// All Memory instances draw their buffers from a single process-wide pool
+// of 64-byte aligned allocations which are bucketed into size classes. When
+// pooling is enabled (the default), released buffers are cached within their 
+// size class so that the repeated Require/Release pattern of the 
+// redistribution routines does not touch the system allocator.
+const std::size_t MEMORY_ALIGNMENT = 64;
+
+struct MemoryPoolStatistics
+{
+    std::size_t numAllocations; // requests served by the system allocator
+    std::size_t numReuses;      // requests served from a cached buffer
+    std::size_t bytesInUse;     // bytes currently handed out
+    std::size_t bytesCached;    // bytes held by the pool but not in use
+    std::size_t peakBytesInUse; // high-water mark of bytesInUse
+    std::size_t peakBytesHeld;  // high-water mark of bytesInUse+bytesCached
+};
+
+void SetMemoryPooling( bool pool );
+bool MemoryPooling();
+
+// Return all cached (i.e., unused) buffers to the system allocator
+void TrimMemoryPool();
+
+MemoryPoolStatistics GetMemoryPoolStatistics();
+void ResetMemoryPoolStatistics();
+
+namespace internal {
+// The number of bytes which will actually be reserved for a request
+std::size_t PooledSize( std::size_t numBytes );
+void* PooledAllocate( std::size_t numBytes );
+void PooledFree( void* ptr, std::size_t numBytes );
+} // namespace internal
+
 template<typename G>
 class Memory
 {
@@ -28,4 +61,3 @@ public:
 };
 
 } // namespace elem
-
@@ -18,13 +18,13 @@ Memory<G>::Memory()
 template<typename G>
 inline 
 Memory<G>::Memory( std::size_t size )
-: size_(size), buffer_(new G[size])
-{ }
+: size_(0), buffer_(NULL)
+{ Require( size ); }
 
 template<typename G>
 inline 
 Memory<G>::~Memory()
-{ delete[] buffer_; }
+{ Empty(); }
 
 template<typename G>
 inline G* 
@@ -42,11 +42,11 @@ Memory<G>::Require( std::size_t size )
 {
     if( size > size_ )
     {
-        delete[] buffer_;
+        Empty();
 #ifndef RELEASE
         try {
 #endif
-        buffer_ = new G[size];
+        buffer_ = static_cast<G*>(internal::PooledAllocate( size*sizeof(G) ));
 #ifndef RELEASE
         } 
         catch( std::bad_alloc& exception )
@@ -73,9 +73,10 @@ template<typename G>
 inline void 
 Memory<G>::Empty()
 {
-    delete[] buffer_;
+    if( buffer_ != NULL )
+        internal::PooledFree( buffer_, size_*sizeof(G) );
     size_ = 0;
-    buffer_ = 0;
+    buffer_ = NULL;
 }
 
 } // namespace elem
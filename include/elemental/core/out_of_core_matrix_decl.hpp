@@ -0,0 +1,69 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+// An [MC,MR] matrix (with zero alignments) whose local entries are kept on
+// (ideally node-local) disk rather than in memory. Each process stores its
+// local matrix in the binary format of WriteBinary, in the file named
+// basename.<VC rank>, so that its tile can also be inspected with a
+// MappedMatrix. The matrix is accessed through column panels, which are read
+// into and written from [MC,MR] matrices whose local columns are contiguous
+// within the files, and so each panel transfer is a single (optionally
+// nonblocking) read or write per process.
+template<typename T,typename Int=int>
+class OutOfCoreMatrix
+{
+public:
+    // Create (or, if 'create' is false, reopen) the files for a
+    // height x width matrix. The files are left in place upon destruction.
+    OutOfCoreMatrix
+    ( Int height, Int width, const std::string basename,
+      const elem::Grid& g=DefaultGrid(), bool create=true );
+    ~OutOfCoreMatrix();
+
+    const elem::Grid& Grid() const;
+    Int Height() const;
+    Int Width() const;
+    Int LocalHeight() const;
+    Int LocalWidth() const;
+    const std::string Filename() const;
+
+    // Resize and align P so that it can hold the columns [j,j+width)
+    void AlignPanel( Int j, Int width, DistMatrix<T,MC,MR,Int>& P ) const;
+
+    // Blocking panel transfers
+    void ReadPanel( Int j, Int width, DistMatrix<T,MC,MR,Int>& P ) const;
+    void WritePanel( Int j, const DistMatrix<T,MC,MR,Int>& P );
+
+    // Nonblocking panel transfers, which must be completed with mpi::Wait
+    // before P is otherwise accessed (or, for reads, modified)
+    void StartReadPanel
+    ( Int j, Int width, DistMatrix<T,MC,MR,Int>& P,
+      mpi::Request& request ) const;
+    void StartWritePanel
+    ( Int j, const DistMatrix<T,MC,MR,Int>& P, mpi::Request& request );
+
+private:
+    const elem::Grid* grid_;
+    Int height_, width_, localHeight_, localWidth_;
+    std::string filename_;
+    mpi::File fh_;
+    bool open_;
+
+    mpi::Offset PanelOffset( Int j ) const;
+    void FormPanelType
+    ( const DistMatrix<T,MC,MR,Int>& P, mpi::Datatype& type ) const;
+
+    // Copying is disallowed since the object owns an open file
+    OutOfCoreMatrix( const OutOfCoreMatrix& );
+    const OutOfCoreMatrix& operator=( const OutOfCoreMatrix& );
+};
+
+} // namespace elem
@@ -0,0 +1,240 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+template<typename T,typename Int>
+inline
+OutOfCoreMatrix<T,Int>::OutOfCoreMatrix
+( Int height, Int width, const std::string basename, const elem::Grid& g,
+  bool create )
+: grid_(&g), height_(height), width_(width), localHeight_(0), localWidth_(0),
+  open_(false)
+{
+#ifndef RELEASE
+    PushCallStack("OutOfCoreMatrix::OutOfCoreMatrix");
+    if( height < 0 || width < 0 )
+        throw std::logic_error("Height and width must be non-negative");
+#endif
+    if( g.InGrid() )
+    {
+        localHeight_ = LocalLength<Int>( height, g.Row(), g.Height() );
+        localWidth_ = LocalLength<Int>( width, g.Col(), g.Width() );
+        std::ostringstream os;
+        os << basename << "." << g.VCRank();
+        filename_ = os.str();
+
+        const int typeCode = binary_io::TypeCode<T>::value;
+        const int amode =
+            ( create ? mpi::MODE_RDWR|mpi::MODE_CREATE : mpi::MODE_RDWR );
+        mpi::FileOpen( mpi::COMM_SELF, filename_, amode, fh_ );
+        open_ = true;
+        BinaryHeader header;
+        if( create )
+        {
+            binary_io::FormHeader
+            ( header, typeCode, MC, MR, 0, 0, localHeight_, localWidth_ );
+            mpi::FileSetSize
+            ( fh_, sizeof(BinaryHeader) +
+                   mpi::Offset(localHeight_)*localWidth_*sizeof(T) );
+            mpi::FileWriteAt
+            ( fh_, 0, (const byte*)&header, sizeof(BinaryHeader) );
+        }
+        else
+        {
+            mpi::FileReadAt( fh_, 0, (byte*)&header, sizeof(BinaryHeader) );
+            binary_io::CheckHeader( header, typeCode, filename_ );
+            if( header.height != localHeight_ || header.width != localWidth_ )
+            {
+                std::ostringstream msg;
+                msg << filename_ << " holds a " << header.height << " x "
+                    << header.width << " tile rather than a "
+                    << localHeight_ << " x " << localWidth_ << " tile";
+                throw std::runtime_error( msg.str() );
+            }
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline
+OutOfCoreMatrix<T,Int>::~OutOfCoreMatrix()
+{
+    if( open_ )
+        mpi::FileClose( fh_ );
+}
+
+template<typename T,typename Int>
+inline const elem::Grid&
+OutOfCoreMatrix<T,Int>::Grid() const
+{ return *grid_; }
+
+template<typename T,typename Int>
+inline Int
+OutOfCoreMatrix<T,Int>::Height() const
+{ return height_; }
+
+template<typename T,typename Int>
+inline Int
+OutOfCoreMatrix<T,Int>::Width() const
+{ return width_; }
+
+template<typename T,typename Int>
+inline Int
+OutOfCoreMatrix<T,Int>::LocalHeight() const
+{ return localHeight_; }
+
+template<typename T,typename Int>
+inline Int
+OutOfCoreMatrix<T,Int>::LocalWidth() const
+{ return localWidth_; }
+
+template<typename T,typename Int>
+inline const std::string
+OutOfCoreMatrix<T,Int>::Filename() const
+{ return filename_; }
+
+template<typename T,typename Int>
+inline void
+OutOfCoreMatrix<T,Int>::AlignPanel
+( Int j, Int width, DistMatrix<T,MC,MR,Int>& P ) const
+{
+#ifndef RELEASE
+    PushCallStack("OutOfCoreMatrix::AlignPanel");
+    if( j < 0 || width < 0 || j+width > width_ )
+        throw std::logic_error("Panel is out of bounds");
+#endif
+    if( P.Height() != height_ || P.Width() != width ||
+        P.ColAlignment() != 0 || P.RowAlignment() != j % grid_->Width() )
+    {
+        P.Empty();
+        P.Align( 0, j % grid_->Width() );
+        P.ResizeTo( height_, width );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// The local columns of the panel beginning at column j start after the
+// local columns which lie to the left of column j
+template<typename T,typename Int>
+inline mpi::Offset
+OutOfCoreMatrix<T,Int>::PanelOffset( Int j ) const
+{
+    const elem::Grid& g = *grid_;
+    const Int localOffset = LocalLength<Int>( j, g.Col(), g.Width() );
+    return sizeof(BinaryHeader) +
+           mpi::Offset(localOffset)*localHeight_*sizeof(T);
+}
+
+// The local data of P need not be contiguous, since its leading dimension
+// may exceed its local height
+template<typename T,typename Int>
+inline void
+OutOfCoreMatrix<T,Int>::FormPanelType
+( const DistMatrix<T,MC,MR,Int>& P, mpi::Datatype& type ) const
+{
+    mpi::Datatype entryType;
+    mpi::TypeContiguous( sizeof(T), mpi::BYTE, entryType );
+    mpi::TypeVector
+    ( P.LocalWidth(), P.LocalHeight(), P.LocalLDim(), entryType, type );
+    mpi::TypeCommit( type );
+    mpi::TypeFree( entryType );
+}
+
+template<typename T,typename Int>
+inline void
+OutOfCoreMatrix<T,Int>::StartReadPanel
+( Int j, Int width, DistMatrix<T,MC,MR,Int>& P, mpi::Request& request ) const
+{
+#ifndef RELEASE
+    PushCallStack("OutOfCoreMatrix::StartReadPanel");
+    if( P.Grid() != *grid_ )
+        throw std::logic_error("P must be distributed over the same grid");
+#endif
+    AlignPanel( j, width, P );
+    request = mpi::REQUEST_NULL;
+    if( P.LocalHeight() > 0 && P.LocalWidth() > 0 )
+    {
+        mpi::Datatype type;
+        FormPanelType( P, type );
+        mpi::FileIReadAt
+        ( fh_, PanelOffset(j), (byte*)P.LocalBuffer(), 1, type, request );
+        mpi::TypeFree( type );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+OutOfCoreMatrix<T,Int>::StartWritePanel
+( Int j, const DistMatrix<T,MC,MR,Int>& P, mpi::Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("OutOfCoreMatrix::StartWritePanel");
+    if( P.Grid() != *grid_ )
+        throw std::logic_error("P must be distributed over the same grid");
+    if( j < 0 || j+P.Width() > width_ || P.Height() != height_ )
+        throw std::logic_error("Panel is out of bounds");
+    if( P.ColAlignment() != 0 || P.RowAlignment() != j % grid_->Width() )
+        throw std::logic_error("Panel is not properly aligned");
+#endif
+    request = mpi::REQUEST_NULL;
+    if( P.LocalHeight() > 0 && P.LocalWidth() > 0 )
+    {
+        mpi::Datatype type;
+        FormPanelType( P, type );
+        mpi::FileIWriteAt
+        ( fh_, PanelOffset(j), (const byte*)P.LockedLocalBuffer(), 1, type,
+          request );
+        mpi::TypeFree( type );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+OutOfCoreMatrix<T,Int>::ReadPanel
+( Int j, Int width, DistMatrix<T,MC,MR,Int>& P ) const
+{
+#ifndef RELEASE
+    PushCallStack("OutOfCoreMatrix::ReadPanel");
+#endif
+    mpi::Request request;
+    StartReadPanel( j, width, P, request );
+    mpi::Wait( request );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+OutOfCoreMatrix<T,Int>::WritePanel( Int j, const DistMatrix<T,MC,MR,Int>& P )
+{
+#ifndef RELEASE
+    PushCallStack("OutOfCoreMatrix::WritePanel");
+#endif
+    mpi::Request request;
+    StartWritePanel( j, P, request );
+    mpi::Wait( request );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
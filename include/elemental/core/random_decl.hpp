@@ -15,4 +15,29 @@ const double Pi = 3.141592653589793;
 // origin of the ring implied by the type T using the most natural metric.
 template<typename T> T SampleUnitBall();
 
+// Distributed random matrices are instead generated with a counter-based 
+// generator, so that the sample for entry (i,j) only depends upon (i,j), the
+// key formed from the seed, and the stream index of the matrix. Each process
+// (and thread) may therefore generate any portion of the matrix without 
+// communication, and the result does not depend upon the grid or 
+// distribution.
+template<typename T> 
+T SampleUnitBall( philox::Key key, unsigned stream, int i, int j );
+
+// Generate a sample from a normal PDF with zero mean and unit variance, where
+// complex samples have independent real and imaginary parts, each with 
+// variance 1/2. Only floating-point types are supported.
+template<typename F> F SampleNormal();
+template<typename F> 
+F SampleNormal( philox::Key key, unsigned stream, int i, int j );
+
+// Reset the counter-based generator, which is seeded from the time in 
+// Initialize; the same seed must be used on every process
+void SetRandomSeed( unsigned seed );
+philox::Key RandomKey();
+
+// Return the stream index for a new distributed random matrix (this must be 
+// called by every process in the same order)
+unsigned NewRandomStream();
+
 } // namespace elem
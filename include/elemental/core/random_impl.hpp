@@ -55,4 +55,189 @@ SampleUnitBall<Complex<double> >()
     return Complex<double>(r*cos(angle),r*sin(angle));
 }
 
+namespace internal {
+
+inline philox::Counter
+RandomBits( philox::Key key, unsigned stream, int i, int j )
+{
+    philox::Counter counter;
+    counter[0] = i;
+    counter[1] = j;
+    counter[2] = stream;
+    counter[3] = 0U;
+    return philox::Philox4x32( counter, key );
+}
+
+// Map random bits to a uniform sample from (0,1] with 24 (53) bits, which is
+// the precision of a float (double)
+inline float
+Uniform24( philox::UInt32 a )
+{ return (float(a>>8)+1.f) / 16777216.f; }
+
+inline double
+Uniform53( philox::UInt32 a, philox::UInt32 b )
+{ return (double(a>>11)*4294967296.+double(b)+1.) / 9007199254740992.; }
+
+inline int
+UniformInteger( double u )
+{
+    if( u <= 1./3. )
+        return -1;
+    else if( u <= 2./3. )
+        return 0;
+    else
+        return +1;
+}
+
+} // namespace internal
+
+template<>
+inline int
+SampleUnitBall<int>( philox::Key key, unsigned stream, int i, int j )
+{
+    const philox::Counter bits = internal::RandomBits( key, stream, i, j );
+    return internal::UniformInteger( internal::Uniform53( bits[0], bits[1] ) );
+}
+
+template<>
+inline Complex<int>
+SampleUnitBall<Complex<int> >( philox::Key key, unsigned stream, int i, int j )
+{
+    const philox::Counter bits = internal::RandomBits( key, stream, i, j );
+    return Complex<int>
+    ( internal::UniformInteger( internal::Uniform53( bits[0], bits[1] ) ),
+      internal::UniformInteger( internal::Uniform53( bits[2], bits[3] ) ) );
+}
+
+template<>
+inline float
+SampleUnitBall<float>( philox::Key key, unsigned stream, int i, int j )
+{
+    const philox::Counter bits = internal::RandomBits( key, stream, i, j );
+    return 2*internal::Uniform24( bits[0] )-1.0f;
+}
+
+template<>
+inline double
+SampleUnitBall<double>( philox::Key key, unsigned stream, int i, int j )
+{
+    const philox::Counter bits = internal::RandomBits( key, stream, i, j );
+    return 2*internal::Uniform53( bits[0], bits[1] )-1.0;
+}
+
+template<>
+inline Complex<float>
+SampleUnitBall<Complex<float> >
+( philox::Key key, unsigned stream, int i, int j )
+{
+    const philox::Counter bits = internal::RandomBits( key, stream, i, j );
+    const float r = internal::Uniform24( bits[0] );
+    const float angle = 2*Pi*internal::Uniform24( bits[1] );
+    return Complex<float>(r*cos(angle),r*sin(angle));
+}
+
+template<>
+inline Complex<double>
+SampleUnitBall<Complex<double> >
+( philox::Key key, unsigned stream, int i, int j )
+{
+    const philox::Counter bits = internal::RandomBits( key, stream, i, j );
+    const double r = internal::Uniform53( bits[0], bits[1] );
+    const double angle = 2*Pi*internal::Uniform53( bits[2], bits[3] );
+    return Complex<double>(r*cos(angle),r*sin(angle));
+}
+
+// Normal samples are generated with the Box-Muller transform, using two 
+// uniform samples from (0,1] so that the logarithm is always finite
+
+namespace internal {
+
+template<typename R>
+inline Complex<R>
+BoxMuller( R u, R v )
+{
+    const R r = Sqrt(-2*Log(u));
+    const R angle = 2*Pi*v;
+    return Complex<R>(r*cos(angle),r*sin(angle));
+}
+
+} // namespace internal
+
+template<>
+inline float
+SampleNormal<float>()
+{
+    float x;
+    plcg::ParallelGaussianRandomVariable( x );
+    return x;
+}
+
+template<>
+inline double
+SampleNormal<double>()
+{
+    double x;
+    plcg::ParallelGaussianRandomVariable( x );
+    return x;
+}
+
+template<>
+inline Complex<float>
+SampleNormal<Complex<float> >()
+{
+    float x, y;
+    plcg::ParallelBoxMuller( x, y );
+    return Complex<float>(x,y) / Sqrt(2.0f);
+}
+
+template<>
+inline Complex<double>
+SampleNormal<Complex<double> >()
+{
+    double x, y;
+    plcg::ParallelBoxMuller( x, y );
+    return Complex<double>(x,y) / Sqrt(2.0);
+}
+
+template<>
+inline float
+SampleNormal<float>( philox::Key key, unsigned stream, int i, int j )
+{
+    const philox::Counter bits = internal::RandomBits( key, stream, i, j );
+    return internal::BoxMuller
+    ( internal::Uniform24( bits[0] ), internal::Uniform24( bits[1] ) ).real;
+}
+
+template<>
+inline double
+SampleNormal<double>( philox::Key key, unsigned stream, int i, int j )
+{
+    const philox::Counter bits = internal::RandomBits( key, stream, i, j );
+    return internal::BoxMuller
+    ( internal::Uniform53( bits[0], bits[1] ), 
+      internal::Uniform53( bits[2], bits[3] ) ).real;
+}
+
+template<>
+inline Complex<float>
+SampleNormal<Complex<float> >
+( philox::Key key, unsigned stream, int i, int j )
+{
+    const philox::Counter bits = internal::RandomBits( key, stream, i, j );
+    return internal::BoxMuller
+    ( internal::Uniform24( bits[0] ), 
+      internal::Uniform24( bits[1] ) ) / Sqrt(2.0f);
+}
+
+template<>
+inline Complex<double>
+SampleNormal<Complex<double> >
+( philox::Key key, unsigned stream, int i, int j )
+{
+    const philox::Counter bits = internal::RandomBits( key, stream, i, j );
+    return internal::BoxMuller
+    ( internal::Uniform53( bits[0], bits[1] ), 
+      internal::Uniform53( bits[2], bits[3] ) ) / Sqrt(2.0);
+}
+
 } // namespace elem
@@ -0,0 +1,231 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+// A RedistPlan stores everything about the redistribution A[U,V] := B[W,Z]
+// which only depends upon the sizes and alignments of the two matrices
+// (local sizes, send/recv ranks, the unpacking offsets of each process, the
+// communication buffer, and persistent requests for any permutation stage)
+// so that it may be reused for repeated redistributions of the same shape.
+// Execute rebuilds the plan whenever the shape or alignments change, so a
+// plan may simply be held across the iterations of a blocked algorithm.
+//
+// Execute is equivalent to Start followed by Wait. Start packs B into the
+// plan's buffer and posts the collective (nonblocking when the MPI
+// implementation supports it), so B may be modified as soon as Start returns,
+// whereas A must not be accessed until Wait has unpacked into it.
+//
+// Pairs of distributions which do not have a specialized plan fall back to
+// the assignment operator.
+template<typename T,Distribution U,Distribution V,
+                    Distribution W,Distribution Z,typename Int>
+class RedistPlan
+{
+public:
+    void Execute( DistMatrix<T,U,V,Int>& A, const DistMatrix<T,W,Z,Int>& B )
+    { A = B; }
+
+    void Start( DistMatrix<T,U,V,Int>& A, const DistMatrix<T,W,Z,Int>& B )
+    { A = B; }
+    void Wait() { }
+    bool Pending() const { return false; }
+
+    Int NumSetups() const { return 0; }
+};
+
+template<typename T,typename Int>
+class RedistPlan<T,MC,STAR,MC,MR,Int>
+{
+public:
+    RedistPlan();
+    ~RedistPlan();
+
+    void Execute
+    ( DistMatrix<T,MC,STAR,Int>& A, const DistMatrix<T,MC,MR,Int>& B );
+
+    void Start
+    ( DistMatrix<T,MC,STAR,Int>& A, const DistMatrix<T,MC,MR,Int>& B );
+    void Wait();
+    bool Pending() const;
+
+    // The number of times that the plan has been (re)built
+    Int NumSetups() const;
+
+private:
+    const elem::Grid* grid_;
+    Int height_, width_;
+    Int colAlignment_, colAlignmentOfB_, rowAlignmentOfB_;
+    Int localHeight_, localHeightOfB_, localWidthOfB_;
+    Int portionSize_;
+    std::vector<Int> rowShifts_, localWidths_;
+    Memory<T> buffer_;
+    bool persistent_;
+    mpi::Request requests_[2];
+    Int numSetups_;
+
+    DistMatrix<T,MC,STAR,Int>* target_;
+    mpi::Request request_;
+
+    bool Planned
+    ( const DistMatrix<T,MC,STAR,Int>& A,
+      const DistMatrix<T,MC,MR,Int>& B ) const;
+    void Setup
+    ( const DistMatrix<T,MC,STAR,Int>& A, const DistMatrix<T,MC,MR,Int>& B );
+    void FreeRequests();
+
+    // Copying is disallowed since the persistent requests refer to buffer_
+    RedistPlan( const RedistPlan& );
+    const RedistPlan& operator=( const RedistPlan& );
+};
+
+template<typename T,typename Int>
+class RedistPlan<T,STAR,MR,MC,MR,Int>
+{
+public:
+    RedistPlan();
+    ~RedistPlan();
+
+    void Execute
+    ( DistMatrix<T,STAR,MR,Int>& A, const DistMatrix<T,MC,MR,Int>& B );
+
+    void Start
+    ( DistMatrix<T,STAR,MR,Int>& A, const DistMatrix<T,MC,MR,Int>& B );
+    void Wait();
+    bool Pending() const;
+
+    // The number of times that the plan has been (re)built
+    Int NumSetups() const;
+
+private:
+    const elem::Grid* grid_;
+    Int height_, width_;
+    Int rowAlignment_, colAlignmentOfB_, rowAlignmentOfB_;
+    Int localWidth_, localHeightOfB_, localWidthOfB_;
+    Int portionSize_;
+    std::vector<Int> colShifts_, localHeights_;
+    Memory<T> buffer_;
+    bool persistent_;
+    mpi::Request requests_[2];
+    Int numSetups_;
+
+    DistMatrix<T,STAR,MR,Int>* target_;
+    mpi::Request request_;
+
+    bool Planned
+    ( const DistMatrix<T,STAR,MR,Int>& A,
+      const DistMatrix<T,MC,MR,Int>& B ) const;
+    void Setup
+    ( const DistMatrix<T,STAR,MR,Int>& A, const DistMatrix<T,MC,MR,Int>& B );
+    void FreeRequests();
+
+    // Copying is disallowed since the persistent requests refer to buffer_
+    RedistPlan( const RedistPlan& );
+    const RedistPlan& operator=( const RedistPlan& );
+};
+
+template<typename T,typename Int>
+class RedistPlan<T,VC,STAR,MC,MR,Int>
+{
+public:
+    RedistPlan();
+    ~RedistPlan();
+
+    void Execute
+    ( DistMatrix<T,VC,STAR,Int>& A, const DistMatrix<T,MC,MR,Int>& B );
+
+    void Start
+    ( DistMatrix<T,VC,STAR,Int>& A, const DistMatrix<T,MC,MR,Int>& B );
+    void Wait();
+    bool Pending() const;
+
+    // The number of times that the plan has been (re)built
+    Int NumSetups() const;
+
+private:
+    const elem::Grid* grid_;
+    Int height_, width_;
+    Int colAlignment_, colAlignmentOfB_, rowAlignmentOfB_;
+    Int localHeight_, localWidthOfB_;
+    Int portionSize_;
+    std::vector<Int> colOffsets_, packHeights_, rowShifts_, localWidths_;
+    Memory<T> buffer_;
+    bool persistent_;
+    mpi::Request requests_[2];
+    Int numSetups_;
+
+    DistMatrix<T,VC,STAR,Int>* target_;
+    mpi::Request request_;
+
+    bool Planned
+    ( const DistMatrix<T,VC,STAR,Int>& A,
+      const DistMatrix<T,MC,MR,Int>& B ) const;
+    void Setup
+    ( const DistMatrix<T,VC,STAR,Int>& A, const DistMatrix<T,MC,MR,Int>& B );
+    void FreeRequests();
+
+    // Copying is disallowed since the persistent requests refer to buffer_
+    RedistPlan( const RedistPlan& );
+    const RedistPlan& operator=( const RedistPlan& );
+};
+
+template<typename T,typename Int>
+class RedistPlan<T,STAR,VR,MC,MR,Int>
+{
+public:
+    RedistPlan();
+    ~RedistPlan();
+
+    void Execute
+    ( DistMatrix<T,STAR,VR,Int>& A, const DistMatrix<T,MC,MR,Int>& B );
+
+    void Start
+    ( DistMatrix<T,STAR,VR,Int>& A, const DistMatrix<T,MC,MR,Int>& B );
+    void Wait();
+    bool Pending() const;
+
+    // The number of times that the plan has been (re)built
+    Int NumSetups() const;
+
+private:
+    const elem::Grid* grid_;
+    Int height_, width_;
+    Int rowAlignment_, colAlignmentOfB_, rowAlignmentOfB_;
+    Int localWidth_, localHeightOfB_;
+    Int portionSize_;
+    std::vector<Int> rowOffsets_, packWidths_, colShifts_, localHeights_;
+    Memory<T> buffer_;
+    bool persistent_;
+    mpi::Request requests_[2];
+    Int numSetups_;
+
+    DistMatrix<T,STAR,VR,Int>* target_;
+    mpi::Request request_;
+
+    bool Planned
+    ( const DistMatrix<T,STAR,VR,Int>& A,
+      const DistMatrix<T,MC,MR,Int>& B ) const;
+    void Setup
+    ( const DistMatrix<T,STAR,VR,Int>& A, const DistMatrix<T,MC,MR,Int>& B );
+    void FreeRequests();
+
+    // Copying is disallowed since the persistent requests refer to buffer_
+    RedistPlan( const RedistPlan& );
+    const RedistPlan& operator=( const RedistPlan& );
+};
+
+// Begins the redistribution A := B using the given plan; the result is only
+// available after plan.Wait() has been called.
+template<typename T,Distribution U,Distribution V,
+                    Distribution W,Distribution Z,typename Int>
+void StartRedistribute
+( RedistPlan<T,U,V,W,Z,Int>& plan,
+  DistMatrix<T,U,V,Int>& A, const DistMatrix<T,W,Z,Int>& B );
+
+} // namespace elem
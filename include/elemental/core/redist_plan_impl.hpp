@@ -0,0 +1,1079 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+//----------------------------------------------------------------------------//
+// [MC,* ] <- [MC,MR]                                                         //
+//----------------------------------------------------------------------------//
+
+template<typename T,typename Int>
+inline
+RedistPlan<T,MC,STAR,MC,MR,Int>::RedistPlan()
+: grid_(0), height_(-1), width_(-1),
+  colAlignment_(0), colAlignmentOfB_(0), rowAlignmentOfB_(0),
+  localHeight_(0), localHeightOfB_(0), localWidthOfB_(0), portionSize_(0),
+  persistent_(false), numSetups_(0), target_(0), request_(mpi::REQUEST_NULL)
+{ }
+
+template<typename T,typename Int>
+inline
+RedistPlan<T,MC,STAR,MC,MR,Int>::~RedistPlan()
+{
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+    // Complete (and discard) any redistribution which was never waited on
+    if( target_ != 0 )
+        mpi::Wait( request_ );
+#endif
+    FreeRequests();
+}
+
+template<typename T,typename Int>
+inline Int
+RedistPlan<T,MC,STAR,MC,MR,Int>::NumSetups() const
+{ return numSetups_; }
+
+template<typename T,typename Int>
+inline bool
+RedistPlan<T,MC,STAR,MC,MR,Int>::Pending() const
+{ return target_ != 0; }
+
+template<typename T,typename Int>
+inline void
+RedistPlan<T,MC,STAR,MC,MR,Int>::FreeRequests()
+{
+    if( persistent_ )
+    {
+        mpi::RequestFree( requests_[0] );
+        mpi::RequestFree( requests_[1] );
+        persistent_ = false;
+    }
+}
+
+template<typename T,typename Int>
+inline bool
+RedistPlan<T,MC,STAR,MC,MR,Int>::Planned
+( const DistMatrix<T,MC,STAR,Int>& A, const DistMatrix<T,MC,MR,Int>& B ) const
+{
+    return grid_ == &B.Grid() &&
+           height_ == B.Height() && width_ == B.Width() &&
+           colAlignment_ == A.ColAlignment() &&
+           colAlignmentOfB_ == B.ColAlignment() &&
+           rowAlignmentOfB_ == B.RowAlignment();
+}
+
+template<typename T,typename Int>
+inline void
+RedistPlan<T,MC,STAR,MC,MR,Int>::Setup
+( const DistMatrix<T,MC,STAR,Int>& A, const DistMatrix<T,MC,MR,Int>& B )
+{
+#ifndef RELEASE
+    PushCallStack("RedistPlan::Setup [MC,* ] <- [MC,MR]");
+#endif
+    FreeRequests();
+    const elem::Grid& g = B.Grid();
+    grid_ = &g;
+    height_ = B.Height();
+    width_ = B.Width();
+    colAlignment_ = A.ColAlignment();
+    colAlignmentOfB_ = B.ColAlignment();
+    rowAlignmentOfB_ = B.RowAlignment();
+    localHeight_ = A.LocalHeight();
+    localHeightOfB_ = B.LocalHeight();
+    localWidthOfB_ = B.LocalWidth();
+
+    const Int r = g.Height();
+    const Int c = g.Width();
+    const Int maxLocalHeight = MaxLocalLength(height_,r);
+    const Int maxLocalWidth = MaxLocalLength(width_,c);
+    portionSize_ = std::max(maxLocalHeight*maxLocalWidth,mpi::MIN_COLL_MSG);
+
+    rowShifts_.resize( c );
+    localWidths_.resize( c );
+    for( Int k=0; k<c; ++k )
+    {
+        rowShifts_[k] = RawShift( k, rowAlignmentOfB_, c );
+        localWidths_[k] = RawLocalLength( width_, rowShifts_[k], c );
+    }
+
+    buffer_.Require( (c+1)*portionSize_ );
+    if( colAlignment_ != colAlignmentOfB_ )
+    {
+        const Int row = g.Row();
+        const Int sendRow = (row+r+colAlignment_-colAlignmentOfB_) % r;
+        const Int recvRow = (row+r+colAlignmentOfB_-colAlignment_) % r;
+        T* buffer = buffer_.Buffer();
+        T* firstBuffer = &buffer[0];
+        T* secondBuffer = &buffer[portionSize_];
+        mpi::SendInit
+        ( secondBuffer, portionSize_, sendRow, 0, g.ColComm(), requests_[0] );
+        mpi::RecvInit
+        ( firstBuffer, portionSize_, recvRow, 0, g.ColComm(), requests_[1] );
+        persistent_ = true;
+    }
+    ++numSetups_;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+RedistPlan<T,MC,STAR,MC,MR,Int>::Execute
+( DistMatrix<T,MC,STAR,Int>& A, const DistMatrix<T,MC,MR,Int>& B )
+{
+    Start( A, B );
+    Wait();
+}
+
+template<typename T,typename Int>
+inline void
+RedistPlan<T,MC,STAR,MC,MR,Int>::Start
+( DistMatrix<T,MC,STAR,Int>& A, const DistMatrix<T,MC,MR,Int>& B )
+{
+#ifndef RELEASE
+    PushCallStack("RedistPlan::Start [MC,* ] <- [MC,MR]");
+    if( Pending() )
+        throw std::logic_error("Plan already has a redistribution in flight");
+    A.AssertNotLockedView();
+    A.AssertSameGrid( B );
+    if( A.Viewing() )
+        A.AssertSameSize( B );
+#endif
+    const elem::Grid& g = B.Grid();
+    if( !A.Viewing() )
+    {
+        if( !A.ConstrainedColAlignment() )
+        {
+            A.colAlignment_ = B.ColAlignment();
+            if( g.InGrid() )
+                A.colShift_ = Shift( g.Row(), A.ColAlignment(), g.Height() );
+        }
+        A.ResizeTo( B.Height(), B.Width() );
+    }
+    if( !g.InGrid() || B.Width() == 1 )
+    {
+        // There is nothing to plan for in these cases
+        if( g.InGrid() )
+            A = B;
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+    if( !Planned( A, B ) )
+        Setup( A, B );
+
+    T* buffer = buffer_.Buffer();
+    T* firstBuffer = &buffer[0];
+    T* secondBuffer = &buffer[portionSize_];
+
+    // Pack the local data of B into the buffer which will be gathered from
+    // (after a permutation, if necessary)
+    T* packBuffer = ( persistent_ ? secondBuffer : firstBuffer );
+    const T* BLocalBuffer = B.LockedLocalBuffer();
+    const Int BLDim = B.LocalLDim();
+    const Int localHeightOfB = localHeightOfB_;
+    const Int localWidthOfB = localWidthOfB_;
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for
+#endif
+    for( Int jLocal=0; jLocal<localWidthOfB; ++jLocal )
+    {
+        const T* BCol = &BLocalBuffer[jLocal*BLDim];
+        T* packCol = &packBuffer[jLocal*localHeightOfB];
+        MemCopy( packCol, BCol, localHeightOfB );
+    }
+
+    // Realign within each process column if necessary: puts the new data
+    // into the first buffer
+    if( persistent_ )
+    {
+        std::vector<mpi::Status> statuses( 2 );
+        mpi::StartAll( 2, requests_ );
+        mpi::WaitAll( 2, requests_, &statuses[0] );
+    }
+
+    // Gather within each process row
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+    mpi::IAllGather
+    ( firstBuffer,  portionSize_,
+      secondBuffer, portionSize_, g.RowComm(), request_ );
+#else
+    mpi::AllGather
+    ( firstBuffer,  portionSize_,
+      secondBuffer, portionSize_, g.RowComm() );
+#endif
+    target_ = &A;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+RedistPlan<T,MC,STAR,MC,MR,Int>::Wait()
+{
+    if( target_ == 0 )
+        return;
+#ifndef RELEASE
+    PushCallStack("RedistPlan::Wait [MC,* ] <- [MC,MR]");
+#endif
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+    mpi::Wait( request_ );
+#endif
+    DistMatrix<T,MC,STAR,Int>& A = *target_;
+    const elem::Grid& g = *grid_;
+    const Int c = g.Width();
+    T* secondBuffer = &buffer_.Buffer()[portionSize_];
+
+    // Unpack the contents of each member of the process row
+    const Int localHeight = localHeight_;
+    T* ALocalBuffer = A.LocalBuffer();
+    const Int ALDim = A.LocalLDim();
+#if defined(HAVE_OPENMP) && !defined(PARALLELIZE_INNER_LOOPS)
+    #pragma omp parallel for
+#endif
+    for( Int k=0; k<c; ++k )
+    {
+        const T* data = &secondBuffer[k*portionSize_];
+        const Int rowShift = rowShifts_[k];
+        const Int localWidth = localWidths_[k];
+#if defined(HAVE_OPENMP) && defined(PARALLELIZE_INNER_LOOPS)
+        #pragma omp parallel for
+#endif
+        for( Int jLocal=0; jLocal<localWidth; ++jLocal )
+        {
+            const T* dataCol = &data[jLocal*localHeight];
+            T* ACol = &ALocalBuffer[(rowShift+jLocal*c)*ALDim];
+            MemCopy( ACol, dataCol, localHeight );
+        }
+    }
+    target_ = 0;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+//----------------------------------------------------------------------------//
+// [* ,MR] <- [MC,MR]                                                         //
+//----------------------------------------------------------------------------//
+
+template<typename T,typename Int>
+inline
+RedistPlan<T,STAR,MR,MC,MR,Int>::RedistPlan()
+: grid_(0), height_(-1), width_(-1),
+  rowAlignment_(0), colAlignmentOfB_(0), rowAlignmentOfB_(0),
+  localWidth_(0), localHeightOfB_(0), localWidthOfB_(0), portionSize_(0),
+  persistent_(false), numSetups_(0), target_(0), request_(mpi::REQUEST_NULL)
+{ }
+
+template<typename T,typename Int>
+inline
+RedistPlan<T,STAR,MR,MC,MR,Int>::~RedistPlan()
+{
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+    // Complete (and discard) any redistribution which was never waited on
+    if( target_ != 0 )
+        mpi::Wait( request_ );
+#endif
+    FreeRequests();
+}
+
+template<typename T,typename Int>
+inline Int
+RedistPlan<T,STAR,MR,MC,MR,Int>::NumSetups() const
+{ return numSetups_; }
+
+template<typename T,typename Int>
+inline bool
+RedistPlan<T,STAR,MR,MC,MR,Int>::Pending() const
+{ return target_ != 0; }
+
+template<typename T,typename Int>
+inline void
+RedistPlan<T,STAR,MR,MC,MR,Int>::FreeRequests()
+{
+    if( persistent_ )
+    {
+        mpi::RequestFree( requests_[0] );
+        mpi::RequestFree( requests_[1] );
+        persistent_ = false;
+    }
+}
+
+template<typename T,typename Int>
+inline bool
+RedistPlan<T,STAR,MR,MC,MR,Int>::Planned
+( const DistMatrix<T,STAR,MR,Int>& A, const DistMatrix<T,MC,MR,Int>& B ) const
+{
+    return grid_ == &B.Grid() &&
+           height_ == B.Height() && width_ == B.Width() &&
+           rowAlignment_ == A.RowAlignment() &&
+           colAlignmentOfB_ == B.ColAlignment() &&
+           rowAlignmentOfB_ == B.RowAlignment();
+}
+
+template<typename T,typename Int>
+inline void
+RedistPlan<T,STAR,MR,MC,MR,Int>::Setup
+( const DistMatrix<T,STAR,MR,Int>& A, const DistMatrix<T,MC,MR,Int>& B )
+{
+#ifndef RELEASE
+    PushCallStack("RedistPlan::Setup [* ,MR] <- [MC,MR]");
+#endif
+    FreeRequests();
+    const elem::Grid& g = B.Grid();
+    grid_ = &g;
+    height_ = B.Height();
+    width_ = B.Width();
+    rowAlignment_ = A.RowAlignment();
+    colAlignmentOfB_ = B.ColAlignment();
+    rowAlignmentOfB_ = B.RowAlignment();
+    localWidth_ = A.LocalWidth();
+    localHeightOfB_ = B.LocalHeight();
+    localWidthOfB_ = B.LocalWidth();
+
+    const Int r = g.Height();
+    const Int c = g.Width();
+    const Int maxLocalHeight = MaxLocalLength(height_,r);
+    const Int maxLocalWidth = MaxLocalLength(width_,c);
+    portionSize_ = std::max(maxLocalHeight*maxLocalWidth,mpi::MIN_COLL_MSG);
+
+    colShifts_.resize( r );
+    localHeights_.resize( r );
+    for( Int k=0; k<r; ++k )
+    {
+        colShifts_[k] = RawShift( k, colAlignmentOfB_, r );
+        localHeights_[k] = RawLocalLength( height_, colShifts_[k], r );
+    }
+
+    buffer_.Require( (r+1)*portionSize_ );
+    if( rowAlignment_ != rowAlignmentOfB_ )
+    {
+        const Int col = g.Col();
+        const Int sendCol = (col+c+rowAlignment_-rowAlignmentOfB_) % c;
+        const Int recvCol = (col+c+rowAlignmentOfB_-rowAlignment_) % c;
+        T* buffer = buffer_.Buffer();
+        T* firstBuffer = &buffer[0];
+        T* secondBuffer = &buffer[portionSize_];
+        mpi::SendInit
+        ( secondBuffer, portionSize_, sendCol, 0, g.RowComm(), requests_[0] );
+        mpi::RecvInit
+        ( firstBuffer, portionSize_, recvCol, 0, g.RowComm(), requests_[1] );
+        persistent_ = true;
+    }
+    ++numSetups_;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+RedistPlan<T,STAR,MR,MC,MR,Int>::Execute
+( DistMatrix<T,STAR,MR,Int>& A, const DistMatrix<T,MC,MR,Int>& B )
+{
+    Start( A, B );
+    Wait();
+}
+
+template<typename T,typename Int>
+inline void
+RedistPlan<T,STAR,MR,MC,MR,Int>::Start
+( DistMatrix<T,STAR,MR,Int>& A, const DistMatrix<T,MC,MR,Int>& B )
+{
+#ifndef RELEASE
+    PushCallStack("RedistPlan::Start [* ,MR] <- [MC,MR]");
+    if( Pending() )
+        throw std::logic_error("Plan already has a redistribution in flight");
+    A.AssertNotLockedView();
+    A.AssertSameGrid( B );
+    if( A.Viewing() )
+        A.AssertSameSize( B );
+#endif
+    const elem::Grid& g = B.Grid();
+    if( !A.Viewing() )
+    {
+        if( !A.ConstrainedRowAlignment() )
+        {
+            A.rowAlignment_ = B.RowAlignment();
+            if( g.InGrid() )
+                A.rowShift_ = Shift( g.Col(), A.RowAlignment(), g.Width() );
+        }
+        A.ResizeTo( B.Height(), B.Width() );
+    }
+    if( !g.InGrid() || B.Height() == 1 )
+    {
+        // There is nothing to plan for in these cases
+        if( g.InGrid() )
+            A = B;
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+    if( !Planned( A, B ) )
+        Setup( A, B );
+
+    T* buffer = buffer_.Buffer();
+    T* firstBuffer = &buffer[0];
+    T* secondBuffer = &buffer[portionSize_];
+
+    // Pack the local data of B into the buffer which will be gathered from
+    // (after a permutation, if necessary)
+    T* packBuffer = ( persistent_ ? secondBuffer : firstBuffer );
+    const T* BLocalBuffer = B.LockedLocalBuffer();
+    const Int BLDim = B.LocalLDim();
+    const Int localHeightOfB = localHeightOfB_;
+    const Int localWidthOfB = localWidthOfB_;
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for
+#endif
+    for( Int jLocal=0; jLocal<localWidthOfB; ++jLocal )
+    {
+        const T* BCol = &BLocalBuffer[jLocal*BLDim];
+        T* packCol = &packBuffer[jLocal*localHeightOfB];
+        MemCopy( packCol, BCol, localHeightOfB );
+    }
+
+    // Realign within each process row if necessary: puts the new data into
+    // the first buffer
+    if( persistent_ )
+    {
+        std::vector<mpi::Status> statuses( 2 );
+        mpi::StartAll( 2, requests_ );
+        mpi::WaitAll( 2, requests_, &statuses[0] );
+    }
+
+    // Gather within each process column
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+    mpi::IAllGather
+    ( firstBuffer,  portionSize_,
+      secondBuffer, portionSize_, g.ColComm(), request_ );
+#else
+    mpi::AllGather
+    ( firstBuffer,  portionSize_,
+      secondBuffer, portionSize_, g.ColComm() );
+#endif
+    target_ = &A;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+RedistPlan<T,STAR,MR,MC,MR,Int>::Wait()
+{
+    if( target_ == 0 )
+        return;
+#ifndef RELEASE
+    PushCallStack("RedistPlan::Wait [* ,MR] <- [MC,MR]");
+#endif
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+    mpi::Wait( request_ );
+#endif
+    DistMatrix<T,STAR,MR,Int>& A = *target_;
+    const elem::Grid& g = *grid_;
+    const Int r = g.Height();
+    T* secondBuffer = &buffer_.Buffer()[portionSize_];
+
+    // Unpack the contents of each member of the process column
+    const Int localWidth = localWidth_;
+    T* ALocalBuffer = A.LocalBuffer();
+    const Int ALDim = A.LocalLDim();
+#if defined(HAVE_OPENMP) && !defined(PARALLELIZE_INNER_LOOPS)
+    #pragma omp parallel for
+#endif
+    for( Int k=0; k<r; ++k )
+    {
+        const T* data = &secondBuffer[k*portionSize_];
+        const Int colShift = colShifts_[k];
+        const Int localHeight = localHeights_[k];
+#if defined(HAVE_OPENMP) && defined(PARALLELIZE_INNER_LOOPS)
+        #pragma omp parallel for
+#endif
+        for( Int jLocal=0; jLocal<localWidth; ++jLocal )
+        {
+            T* destCol = &ALocalBuffer[colShift+jLocal*ALDim];
+            const T* sourceCol = &data[jLocal*localHeight];
+            for( Int iLocal=0; iLocal<localHeight; ++iLocal )
+                destCol[iLocal*r] = sourceCol[iLocal];
+        }
+    }
+    target_ = 0;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+//----------------------------------------------------------------------------//
+// [VC,* ] <- [MC,MR]                                                         //
+//----------------------------------------------------------------------------//
+
+template<typename T,typename Int>
+inline
+RedistPlan<T,VC,STAR,MC,MR,Int>::RedistPlan()
+: grid_(0), height_(-1), width_(-1),
+  colAlignment_(0), colAlignmentOfB_(0), rowAlignmentOfB_(0),
+  localHeight_(0), localWidthOfB_(0), portionSize_(0),
+  persistent_(false), numSetups_(0), target_(0), request_(mpi::REQUEST_NULL)
+{ }
+
+template<typename T,typename Int>
+inline
+RedistPlan<T,VC,STAR,MC,MR,Int>::~RedistPlan()
+{
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+    // Complete (and discard) any redistribution which was never waited on
+    if( target_ != 0 )
+        mpi::Wait( request_ );
+#endif
+    FreeRequests();
+}
+
+template<typename T,typename Int>
+inline Int
+RedistPlan<T,VC,STAR,MC,MR,Int>::NumSetups() const
+{ return numSetups_; }
+
+template<typename T,typename Int>
+inline bool
+RedistPlan<T,VC,STAR,MC,MR,Int>::Pending() const
+{ return target_ != 0; }
+
+template<typename T,typename Int>
+inline void
+RedistPlan<T,VC,STAR,MC,MR,Int>::FreeRequests()
+{
+    if( persistent_ )
+    {
+        mpi::RequestFree( requests_[0] );
+        mpi::RequestFree( requests_[1] );
+        persistent_ = false;
+    }
+}
+
+template<typename T,typename Int>
+inline bool
+RedistPlan<T,VC,STAR,MC,MR,Int>::Planned
+( const DistMatrix<T,VC,STAR,Int>& A, const DistMatrix<T,MC,MR,Int>& B ) const
+{
+    return grid_ == &B.Grid() &&
+           height_ == B.Height() && width_ == B.Width() &&
+           colAlignment_ == A.ColAlignment() &&
+           colAlignmentOfB_ == B.ColAlignment() &&
+           rowAlignmentOfB_ == B.RowAlignment();
+}
+
+template<typename T,typename Int>
+inline void
+RedistPlan<T,VC,STAR,MC,MR,Int>::Setup
+( const DistMatrix<T,VC,STAR,Int>& A, const DistMatrix<T,MC,MR,Int>& B )
+{
+#ifndef RELEASE
+    PushCallStack("RedistPlan::Setup [VC,* ] <- [MC,MR]");
+#endif
+    FreeRequests();
+    const elem::Grid& g = B.Grid();
+    grid_ = &g;
+    height_ = B.Height();
+    width_ = B.Width();
+    colAlignment_ = A.ColAlignment();
+    colAlignmentOfB_ = B.ColAlignment();
+    rowAlignmentOfB_ = B.RowAlignment();
+    localHeight_ = A.LocalHeight();
+    localWidthOfB_ = B.LocalWidth();
+
+    const Int r = g.Height();
+    const Int c = g.Width();
+    const Int p = g.Size();
+    const Int row = g.Row();
+    const Int colShiftOfB = B.ColShift();
+    const Int maxHeight = MaxLocalLength(height_,p);
+    const Int maxWidth = MaxLocalLength(width_,c);
+    portionSize_ = std::max(maxHeight*maxWidth,mpi::MIN_COLL_MSG);
+
+    // When unaligned, we pack for the process row which we will trade with
+    // after the AllToAll
+    const Int sendRow = (row+r+(colAlignment_%r)-colAlignmentOfB_) % r;
+    const Int recvRow = (row+r+colAlignmentOfB_-(colAlignment_%r)) % r;
+    const bool aligned = ( colAlignment_ % r == colAlignmentOfB_ );
+    const Int packRow = ( aligned ? row : sendRow );
+
+    colOffsets_.resize( c );
+    packHeights_.resize( c );
+    rowShifts_.resize( c );
+    localWidths_.resize( c );
+    for( Int k=0; k<c; ++k )
+    {
+        const Int thisRank = packRow+k*r;
+        const Int thisColShift = RawShift(thisRank,colAlignment_,p);
+        colOffsets_[k] = (thisColShift-colShiftOfB) / r;
+        packHeights_[k] = RawLocalLength(height_,thisColShift,p);
+        rowShifts_[k] = RawShift( k, rowAlignmentOfB_, c );
+        localWidths_[k] = RawLocalLength( width_, rowShifts_[k], c );
+    }
+
+    buffer_.Require( 2*c*portionSize_ );
+    if( !aligned )
+    {
+        T* buffer = buffer_.Buffer();
+        T* firstBuffer = &buffer[0];
+        T* secondBuffer = &buffer[c*portionSize_];
+        mpi::SendInit
+        ( secondBuffer, c*portionSize_, sendRow, 0, g.ColComm(), 
+          requests_[0] );
+        mpi::RecvInit
+        ( firstBuffer, c*portionSize_, recvRow, 0, g.ColComm(), 
+          requests_[1] );
+        persistent_ = true;
+    }
+    ++numSetups_;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+RedistPlan<T,VC,STAR,MC,MR,Int>::Execute
+( DistMatrix<T,VC,STAR,Int>& A, const DistMatrix<T,MC,MR,Int>& B )
+{
+    Start( A, B );
+    Wait();
+}
+
+template<typename T,typename Int>
+inline void
+RedistPlan<T,VC,STAR,MC,MR,Int>::Start
+( DistMatrix<T,VC,STAR,Int>& A, const DistMatrix<T,MC,MR,Int>& B )
+{
+#ifndef RELEASE
+    PushCallStack("RedistPlan::Start [VC,* ] <- [MC,MR]");
+    if( Pending() )
+        throw std::logic_error("Plan already has a redistribution in flight");
+    A.AssertNotLockedView();
+    A.AssertSameGrid( B );
+    if( A.Viewing() )
+        A.AssertSameSize( B );
+#endif
+    const elem::Grid& g = B.Grid();
+    if( !A.Viewing() )
+    {
+        if( !A.ConstrainedColAlignment() )
+        {
+            A.colAlignment_ = B.ColAlignment();
+            if( g.InGrid() )
+                A.colShift_ = Shift( g.VCRank(), A.ColAlignment(), g.Size() );
+        }
+        A.ResizeTo( B.Height(), B.Width() );
+    }
+    if( !g.InGrid() )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+    if( !Planned( A, B ) )
+        Setup( A, B );
+
+    const Int c = g.Width();
+    T* buffer = buffer_.Buffer();
+    T* firstBuffer = &buffer[0];
+    T* secondBuffer = &buffer[c*portionSize_];
+
+    // Pack the portion of B destined for each member of the process row
+    const T* BLocalBuffer = B.LockedLocalBuffer();
+    const Int BLDim = B.LocalLDim();
+    const Int localWidthOfB = localWidthOfB_;
+#if defined(HAVE_OPENMP) && !defined(PARALLELIZE_INNER_LOOPS)
+    #pragma omp parallel for
+#endif
+    for( Int k=0; k<c; ++k )
+    {
+        T* data = &firstBuffer[k*portionSize_];
+        const Int colOffset = colOffsets_[k];
+        const Int packHeight = packHeights_[k];
+#if defined(HAVE_OPENMP) && defined(PARALLELIZE_INNER_LOOPS)
+        #pragma omp parallel for
+#endif
+        for( Int jLocal=0; jLocal<localWidthOfB; ++jLocal )
+        {
+            T* destCol = &data[jLocal*packHeight];
+            const T* sourceCol = &BLocalBuffer[colOffset+jLocal*BLDim];
+            for( Int iLocal=0; iLocal<packHeight; ++iLocal )
+                destCol[iLocal] = sourceCol[iLocal*c];
+        }
+    }
+
+    // Exchange within each process row
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+    mpi::IAllToAll
+    ( firstBuffer,  portionSize_,
+      secondBuffer, portionSize_, g.RowComm(), request_ );
+#else
+    mpi::AllToAll
+    ( firstBuffer,  portionSize_,
+      secondBuffer, portionSize_, g.RowComm() );
+#endif
+    target_ = &A;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+RedistPlan<T,VC,STAR,MC,MR,Int>::Wait()
+{
+    if( target_ == 0 )
+        return;
+#ifndef RELEASE
+    PushCallStack("RedistPlan::Wait [VC,* ] <- [MC,MR]");
+#endif
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+    mpi::Wait( request_ );
+#endif
+    DistMatrix<T,VC,STAR,Int>& A = *target_;
+    const elem::Grid& g = *grid_;
+    const Int c = g.Width();
+    T* buffer = buffer_.Buffer();
+    T* firstBuffer = &buffer[0];
+    T* secondBuffer = &buffer[c*portionSize_];
+
+    // Realign within each process column if necessary: puts the new data
+    // into the first buffer
+    T* unpackBuffer = secondBuffer;
+    if( persistent_ )
+    {
+        std::vector<mpi::Status> statuses( 2 );
+        mpi::StartAll( 2, requests_ );
+        mpi::WaitAll( 2, requests_, &statuses[0] );
+        unpackBuffer = firstBuffer;
+    }
+
+    // Unpack the contents of each member of the process row
+    const Int localHeight = localHeight_;
+    T* ALocalBuffer = A.LocalBuffer();
+    const Int ALDim = A.LocalLDim();
+#if defined(HAVE_OPENMP) && !defined(PARALLELIZE_INNER_LOOPS)
+    #pragma omp parallel for
+#endif
+    for( Int k=0; k<c; ++k )
+    {
+        const T* data = &unpackBuffer[k*portionSize_];
+        const Int rowShift = rowShifts_[k];
+        const Int localWidth = localWidths_[k];
+#if defined(HAVE_OPENMP) && defined(PARALLELIZE_INNER_LOOPS)
+        #pragma omp parallel for
+#endif
+        for( Int jLocal=0; jLocal<localWidth; ++jLocal )
+        {
+            const T* dataCol = &data[jLocal*localHeight];
+            T* ACol = &ALocalBuffer[(rowShift+jLocal*c)*ALDim];
+            MemCopy( ACol, dataCol, localHeight );
+        }
+    }
+    target_ = 0;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+//----------------------------------------------------------------------------//
+// [* ,VR] <- [MC,MR]                                                         //
+//----------------------------------------------------------------------------//
+
+template<typename T,typename Int>
+inline
+RedistPlan<T,STAR,VR,MC,MR,Int>::RedistPlan()
+: grid_(0), height_(-1), width_(-1),
+  rowAlignment_(0), colAlignmentOfB_(0), rowAlignmentOfB_(0),
+  localWidth_(0), localHeightOfB_(0), portionSize_(0),
+  persistent_(false), numSetups_(0), target_(0), request_(mpi::REQUEST_NULL)
+{ }
+
+template<typename T,typename Int>
+inline
+RedistPlan<T,STAR,VR,MC,MR,Int>::~RedistPlan()
+{
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+    // Complete (and discard) any redistribution which was never waited on
+    if( target_ != 0 )
+        mpi::Wait( request_ );
+#endif
+    FreeRequests();
+}
+
+template<typename T,typename Int>
+inline Int
+RedistPlan<T,STAR,VR,MC,MR,Int>::NumSetups() const
+{ return numSetups_; }
+
+template<typename T,typename Int>
+inline bool
+RedistPlan<T,STAR,VR,MC,MR,Int>::Pending() const
+{ return target_ != 0; }
+
+template<typename T,typename Int>
+inline void
+RedistPlan<T,STAR,VR,MC,MR,Int>::FreeRequests()
+{
+    if( persistent_ )
+    {
+        mpi::RequestFree( requests_[0] );
+        mpi::RequestFree( requests_[1] );
+        persistent_ = false;
+    }
+}
+
+template<typename T,typename Int>
+inline bool
+RedistPlan<T,STAR,VR,MC,MR,Int>::Planned
+( const DistMatrix<T,STAR,VR,Int>& A, const DistMatrix<T,MC,MR,Int>& B ) const
+{
+    return grid_ == &B.Grid() &&
+           height_ == B.Height() && width_ == B.Width() &&
+           rowAlignment_ == A.RowAlignment() &&
+           colAlignmentOfB_ == B.ColAlignment() &&
+           rowAlignmentOfB_ == B.RowAlignment();
+}
+
+template<typename T,typename Int>
+inline void
+RedistPlan<T,STAR,VR,MC,MR,Int>::Setup
+( const DistMatrix<T,STAR,VR,Int>& A, const DistMatrix<T,MC,MR,Int>& B )
+{
+#ifndef RELEASE
+    PushCallStack("RedistPlan::Setup [* ,VR] <- [MC,MR]");
+#endif
+    FreeRequests();
+    const elem::Grid& g = B.Grid();
+    grid_ = &g;
+    height_ = B.Height();
+    width_ = B.Width();
+    rowAlignment_ = A.RowAlignment();
+    colAlignmentOfB_ = B.ColAlignment();
+    rowAlignmentOfB_ = B.RowAlignment();
+    localWidth_ = A.LocalWidth();
+    localHeightOfB_ = B.LocalHeight();
+
+    const Int r = g.Height();
+    const Int c = g.Width();
+    const Int p = g.Size();
+    const Int col = g.Col();
+    const Int rowShiftOfB = B.RowShift();
+    const Int maxHeight = MaxLocalLength(height_,r);
+    const Int maxWidth = MaxLocalLength(width_,p);
+    portionSize_ = std::max(maxHeight*maxWidth,mpi::MIN_COLL_MSG);
+
+    // When unaligned, we pack for the process column which we will trade 
+    // with after the AllToAll
+    const Int sendCol = (col+c+(rowAlignment_%c)-rowAlignmentOfB_) % c;
+    const Int recvCol = (col+c+rowAlignmentOfB_-(rowAlignment_%c)) % c;
+    const bool aligned = ( rowAlignment_ % c == rowAlignmentOfB_ );
+    const Int packCol = ( aligned ? col : sendCol );
+
+    rowOffsets_.resize( r );
+    packWidths_.resize( r );
+    colShifts_.resize( r );
+    localHeights_.resize( r );
+    for( Int k=0; k<r; ++k )
+    {
+        const Int thisRank = packCol+k*c;
+        const Int thisRowShift = RawShift(thisRank,rowAlignment_,p);
+        rowOffsets_[k] = (thisRowShift-rowShiftOfB) / c;
+        packWidths_[k] = RawLocalLength(width_,thisRowShift,p);
+        colShifts_[k] = RawShift( k, colAlignmentOfB_, r );
+        localHeights_[k] = RawLocalLength( height_, colShifts_[k], r );
+    }
+
+    buffer_.Require( 2*r*portionSize_ );
+    if( !aligned )
+    {
+        T* buffer = buffer_.Buffer();
+        T* firstBuffer = &buffer[0];
+        T* secondBuffer = &buffer[r*portionSize_];
+        mpi::SendInit
+        ( secondBuffer, r*portionSize_, sendCol, 0, g.RowComm(), 
+          requests_[0] );
+        mpi::RecvInit
+        ( firstBuffer, r*portionSize_, recvCol, 0, g.RowComm(), 
+          requests_[1] );
+        persistent_ = true;
+    }
+    ++numSetups_;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+RedistPlan<T,STAR,VR,MC,MR,Int>::Execute
+( DistMatrix<T,STAR,VR,Int>& A, const DistMatrix<T,MC,MR,Int>& B )
+{
+    Start( A, B );
+    Wait();
+}
+
+template<typename T,typename Int>
+inline void
+RedistPlan<T,STAR,VR,MC,MR,Int>::Start
+( DistMatrix<T,STAR,VR,Int>& A, const DistMatrix<T,MC,MR,Int>& B )
+{
+#ifndef RELEASE
+    PushCallStack("RedistPlan::Start [* ,VR] <- [MC,MR]");
+    if( Pending() )
+        throw std::logic_error("Plan already has a redistribution in flight");
+    A.AssertNotLockedView();
+    A.AssertSameGrid( B );
+    if( A.Viewing() )
+        A.AssertSameSize( B );
+#endif
+    const elem::Grid& g = B.Grid();
+    if( !A.Viewing() )
+    {
+        if( !A.ConstrainedRowAlignment() )
+        {
+            A.rowAlignment_ = B.RowAlignment();
+            if( g.InGrid() )
+                A.rowShift_ = Shift( g.VRRank(), A.RowAlignment(), g.Size() );
+        }
+        A.ResizeTo( B.Height(), B.Width() );
+    }
+    if( !g.InGrid() )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+    if( !Planned( A, B ) )
+        Setup( A, B );
+
+    const Int r = g.Height();
+    T* buffer = buffer_.Buffer();
+    T* firstBuffer = &buffer[0];
+    T* secondBuffer = &buffer[r*portionSize_];
+
+    // Pack the portion of B destined for each member of the process column
+    const T* BLocalBuffer = B.LockedLocalBuffer();
+    const Int BLDim = B.LocalLDim();
+    const Int localHeightOfB = localHeightOfB_;
+#if defined(HAVE_OPENMP) && !defined(PARALLELIZE_INNER_LOOPS)
+    #pragma omp parallel for
+#endif
+    for( Int k=0; k<r; ++k )
+    {
+        T* data = &firstBuffer[k*portionSize_];
+        const Int rowOffset = rowOffsets_[k];
+        const Int packWidth = packWidths_[k];
+#if defined(HAVE_OPENMP) && defined(PARALLELIZE_INNER_LOOPS)
+        #pragma omp parallel for
+#endif
+        for( Int jLocal=0; jLocal<packWidth; ++jLocal )
+        {
+            const T* BCol = &BLocalBuffer[(rowOffset+jLocal*r)*BLDim];
+            T* dataCol = &data[jLocal*localHeightOfB];
+            MemCopy( dataCol, BCol, localHeightOfB );
+        }
+    }
+
+    // Exchange within each process column
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+    mpi::IAllToAll
+    ( firstBuffer,  portionSize_,
+      secondBuffer, portionSize_, g.ColComm(), request_ );
+#else
+    mpi::AllToAll
+    ( firstBuffer,  portionSize_,
+      secondBuffer, portionSize_, g.ColComm() );
+#endif
+    target_ = &A;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+RedistPlan<T,STAR,VR,MC,MR,Int>::Wait()
+{
+    if( target_ == 0 )
+        return;
+#ifndef RELEASE
+    PushCallStack("RedistPlan::Wait [* ,VR] <- [MC,MR]");
+#endif
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+    mpi::Wait( request_ );
+#endif
+    DistMatrix<T,STAR,VR,Int>& A = *target_;
+    const elem::Grid& g = *grid_;
+    const Int r = g.Height();
+    T* buffer = buffer_.Buffer();
+    T* firstBuffer = &buffer[0];
+    T* secondBuffer = &buffer[r*portionSize_];
+
+    // Realign within each process row if necessary: puts the new data into
+    // the first buffer
+    T* unpackBuffer = secondBuffer;
+    if( persistent_ )
+    {
+        std::vector<mpi::Status> statuses( 2 );
+        mpi::StartAll( 2, requests_ );
+        mpi::WaitAll( 2, requests_, &statuses[0] );
+        unpackBuffer = firstBuffer;
+    }
+
+    // Unpack the contents of each member of the process column
+    const Int localWidth = localWidth_;
+    T* ALocalBuffer = A.LocalBuffer();
+    const Int ALDim = A.LocalLDim();
+#if defined(HAVE_OPENMP) && !defined(PARALLELIZE_INNER_LOOPS)
+    #pragma omp parallel for
+#endif
+    for( Int k=0; k<r; ++k )
+    {
+        const T* data = &unpackBuffer[k*portionSize_];
+        const Int colShift = colShifts_[k];
+        const Int localHeight = localHeights_[k];
+#if defined(HAVE_OPENMP) && defined(PARALLELIZE_INNER_LOOPS)
+        #pragma omp parallel for
+#endif
+        for( Int jLocal=0; jLocal<localWidth; ++jLocal )
+        {
+            T* destCol = &ALocalBuffer[colShift+jLocal*ALDim];
+            const T* sourceCol = &data[jLocal*localHeight];
+            for( Int iLocal=0; iLocal<localHeight; ++iLocal )
+                destCol[iLocal*r] = sourceCol[iLocal];
+        }
+    }
+    target_ = 0;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+//----------------------------------------------------------------------------//
+// Nonblocking interface                                                      //
+//----------------------------------------------------------------------------//
+
+template<typename T,Distribution U,Distribution V,
+                    Distribution W,Distribution Z,typename Int>
+inline void
+StartRedistribute
+( RedistPlan<T,U,V,W,Z,Int>& plan,
+  DistMatrix<T,U,V,Int>& A, const DistMatrix<T,W,Z,Int>& B )
+{ plan.Start( A, B ); }
+
+} // namespace elem
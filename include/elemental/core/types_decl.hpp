@@ -27,6 +27,12 @@ struct SafeProduct
     SafeProduct( Int numEntries );
 };
 
+// The number of positive and negative eigenvalues of a Hermitian matrix
+struct InertiaType
+{
+    int numPositive, numNegative;
+};
+
 namespace conjugation_wrapper {
 enum Conjugation
 {
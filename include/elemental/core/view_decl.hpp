@@ -129,6 +129,35 @@ void LockedView2x2
   const DistMatrix<T,U,V,Int>& BBL,
   const DistMatrix<T,U,V,Int>& BBR );
 
+//
+// View the subset of a redundantly-stored matrix which a finer distribution
+// would own (e.g., [MC,MR] from [MC,* ]) without copying any data
+//
+
+template<typename T,typename Int>
+void View( DistMatrix<T,MC,MR,Int>& A, DistMatrix<T,MC,STAR,Int>& B );
+template<typename T,typename Int>
+void LockedView
+( DistMatrix<T,MC,MR,Int>& A, const DistMatrix<T,MC,STAR,Int>& B );
+
+template<typename T,typename Int>
+void View( DistMatrix<T,MR,MC,Int>& A, DistMatrix<T,MR,STAR,Int>& B );
+template<typename T,typename Int>
+void LockedView
+( DistMatrix<T,MR,MC,Int>& A, const DistMatrix<T,MR,STAR,Int>& B );
+
+template<typename T,typename Int>
+void View( DistMatrix<T,STAR,MR,Int>& A, DistMatrix<T,STAR,STAR,Int>& B );
+template<typename T,typename Int>
+void LockedView
+( DistMatrix<T,STAR,MR,Int>& A, const DistMatrix<T,STAR,STAR,Int>& B );
+
+template<typename T,typename Int>
+void View( DistMatrix<T,STAR,MC,Int>& A, DistMatrix<T,STAR,STAR,Int>& B );
+template<typename T,typename Int>
+void LockedView
+( DistMatrix<T,STAR,MC,Int>& A, const DistMatrix<T,STAR,STAR,Int>& B );
+
 // Utilities for handling the extra information needed for [MD,* ] and [* ,MD]
 template<typename T,Distribution U,Distribution V,typename Int>
 void HandleDiagPath
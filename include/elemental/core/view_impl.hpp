@@ -695,4 +695,189 @@ inline void LockedView2x2
 #endif
 }
 
+namespace internal {
+
+// If every column of a matrix is stored locally, then the local columns owned
+// by a distribution with a row stride of s begin at column 'rowShift' and are
+// s columns apart, so they can be viewed in place with a leading dimension
+// of s*ldim.
+template<typename T,typename Int>
+inline T*
+StridedColumns( T* buffer, Int ldim, Int width, Int rowShift )
+{ return ( rowShift < width ? &buffer[rowShift*ldim] : buffer ); }
+
+} // namespace internal
+
+template<typename T,typename Int>
+inline void
+View
+( DistMatrix<T,MC,MR,Int>& A, DistMatrix<T,MC,STAR,Int>& B )
+{
+#ifndef RELEASE
+    PushCallStack("View([MC,MR],[MC,* ])");
+#endif
+    const elem::Grid& g = B.Grid();
+    const Int stride = g.Width();
+    T* buffer = 0;
+    if( g.InGrid() )
+        buffer = internal::StridedColumns
+                 ( B.LocalBuffer(), B.LocalLDim(), B.Width(), g.Col() );
+    A.Attach
+    ( B.Height(), B.Width(), B.ColAlignment(), 0,
+      buffer, stride*B.LocalLDim(), g );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+LockedView
+( DistMatrix<T,MC,MR,Int>& A, const DistMatrix<T,MC,STAR,Int>& B )
+{
+#ifndef RELEASE
+    PushCallStack("LockedView([MC,MR],[MC,* ])");
+#endif
+    const elem::Grid& g = B.Grid();
+    const Int stride = g.Width();
+    const T* buffer = 0;
+    if( g.InGrid() )
+        buffer = internal::StridedColumns
+                 ( B.LockedLocalBuffer(), B.LocalLDim(), B.Width(), g.Col() );
+    A.LockedAttach
+    ( B.Height(), B.Width(), B.ColAlignment(), 0,
+      buffer, stride*B.LocalLDim(), g );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+View
+( DistMatrix<T,MR,MC,Int>& A, DistMatrix<T,MR,STAR,Int>& B )
+{
+#ifndef RELEASE
+    PushCallStack("View([MR,MC],[MR,* ])");
+#endif
+    const elem::Grid& g = B.Grid();
+    const Int stride = g.Height();
+    T* buffer = 0;
+    if( g.InGrid() )
+        buffer = internal::StridedColumns
+                 ( B.LocalBuffer(), B.LocalLDim(), B.Width(), g.Row() );
+    A.Attach
+    ( B.Height(), B.Width(), B.ColAlignment(), 0,
+      buffer, stride*B.LocalLDim(), g );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+LockedView
+( DistMatrix<T,MR,MC,Int>& A, const DistMatrix<T,MR,STAR,Int>& B )
+{
+#ifndef RELEASE
+    PushCallStack("LockedView([MR,MC],[MR,* ])");
+#endif
+    const elem::Grid& g = B.Grid();
+    const Int stride = g.Height();
+    const T* buffer = 0;
+    if( g.InGrid() )
+        buffer = internal::StridedColumns
+                 ( B.LockedLocalBuffer(), B.LocalLDim(), B.Width(), g.Row() );
+    A.LockedAttach
+    ( B.Height(), B.Width(), B.ColAlignment(), 0,
+      buffer, stride*B.LocalLDim(), g );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+View
+( DistMatrix<T,STAR,MR,Int>& A, DistMatrix<T,STAR,STAR,Int>& B )
+{
+#ifndef RELEASE
+    PushCallStack("View([* ,MR],[* ,* ])");
+#endif
+    const elem::Grid& g = B.Grid();
+    const Int stride = g.Width();
+    T* buffer = 0;
+    if( g.InGrid() )
+        buffer = internal::StridedColumns
+                 ( B.LocalBuffer(), B.LocalLDim(), B.Width(), g.Col() );
+    A.Attach
+    ( B.Height(), B.Width(), 0, buffer, stride*B.LocalLDim(), g );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+LockedView
+( DistMatrix<T,STAR,MR,Int>& A, const DistMatrix<T,STAR,STAR,Int>& B )
+{
+#ifndef RELEASE
+    PushCallStack("LockedView([* ,MR],[* ,* ])");
+#endif
+    const elem::Grid& g = B.Grid();
+    const Int stride = g.Width();
+    const T* buffer = 0;
+    if( g.InGrid() )
+        buffer = internal::StridedColumns
+                 ( B.LockedLocalBuffer(), B.LocalLDim(), B.Width(), g.Col() );
+    A.LockedAttach
+    ( B.Height(), B.Width(), 0, buffer, stride*B.LocalLDim(), g );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+View
+( DistMatrix<T,STAR,MC,Int>& A, DistMatrix<T,STAR,STAR,Int>& B )
+{
+#ifndef RELEASE
+    PushCallStack("View([* ,MC],[* ,* ])");
+#endif
+    const elem::Grid& g = B.Grid();
+    const Int stride = g.Height();
+    T* buffer = 0;
+    if( g.InGrid() )
+        buffer = internal::StridedColumns
+                 ( B.LocalBuffer(), B.LocalLDim(), B.Width(), g.Row() );
+    A.Attach
+    ( B.Height(), B.Width(), 0, buffer, stride*B.LocalLDim(), g );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+LockedView
+( DistMatrix<T,STAR,MC,Int>& A, const DistMatrix<T,STAR,STAR,Int>& B )
+{
+#ifndef RELEASE
+    PushCallStack("LockedView([* ,MC],[* ,* ])");
+#endif
+    const elem::Grid& g = B.Grid();
+    const Int stride = g.Height();
+    const T* buffer = 0;
+    if( g.InGrid() )
+        buffer = internal::StridedColumns
+                 ( B.LockedLocalBuffer(), B.LocalLDim(), B.Width(), g.Row() );
+    A.LockedAttach
+    ( B.Height(), B.Width(), 0, buffer, stride*B.LocalLDim(), g );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 } // namespace elem
@@ -24,6 +24,7 @@
 #include "./ApplyPackedReflectors/RUHF.hpp"
 #include "./ApplyPackedReflectors/RUVB.hpp"
 #include "./ApplyPackedReflectors/RUVF.hpp"
+#include "./ApplyPackedReflectors/TwoStage.hpp"
 
 namespace elem {
 
@@ -367,4 +368,167 @@ ApplyPackedReflectors
 #endif
 }
 
+template<typename R>
+inline void
+ApplyPackedReflectors
+( LeftOrRight side, ForwardOrBackward order,
+  const PackedReflectors<R>& Q, DistMatrix<R>& A )
+{
+#ifndef RELEASE
+    PushCallStack("ApplyPackedReflectors");
+#endif
+    if( IsComplex<R>::val )
+        throw std::logic_error("Called real routine with complex datatype");
+
+    if( side == LEFT )
+    {
+        if( Q.Uplo() == LOWER )
+        {
+            if( Q.Dir() == VERTICAL && order == FORWARD )
+                internal::ApplyPackedReflectorsLLVF
+                ( Q.Offset(), Q.H(), A, &Q );
+            else if( Q.Dir() == VERTICAL )
+                internal::ApplyPackedReflectorsLLVB
+                ( Q.Offset(), Q.H(), A, &Q );
+            else if( order == FORWARD )
+                internal::ApplyPackedReflectorsLLHF
+                ( Q.Offset(), Q.H(), A, &Q );
+            else
+                internal::ApplyPackedReflectorsLLHB
+                ( Q.Offset(), Q.H(), A, &Q );
+        }
+        else
+        {
+            if( Q.Dir() == VERTICAL && order == FORWARD )
+                internal::ApplyPackedReflectorsLUVF
+                ( Q.Offset(), Q.H(), A, &Q );
+            else if( Q.Dir() == VERTICAL )
+                internal::ApplyPackedReflectorsLUVB
+                ( Q.Offset(), Q.H(), A, &Q );
+            else if( order == FORWARD )
+                internal::ApplyPackedReflectorsLUHF
+                ( Q.Offset(), Q.H(), A, &Q );
+            else
+                internal::ApplyPackedReflectorsLUHB
+                ( Q.Offset(), Q.H(), A, &Q );
+        }
+    }
+    else
+    {
+        if( Q.Uplo() == LOWER )
+        {
+            if( Q.Dir() == VERTICAL && order == FORWARD )
+                internal::ApplyPackedReflectorsRLVF
+                ( Q.Offset(), Q.H(), A, &Q );
+            else if( Q.Dir() == VERTICAL )
+                internal::ApplyPackedReflectorsRLVB
+                ( Q.Offset(), Q.H(), A, &Q );
+            else if( order == FORWARD )
+                internal::ApplyPackedReflectorsRLHF
+                ( Q.Offset(), Q.H(), A, &Q );
+            else
+                internal::ApplyPackedReflectorsRLHB
+                ( Q.Offset(), Q.H(), A, &Q );
+        }
+        else
+        {
+            if( Q.Dir() == VERTICAL && order == FORWARD )
+                internal::ApplyPackedReflectorsRUVF
+                ( Q.Offset(), Q.H(), A, &Q );
+            else if( Q.Dir() == VERTICAL )
+                internal::ApplyPackedReflectorsRUVB
+                ( Q.Offset(), Q.H(), A, &Q );
+            else if( order == FORWARD )
+                internal::ApplyPackedReflectorsRUHF
+                ( Q.Offset(), Q.H(), A, &Q );
+            else
+                internal::ApplyPackedReflectorsRUHB
+                ( Q.Offset(), Q.H(), A, &Q );
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename R>
+inline void
+ApplyPackedReflectors
+( LeftOrRight side, ForwardOrBackward order, Conjugation conjugation,
+  const PackedReflectors<Complex<R> >& Q, DistMatrix<Complex<R> >& A )
+{
+#ifndef RELEASE
+    PushCallStack("ApplyPackedReflectors");
+#endif
+    if( side == LEFT )
+    {
+        if( Q.Uplo() == LOWER )
+        {
+            if( Q.Dir() == VERTICAL && order == FORWARD )
+                internal::ApplyPackedReflectorsLLVF
+                ( conjugation, Q.Offset(), Q.H(), Q.t(), A, &Q );
+            else if( Q.Dir() == VERTICAL )
+                internal::ApplyPackedReflectorsLLVB
+                ( conjugation, Q.Offset(), Q.H(), Q.t(), A, &Q );
+            else if( order == FORWARD )
+                internal::ApplyPackedReflectorsLLHF
+                ( conjugation, Q.Offset(), Q.H(), Q.t(), A, &Q );
+            else
+                internal::ApplyPackedReflectorsLLHB
+                ( conjugation, Q.Offset(), Q.H(), Q.t(), A, &Q );
+        }
+        else
+        {
+            if( Q.Dir() == VERTICAL && order == FORWARD )
+                internal::ApplyPackedReflectorsLUVF
+                ( conjugation, Q.Offset(), Q.H(), Q.t(), A, &Q );
+            else if( Q.Dir() == VERTICAL )
+                internal::ApplyPackedReflectorsLUVB
+                ( conjugation, Q.Offset(), Q.H(), Q.t(), A, &Q );
+            else if( order == FORWARD )
+                internal::ApplyPackedReflectorsLUHF
+                ( conjugation, Q.Offset(), Q.H(), Q.t(), A, &Q );
+            else
+                internal::ApplyPackedReflectorsLUHB
+                ( conjugation, Q.Offset(), Q.H(), Q.t(), A, &Q );
+        }
+    }
+    else
+    {
+        if( Q.Uplo() == LOWER )
+        {
+            if( Q.Dir() == VERTICAL && order == FORWARD )
+                internal::ApplyPackedReflectorsRLVF
+                ( conjugation, Q.Offset(), Q.H(), Q.t(), A, &Q );
+            else if( Q.Dir() == VERTICAL )
+                internal::ApplyPackedReflectorsRLVB
+                ( conjugation, Q.Offset(), Q.H(), Q.t(), A, &Q );
+            else if( order == FORWARD )
+                internal::ApplyPackedReflectorsRLHF
+                ( conjugation, Q.Offset(), Q.H(), Q.t(), A, &Q );
+            else
+                internal::ApplyPackedReflectorsRLHB
+                ( conjugation, Q.Offset(), Q.H(), Q.t(), A, &Q );
+        }
+        else
+        {
+            if( Q.Dir() == VERTICAL && order == FORWARD )
+                internal::ApplyPackedReflectorsRUVF
+                ( conjugation, Q.Offset(), Q.H(), Q.t(), A, &Q );
+            else if( Q.Dir() == VERTICAL )
+                internal::ApplyPackedReflectorsRUVB
+                ( conjugation, Q.Offset(), Q.H(), Q.t(), A, &Q );
+            else if( order == FORWARD )
+                internal::ApplyPackedReflectorsRUHF
+                ( conjugation, Q.Offset(), Q.H(), Q.t(), A, &Q );
+            else
+                internal::ApplyPackedReflectorsRUHB
+                ( conjugation, Q.Offset(), Q.H(), Q.t(), A, &Q );
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 } // namespace elem
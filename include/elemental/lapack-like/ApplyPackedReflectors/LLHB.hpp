@@ -100,7 +100,8 @@ inline void
 ApplyPackedReflectorsLLHB
 ( int offset, 
   const DistMatrix<R>& H,
-        DistMatrix<R>& A )
+        DistMatrix<R>& A,
+  const PackedReflectors<R>* cache=0 )
 {
 #ifndef RELEASE
     PushCallStack("internal::ApplyPackedReflectorsLLHB");
@@ -157,12 +158,21 @@ ApplyPackedReflectorsLLHB
         SetDiagonalToOne( RIGHT, offset, HPanCopy );
 
         HPan_STAR_VR = HPanCopy;
-        Syrk
-        ( UPPER, NORMAL,
-          R(1), HPan_STAR_VR.LockedLocalMatrix(),
-          R(0), SInv_STAR_STAR.LocalMatrix() );
-        SInv_STAR_STAR.SumOverGrid();
-        HalveMainDiagonal( SInv_STAR_STAR );
+        if( cache == 0 || !cache->FindPanel
+            ( H00.Height()+HPanOffset, 0, HPanHeight, HPanWidth, UPPER,
+              UNCONJUGATED, SInv_STAR_STAR ) )
+        {
+            Syrk
+            ( UPPER, NORMAL,
+              R(1), HPan_STAR_VR.LockedLocalMatrix(),
+              R(0), SInv_STAR_STAR.LocalMatrix() );
+            SInv_STAR_STAR.SumOverGrid();
+            HalveMainDiagonal( SInv_STAR_STAR );
+            if( cache != 0 )
+                cache->StorePanel
+                ( H00.Height()+HPanOffset, 0, HPanHeight, HPanWidth, UPPER,
+                  UNCONJUGATED, SInv_STAR_STAR );
+        }
 
         HPan_STAR_MC = HPan_STAR_VR;
         LocalGemm( NORMAL, NORMAL, R(1), HPan_STAR_MC, ATop, R(0), Z_STAR_MR );
@@ -289,7 +299,8 @@ ApplyPackedReflectorsLLHB
 ( Conjugation conjugation, int offset, 
   const DistMatrix<Complex<R> >& H,
   const DistMatrix<Complex<R>,MD,STAR>& t,
-        DistMatrix<Complex<R> >& A )
+        DistMatrix<Complex<R> >& A,
+  const PackedReflectors<Complex<R> >* cache=0 )
 {
 #ifndef RELEASE
     PushCallStack("internal::ApplyPackedReflectorsLLHB");
@@ -366,13 +377,22 @@ ApplyPackedReflectorsLLHB
         SetDiagonalToOne( RIGHT, offset, HPanCopy );
 
         HPan_STAR_VR = HPanCopy;
-        Herk
-        ( UPPER, NORMAL,
-          C(1), HPan_STAR_VR.LockedLocalMatrix(),
-          C(0), SInv_STAR_STAR.LocalMatrix() );
-        SInv_STAR_STAR.SumOverGrid();
-        t1_STAR_STAR = t1;
-        FixDiagonal( conjugation, t1_STAR_STAR, SInv_STAR_STAR );
+        if( cache == 0 || !cache->FindPanel
+            ( H00.Height()+HPanOffset, 0, HPanHeight, HPanWidth, UPPER,
+              conjugation, SInv_STAR_STAR ) )
+        {
+            Herk
+            ( UPPER, NORMAL,
+              C(1), HPan_STAR_VR.LockedLocalMatrix(),
+              C(0), SInv_STAR_STAR.LocalMatrix() );
+            SInv_STAR_STAR.SumOverGrid();
+            t1_STAR_STAR = t1;
+            FixDiagonal( conjugation, t1_STAR_STAR, SInv_STAR_STAR );
+            if( cache != 0 )
+                cache->StorePanel
+                ( H00.Height()+HPanOffset, 0, HPanHeight, HPanWidth, UPPER,
+                  conjugation, SInv_STAR_STAR );
+        }
 
         HPan_STAR_MC = HPan_STAR_VR;
         LocalGemm( NORMAL, NORMAL, C(1), HPan_STAR_MC, ATop, C(0), Z_STAR_MR );
@@ -118,7 +118,8 @@ inline void
 ApplyPackedReflectorsLLHF
 ( int offset, 
   const DistMatrix<R>& H,
-        DistMatrix<R>& A )
+        DistMatrix<R>& A,
+  const PackedReflectors<R>* cache=0 )
 {
 #ifndef RELEASE
     PushCallStack("internal::ApplyPackedReflectorsLLHF");
@@ -188,12 +189,21 @@ ApplyPackedReflectorsLLHF
         MakeTrapezoidal( RIGHT, LOWER, offset, HPanCopy );
         SetDiagonalToOne( RIGHT, offset, HPanCopy );
         HPan_STAR_VR = HPanCopy;
-        Syrk
-        ( LOWER, NORMAL,
-          R(1), HPan_STAR_VR.LockedLocalMatrix(),
-          R(0), SInv_STAR_STAR.LocalMatrix() );
-        SInv_STAR_STAR.SumOverGrid();
-        HalveMainDiagonal( SInv_STAR_STAR );
+        if( cache == 0 || !cache->FindPanel
+            ( H00.Height()+HPanOffset, 0, HPanHeight, HPanWidth, LOWER,
+              UNCONJUGATED, SInv_STAR_STAR ) )
+        {
+            Syrk
+            ( LOWER, NORMAL,
+              R(1), HPan_STAR_VR.LockedLocalMatrix(),
+              R(0), SInv_STAR_STAR.LocalMatrix() );
+            SInv_STAR_STAR.SumOverGrid();
+            HalveMainDiagonal( SInv_STAR_STAR );
+            if( cache != 0 )
+                cache->StorePanel
+                ( H00.Height()+HPanOffset, 0, HPanHeight, HPanWidth, LOWER,
+                  UNCONJUGATED, SInv_STAR_STAR );
+        }
 
         HPan_STAR_MC = HPan_STAR_VR;
         LocalGemm( NORMAL, NORMAL, R(1), HPan_STAR_MC, ATop, R(0), Z_STAR_MR );
@@ -291,7 +301,7 @@ ApplyPackedReflectorsLLHF
         ( tT,  t0,
          /**/ /**/
                t1,
-          tB,  t2, HPanWidth );
+          tB,  t2, HPanHeight );
 
         RepartitionDown
         ( AT,  A0,
@@ -345,7 +355,8 @@ ApplyPackedReflectorsLLHF
 ( Conjugation conjugation, int offset, 
   const DistMatrix<Complex<R> >& H,
   const DistMatrix<Complex<R>,MD,STAR>& t,
-        DistMatrix<Complex<R> >& A )
+        DistMatrix<Complex<R> >& A,
+  const PackedReflectors<Complex<R> >* cache=0 )
 {
 #ifndef RELEASE
     PushCallStack("internal::ApplyPackedReflectorsLLHF");
@@ -413,7 +424,7 @@ ApplyPackedReflectorsLLHF
         ( tT,  t0,
          /**/ /**/
                t1,
-          tB,  t2, HPanWidth );
+          tB,  t2, HPanHeight );
 
         RepartitionDown
         ( AT,  A0,
@@ -434,13 +445,22 @@ ApplyPackedReflectorsLLHF
         MakeTrapezoidal( RIGHT, LOWER, offset, HPanCopy );
         SetDiagonalToOne( RIGHT, offset, HPanCopy );
         HPan_STAR_VR = HPanCopy;
-        Herk
-        ( LOWER, NORMAL,
-          C(1), HPan_STAR_VR.LockedLocalMatrix(),
-          C(0), SInv_STAR_STAR.LocalMatrix() );
-        SInv_STAR_STAR.SumOverGrid();
-        t1_STAR_STAR = t1;
-        FixDiagonal( conjugation, t1_STAR_STAR, SInv_STAR_STAR );
+        if( cache == 0 || !cache->FindPanel
+            ( H00.Height()+HPanOffset, 0, HPanHeight, HPanWidth, LOWER,
+              conjugation, SInv_STAR_STAR ) )
+        {
+            Herk
+            ( LOWER, NORMAL,
+              C(1), HPan_STAR_VR.LockedLocalMatrix(),
+              C(0), SInv_STAR_STAR.LocalMatrix() );
+            SInv_STAR_STAR.SumOverGrid();
+            t1_STAR_STAR = t1;
+            FixDiagonal( conjugation, t1_STAR_STAR, SInv_STAR_STAR );
+            if( cache != 0 )
+                cache->StorePanel
+                ( H00.Height()+HPanOffset, 0, HPanHeight, HPanWidth, LOWER,
+                  conjugation, SInv_STAR_STAR );
+        }
 
         HPan_STAR_MC = HPan_STAR_VR;
         LocalGemm( NORMAL, NORMAL, C(1), HPan_STAR_MC, ATop, C(0), Z_STAR_MR );
@@ -116,7 +116,8 @@ inline void
 ApplyPackedReflectorsLLVB
 ( int offset, 
   const DistMatrix<R>& H,
-        DistMatrix<R>& A )
+        DistMatrix<R>& A,
+  const PackedReflectors<R>* cache=0 )
 {
 #ifndef RELEASE
     PushCallStack("internal::ApplyPackedReflectorsLLVB");
@@ -183,13 +184,22 @@ ApplyPackedReflectorsLLVB
         MakeTrapezoidal( LEFT, LOWER, offset, HPanCopy );
         SetDiagonalToOne( LEFT, offset, HPanCopy );
 
-        HPan_VC_STAR = HPanCopy;
-        Syrk
-        ( UPPER, TRANSPOSE, 
-          R(1), HPan_VC_STAR.LockedLocalMatrix(),
-          R(0), SInv_STAR_STAR.LocalMatrix() );     
-        SInv_STAR_STAR.SumOverGrid();
-        HalveMainDiagonal( SInv_STAR_STAR );
+        if( cache == 0 || !cache->FindPanel
+            ( H00.Height(), H00.Width(), HPanHeight, HPanWidth, UPPER,
+              UNCONJUGATED, SInv_STAR_STAR ) )
+        {
+            HPan_VC_STAR = HPanCopy;
+            Syrk
+            ( UPPER, TRANSPOSE, 
+              R(1), HPan_VC_STAR.LockedLocalMatrix(),
+              R(0), SInv_STAR_STAR.LocalMatrix() );     
+            SInv_STAR_STAR.SumOverGrid();
+            HalveMainDiagonal( SInv_STAR_STAR );
+            if( cache != 0 )
+                cache->StorePanel
+                ( H00.Height(), H00.Width(), HPanHeight, HPanWidth, UPPER,
+                  UNCONJUGATED, SInv_STAR_STAR );
+        }
 
         HPan_MC_STAR = HPanCopy;
         LocalGemm
@@ -340,7 +350,8 @@ ApplyPackedReflectorsLLVB
 ( Conjugation conjugation, int offset, 
   const DistMatrix<Complex<R> >& H,
   const DistMatrix<Complex<R>,MD,STAR>& t,
-        DistMatrix<Complex<R> >& A )
+        DistMatrix<Complex<R> >& A,
+  const PackedReflectors<Complex<R> >* cache=0 )
 {
 #ifndef RELEASE
     PushCallStack("internal::ApplyPackedReflectorsLLVB");
@@ -426,14 +437,23 @@ ApplyPackedReflectorsLLVB
         MakeTrapezoidal( LEFT, LOWER, offset, HPanCopy );
         SetDiagonalToOne( LEFT, offset, HPanCopy );
 
-        HPan_VC_STAR = HPanCopy;
-        Herk
-        ( UPPER, ADJOINT, 
-          C(1), HPan_VC_STAR.LockedLocalMatrix(),
-          C(0), SInv_STAR_STAR.LocalMatrix() );     
-        SInv_STAR_STAR.SumOverGrid();
-        t1_STAR_STAR = t1;
-        FixDiagonal( conjugation, t1_STAR_STAR, SInv_STAR_STAR );
+        if( cache == 0 || !cache->FindPanel
+            ( H00.Height(), H00.Width(), HPanHeight, HPanWidth, UPPER,
+              conjugation, SInv_STAR_STAR ) )
+        {
+            HPan_VC_STAR = HPanCopy;
+            Herk
+            ( UPPER, ADJOINT, 
+              C(1), HPan_VC_STAR.LockedLocalMatrix(),
+              C(0), SInv_STAR_STAR.LocalMatrix() );     
+            SInv_STAR_STAR.SumOverGrid();
+            t1_STAR_STAR = t1;
+            FixDiagonal( conjugation, t1_STAR_STAR, SInv_STAR_STAR );
+            if( cache != 0 )
+                cache->StorePanel
+                ( H00.Height(), H00.Width(), HPanHeight, HPanWidth, UPPER,
+                  conjugation, SInv_STAR_STAR );
+        }
 
         HPan_MC_STAR = HPanCopy;
         LocalGemm
@@ -112,7 +112,8 @@ inline void
 ApplyPackedReflectorsLLVF
 ( int offset, 
   const DistMatrix<R>& H,
-        DistMatrix<R>& A )
+        DistMatrix<R>& A,
+  const PackedReflectors<R>* cache=0 )
 {
 #ifndef RELEASE
     PushCallStack("internal::ApplyPackedReflectorsLLVF");
@@ -175,13 +176,22 @@ ApplyPackedReflectorsLLVF
         MakeTrapezoidal( LEFT, LOWER, offset, HPanCopy );
         SetDiagonalToOne( LEFT, offset, HPanCopy );
 
-        HPan_VC_STAR = HPanCopy;
-        Syrk
-        ( LOWER, TRANSPOSE, 
-          R(1), HPan_VC_STAR.LockedLocalMatrix(),
-          R(0), SInv_STAR_STAR.LocalMatrix() );     
-        SInv_STAR_STAR.SumOverGrid();
-        HalveMainDiagonal( SInv_STAR_STAR );
+        if( cache == 0 || !cache->FindPanel
+            ( H00.Height(), H00.Width(), HPanHeight, HPanWidth, LOWER,
+              UNCONJUGATED, SInv_STAR_STAR ) )
+        {
+            HPan_VC_STAR = HPanCopy;
+            Syrk
+            ( LOWER, TRANSPOSE, 
+              R(1), HPan_VC_STAR.LockedLocalMatrix(),
+              R(0), SInv_STAR_STAR.LocalMatrix() );     
+            SInv_STAR_STAR.SumOverGrid();
+            HalveMainDiagonal( SInv_STAR_STAR );
+            if( cache != 0 )
+                cache->StorePanel
+                ( H00.Height(), H00.Width(), HPanHeight, HPanWidth, LOWER,
+                  UNCONJUGATED, SInv_STAR_STAR );
+        }
 
         HPan_MC_STAR = HPanCopy;
         LocalGemm( TRANSPOSE, NORMAL, R(1), HPan_MC_STAR, AB, R(0), Z_STAR_MR );
@@ -326,7 +336,8 @@ ApplyPackedReflectorsLLVF
 ( Conjugation conjugation, int offset, 
   const DistMatrix<Complex<R> >& H,
   const DistMatrix<Complex<R>,MD,STAR>& t,
-        DistMatrix<Complex<R> >& A )
+        DistMatrix<Complex<R> >& A,
+  const PackedReflectors<Complex<R> >* cache=0 )
 {
 #ifndef RELEASE
     PushCallStack("internal::ApplyPackedReflectorsLLVF");
@@ -409,14 +420,23 @@ ApplyPackedReflectorsLLVF
         MakeTrapezoidal( LEFT, LOWER, offset, HPanCopy );
         SetDiagonalToOne( LEFT, offset, HPanCopy );
 
-        HPan_VC_STAR = HPanCopy;
-        Herk
-        ( LOWER, ADJOINT, 
-          C(1), HPan_VC_STAR.LockedLocalMatrix(),
-          C(0), SInv_STAR_STAR.LocalMatrix() );     
-        SInv_STAR_STAR.SumOverGrid();
-        t1_STAR_STAR = t1;
-        FixDiagonal( conjugation, t1_STAR_STAR, SInv_STAR_STAR );
+        if( cache == 0 || !cache->FindPanel
+            ( H00.Height(), H00.Width(), HPanHeight, HPanWidth, LOWER,
+              conjugation, SInv_STAR_STAR ) )
+        {
+            HPan_VC_STAR = HPanCopy;
+            Herk
+            ( LOWER, ADJOINT, 
+              C(1), HPan_VC_STAR.LockedLocalMatrix(),
+              C(0), SInv_STAR_STAR.LocalMatrix() );     
+            SInv_STAR_STAR.SumOverGrid();
+            t1_STAR_STAR = t1;
+            FixDiagonal( conjugation, t1_STAR_STAR, SInv_STAR_STAR );
+            if( cache != 0 )
+                cache->StorePanel
+                ( H00.Height(), H00.Width(), HPanHeight, HPanWidth, LOWER,
+                  conjugation, SInv_STAR_STAR );
+        }
 
         HPan_MC_STAR = HPanCopy;
         LocalGemm( ADJOINT, NORMAL, C(1), HPan_MC_STAR, AB, C(0), Z_STAR_MR );
@@ -114,7 +114,8 @@ inline void
 ApplyPackedReflectorsLUHF
 ( int offset, 
   const DistMatrix<R>& H,
-        DistMatrix<R>& A )
+        DistMatrix<R>& A,
+  const PackedReflectors<R>* cache=0 )
 {
 #ifndef RELEASE
     PushCallStack("internal::ApplyPackedReflectorsLUHF");
@@ -179,12 +180,21 @@ ApplyPackedReflectorsLUHF
         SetDiagonalToOne( LEFT, offset, HPanCopy );
 
         HPan_STAR_VR = HPanCopy;
-        Syrk
-        ( LOWER, NORMAL,
-          R(1), HPan_STAR_VR.LockedLocalMatrix(),
-          R(0), SInv_STAR_STAR.LocalMatrix() );
-        SInv_STAR_STAR.SumOverGrid();
-        HalveMainDiagonal( SInv_STAR_STAR );
+        if( cache == 0 || !cache->FindPanel
+            ( H00.Height(), H00.Width(), HPanHeight, HPanWidth, LOWER,
+              UNCONJUGATED, SInv_STAR_STAR ) )
+        {
+            Syrk
+            ( LOWER, NORMAL,
+              R(1), HPan_STAR_VR.LockedLocalMatrix(),
+              R(0), SInv_STAR_STAR.LocalMatrix() );
+            SInv_STAR_STAR.SumOverGrid();
+            HalveMainDiagonal( SInv_STAR_STAR );
+            if( cache != 0 )
+                cache->StorePanel
+                ( H00.Height(), H00.Width(), HPanHeight, HPanWidth, LOWER,
+                  UNCONJUGATED, SInv_STAR_STAR );
+        }
 
         HPan_STAR_MC = HPan_STAR_VR;
         LocalGemm( NORMAL, NORMAL, R(1), HPan_STAR_MC, AB, R(0), Z_STAR_MR );
@@ -331,7 +341,8 @@ ApplyPackedReflectorsLUHF
 ( Conjugation conjugation, int offset, 
   const DistMatrix<Complex<R> >& H,
   const DistMatrix<Complex<R>,MD,STAR>& t,
-        DistMatrix<Complex<R> >& A )
+        DistMatrix<Complex<R> >& A,
+  const PackedReflectors<Complex<R> >* cache=0 )
 {
 #ifndef RELEASE
     PushCallStack("internal::ApplyPackedReflectorsLUHF");
@@ -416,13 +427,22 @@ ApplyPackedReflectorsLUHF
         SetDiagonalToOne( LEFT, offset, HPanCopy );
 
         HPan_STAR_VR = HPanCopy;
-        Herk
-        ( LOWER, NORMAL,
-          C(1), HPan_STAR_VR.LockedLocalMatrix(),
-          C(0), SInv_STAR_STAR.LocalMatrix() );
-        SInv_STAR_STAR.SumOverGrid();
-        t1_STAR_STAR = t1;
-        FixDiagonal( conjugation, t1_STAR_STAR, SInv_STAR_STAR );
+        if( cache == 0 || !cache->FindPanel
+            ( H00.Height(), H00.Width(), HPanHeight, HPanWidth, LOWER,
+              conjugation, SInv_STAR_STAR ) )
+        {
+            Herk
+            ( LOWER, NORMAL,
+              C(1), HPan_STAR_VR.LockedLocalMatrix(),
+              C(0), SInv_STAR_STAR.LocalMatrix() );
+            SInv_STAR_STAR.SumOverGrid();
+            t1_STAR_STAR = t1;
+            FixDiagonal( conjugation, t1_STAR_STAR, SInv_STAR_STAR );
+            if( cache != 0 )
+                cache->StorePanel
+                ( H00.Height(), H00.Width(), HPanHeight, HPanWidth, LOWER,
+                  conjugation, SInv_STAR_STAR );
+        }
 
         HPan_STAR_MC = HPan_STAR_VR;
         LocalGemm( NORMAL, NORMAL, C(1), HPan_STAR_MC, AB, C(0), Z_STAR_MR );
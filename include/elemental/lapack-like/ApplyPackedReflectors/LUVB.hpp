@@ -117,7 +117,8 @@ inline void
 ApplyPackedReflectorsLUVB
 ( int offset, 
   const DistMatrix<R>& H,
-        DistMatrix<R>& A )
+        DistMatrix<R>& A,
+  const PackedReflectors<R>* cache=0 )
 {
 #ifndef RELEASE
     PushCallStack("internal::ApplyPackedReflectorsLUVB");
@@ -185,13 +186,22 @@ ApplyPackedReflectorsLUVB
         MakeTrapezoidal( RIGHT, UPPER, offset, HPanCopy );
         SetDiagonalToOne( RIGHT, offset, HPanCopy );
 
-        HPan_VC_STAR = HPanCopy;
-        Syrk
-        ( UPPER, TRANSPOSE, 
-          R(1), HPan_VC_STAR.LockedLocalMatrix(),
-          R(0), SInv_STAR_STAR.LocalMatrix() );     
-        SInv_STAR_STAR.SumOverGrid();
-        HalveMainDiagonal( SInv_STAR_STAR );
+        if( cache == 0 || !cache->FindPanel
+            ( 0, H00.Width()+HPanOffset, HPanHeight, HPanWidth, UPPER,
+              UNCONJUGATED, SInv_STAR_STAR ) )
+        {
+            HPan_VC_STAR = HPanCopy;
+            Syrk
+            ( UPPER, TRANSPOSE, 
+              R(1), HPan_VC_STAR.LockedLocalMatrix(),
+              R(0), SInv_STAR_STAR.LocalMatrix() );     
+            SInv_STAR_STAR.SumOverGrid();
+            HalveMainDiagonal( SInv_STAR_STAR );
+            if( cache != 0 )
+                cache->StorePanel
+                ( 0, H00.Width()+HPanOffset, HPanHeight, HPanWidth, UPPER,
+                  UNCONJUGATED, SInv_STAR_STAR );
+        }
 
         HPan_MC_STAR = HPanCopy;
         LocalGemm
@@ -342,7 +352,8 @@ ApplyPackedReflectorsLUVB
 ( Conjugation conjugation, int offset, 
   const DistMatrix<Complex<R> >& H,
   const DistMatrix<Complex<R>,MD,STAR>& t,
-        DistMatrix<Complex<R> >& A )
+        DistMatrix<Complex<R> >& A,
+  const PackedReflectors<Complex<R> >* cache=0 )
 {
 #ifndef RELEASE
     PushCallStack("internal::ApplyPackedReflectorsLUVB");
@@ -430,14 +441,23 @@ ApplyPackedReflectorsLUVB
         MakeTrapezoidal( RIGHT, UPPER, offset, HPanCopy );
         SetDiagonalToOne( RIGHT, offset, HPanCopy );
 
-        HPan_VC_STAR = HPanCopy;
-        Herk
-        ( UPPER, ADJOINT, 
-          C(1), HPan_VC_STAR.LockedLocalMatrix(),
-          C(0), SInv_STAR_STAR.LocalMatrix() );
-        SInv_STAR_STAR.SumOverGrid();
-        t1_STAR_STAR = t1;
-        FixDiagonal( conjugation, t1_STAR_STAR, SInv_STAR_STAR );
+        if( cache == 0 || !cache->FindPanel
+            ( 0, H00.Width()+HPanOffset, HPanHeight, HPanWidth, UPPER,
+              conjugation, SInv_STAR_STAR ) )
+        {
+            HPan_VC_STAR = HPanCopy;
+            Herk
+            ( UPPER, ADJOINT, 
+              C(1), HPan_VC_STAR.LockedLocalMatrix(),
+              C(0), SInv_STAR_STAR.LocalMatrix() );
+            SInv_STAR_STAR.SumOverGrid();
+            t1_STAR_STAR = t1;
+            FixDiagonal( conjugation, t1_STAR_STAR, SInv_STAR_STAR );
+            if( cache != 0 )
+                cache->StorePanel
+                ( 0, H00.Width()+HPanOffset, HPanHeight, HPanWidth, UPPER,
+                  conjugation, SInv_STAR_STAR );
+        }
 
         HPan_MC_STAR = HPanCopy;
         LocalGemm( ADJOINT, NORMAL, C(1), HPan_MC_STAR, ATop, C(0), Z_STAR_MR );
@@ -99,7 +99,8 @@ inline void
 ApplyPackedReflectorsRLHF
 ( int offset, 
   const DistMatrix<R>& H,
-        DistMatrix<R>& A )
+        DistMatrix<R>& A,
+  const PackedReflectors<R>* cache=0 )
 {
 #ifndef RELEASE
     PushCallStack("internal::ApplyPackedReflectorsRLHF");
@@ -156,12 +157,21 @@ ApplyPackedReflectorsRLHF
         SetDiagonalToOne( RIGHT, offset, HPanCopy );
 
         HPan_STAR_VR = HPanCopy;
-        Syrk
-        ( UPPER, NORMAL,
-          R(1), HPan_STAR_VR.LockedLocalMatrix(),
-          R(0), SInv_STAR_STAR.LocalMatrix() );
-        SInv_STAR_STAR.SumOverGrid();
-        HalveMainDiagonal( SInv_STAR_STAR );
+        if( cache == 0 || !cache->FindPanel
+            ( H00.Height()+HPanOffset, 0, HPanHeight, HPanWidth, UPPER,
+              UNCONJUGATED, SInv_STAR_STAR ) )
+        {
+            Syrk
+            ( UPPER, NORMAL,
+              R(1), HPan_STAR_VR.LockedLocalMatrix(),
+              R(0), SInv_STAR_STAR.LocalMatrix() );
+            SInv_STAR_STAR.SumOverGrid();
+            HalveMainDiagonal( SInv_STAR_STAR );
+            if( cache != 0 )
+                cache->StorePanel
+                ( H00.Height()+HPanOffset, 0, HPanHeight, HPanWidth, UPPER,
+                  UNCONJUGATED, SInv_STAR_STAR );
+        }
 
         HPan_STAR_MR = HPan_STAR_VR;
         LocalGemm
@@ -292,7 +302,8 @@ ApplyPackedReflectorsRLHF
 ( Conjugation conjugation, int offset, 
   const DistMatrix<Complex<R> >& H,
   const DistMatrix<Complex<R>,MD,STAR>& t,
-        DistMatrix<Complex<R> >& A )
+        DistMatrix<Complex<R> >& A,
+  const PackedReflectors<Complex<R> >* cache=0 )
 {
 #ifndef RELEASE
     PushCallStack("internal::ApplyPackedReflectorsRLHF");
@@ -369,13 +380,22 @@ ApplyPackedReflectorsRLHF
         SetDiagonalToOne( RIGHT, offset, HPanCopy );
 
         HPan_STAR_VR = HPanCopy;
-        Herk
-        ( UPPER, NORMAL,
-          C(1), HPan_STAR_VR.LockedLocalMatrix(),
-          C(0), SInv_STAR_STAR.LocalMatrix() );
-        SInv_STAR_STAR.SumOverGrid();
-        t1_STAR_STAR = t1;
-        FixDiagonal( conjugation, t1_STAR_STAR, SInv_STAR_STAR );
+        if( cache == 0 || !cache->FindPanel
+            ( H00.Height()+HPanOffset, 0, HPanHeight, HPanWidth, UPPER,
+              conjugation, SInv_STAR_STAR ) )
+        {
+            Herk
+            ( UPPER, NORMAL,
+              C(1), HPan_STAR_VR.LockedLocalMatrix(),
+              C(0), SInv_STAR_STAR.LocalMatrix() );
+            SInv_STAR_STAR.SumOverGrid();
+            t1_STAR_STAR = t1;
+            FixDiagonal( conjugation, t1_STAR_STAR, SInv_STAR_STAR );
+            if( cache != 0 )
+                cache->StorePanel
+                ( H00.Height()+HPanOffset, 0, HPanHeight, HPanWidth, UPPER,
+                  conjugation, SInv_STAR_STAR );
+        }
 
         HPan_STAR_MR = HPan_STAR_VR;
         LocalGemm
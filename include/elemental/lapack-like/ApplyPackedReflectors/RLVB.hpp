@@ -98,7 +98,8 @@ inline void
 ApplyPackedReflectorsRLVB
 ( int offset, 
   const DistMatrix<R>& H,
-        DistMatrix<R>& A )
+        DistMatrix<R>& A,
+  const PackedReflectors<R>* cache=0 )
 {
 #ifndef RELEASE
     PushCallStack("internal::ApplyPackedReflectorsRLVB");
@@ -154,12 +155,21 @@ ApplyPackedReflectorsRLVB
         SetDiagonalToOne( LEFT, offset, HPanCopy );
 
         HPan_VC_STAR = HPanCopy;
-        Syrk
-        ( LOWER, TRANSPOSE, 
-          R(1), HPan_VC_STAR.LockedLocalMatrix(),
-          R(0), SInv_STAR_STAR.LocalMatrix() );     
-        SInv_STAR_STAR.SumOverGrid();
-        HalveMainDiagonal( SInv_STAR_STAR );
+        if( cache == 0 || !cache->FindPanel
+            ( H00.Height(), H00.Width(), HPanHeight, HPanWidth, LOWER,
+              UNCONJUGATED, SInv_STAR_STAR ) )
+        {
+            Syrk
+            ( LOWER, TRANSPOSE, 
+              R(1), HPan_VC_STAR.LockedLocalMatrix(),
+              R(0), SInv_STAR_STAR.LocalMatrix() );     
+            SInv_STAR_STAR.SumOverGrid();
+            HalveMainDiagonal( SInv_STAR_STAR );
+            if( cache != 0 )
+                cache->StorePanel
+                ( H00.Height(), H00.Width(), HPanHeight, HPanWidth, LOWER,
+                  UNCONJUGATED, SInv_STAR_STAR );
+        }
 
         HPan_MR_STAR = HPan_VC_STAR;
         LocalGemm
@@ -289,7 +299,8 @@ ApplyPackedReflectorsRLVB
 ( Conjugation conjugation, int offset, 
   const DistMatrix<Complex<R> >& H,
   const DistMatrix<Complex<R>,MD,STAR>& t,
-        DistMatrix<Complex<R> >& A )
+        DistMatrix<Complex<R> >& A,
+  const PackedReflectors<Complex<R> >* cache=0 )
 {
 #ifndef RELEASE
     PushCallStack("internal::ApplyPackedReflectorsRLVB");
@@ -365,13 +376,22 @@ ApplyPackedReflectorsRLVB
         SetDiagonalToOne( LEFT, offset, HPanCopy );
 
         HPan_VC_STAR = HPanCopy;
-        Herk
-        ( LOWER, ADJOINT, 
-          C(1), HPan_VC_STAR.LockedLocalMatrix(),
-          C(0), SInv_STAR_STAR.LocalMatrix() );     
-        SInv_STAR_STAR.SumOverGrid();
-        t1_STAR_STAR = t1;
-        FixDiagonal( conjugation, t1_STAR_STAR, SInv_STAR_STAR );
+        if( cache == 0 || !cache->FindPanel
+            ( H00.Height(), H00.Width(), HPanHeight, HPanWidth, LOWER,
+              conjugation, SInv_STAR_STAR ) )
+        {
+            Herk
+            ( LOWER, ADJOINT, 
+              C(1), HPan_VC_STAR.LockedLocalMatrix(),
+              C(0), SInv_STAR_STAR.LocalMatrix() );     
+            SInv_STAR_STAR.SumOverGrid();
+            t1_STAR_STAR = t1;
+            FixDiagonal( conjugation, t1_STAR_STAR, SInv_STAR_STAR );
+            if( cache != 0 )
+                cache->StorePanel
+                ( H00.Height(), H00.Width(), HPanHeight, HPanWidth, LOWER,
+                  conjugation, SInv_STAR_STAR );
+        }
 
         HPan_MR_STAR = HPan_VC_STAR;
         LocalGemm
@@ -0,0 +1,96 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace internal {
+
+template<typename R>
+inline void
+ApplyBandReductionReflectors
+( int bandwidth, const DistMatrix<R>& H, const DistMatrix<R,STAR,STAR>& t,
+  DistMatrix<R>& A )
+{
+    ApplyPackedReflectors
+    ( LEFT, LOWER, VERTICAL, BACKWARD, -bandwidth, H, A );
+}
+
+template<typename R>
+inline void
+ApplyBandReductionReflectors
+( int bandwidth, const DistMatrix<Complex<R> >& H,
+  const DistMatrix<Complex<R>,STAR,STAR>& t, DistMatrix<Complex<R> >& A )
+{
+    ApplyPackedReflectors
+    ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED, -bandwidth, H, t, A );
+}
+
+} // namespace internal
+
+template<typename F>
+inline void
+ApplyTwoStageReflectors
+( int bandwidth, const DistMatrix<F>& H, const DistMatrix<F,STAR,STAR>& t,
+  const DistMatrix<F,STAR,VR>& V, const DistMatrix<F,STAR,VR>& tau,
+  DistMatrix<F>& A )
+{
+#ifndef RELEASE
+    PushCallStack("ApplyTwoStageReflectors");
+    if( H.Grid() != A.Grid() || V.Grid() != A.Grid() )
+        throw std::logic_error
+        ("{H,V,A} must be distributed over the same grid");
+    if( H.Height() != A.Height() || V.Height() != A.Height() )
+        throw std::logic_error
+        ("Height of transforms must equal height of target matrix");
+#endif
+    const Grid& g = H.Grid();
+    const int n = H.Height();
+    const int numSweeps = V.Width();
+
+    // Apply the transforms from the bulge chasing with each process owning
+    // entire columns of A, gathering blocks of sweeps in reverse order
+    DistMatrix<F,STAR,VR> A_STAR_VR( A );
+    Matrix<F>& ALocal = A_STAR_VR.LocalMatrix();
+    DistMatrix<F,STAR,VR> V1(g), tau1(g);
+    DistMatrix<F,STAR,STAR> V1_STAR_STAR(g), tau1_STAR_STAR(g);
+    Matrix<F> v, ARows, y;
+    const int bsize = Blocksize();
+    for( int s0=((numSweeps-1)/bsize)*bsize; s0>=0; s0-=bsize )
+    {
+        const int nb = std::min(bsize,numSweeps-s0);
+        LockedView( V1, V, 0, s0, n, nb );
+        LockedView( tau1, tau, 0, s0, tau.Height(), nb );
+        V1_STAR_STAR = V1;
+        tau1_STAR_STAR = tau1;
+        for( int j=nb-1; j>=0; --j )
+        {
+            // The transforms within a sweep act on disjoint sets of rows
+            int k = 0;
+            for( int i=s0+j+1; i<n; i+=bandwidth, ++k )
+            {
+                const int m = std::min(bandwidth,n-i);
+                const F tauk = tau1_STAR_STAR.GetLocal(k,j);
+                LockedView( v, V1_STAR_STAR.LockedLocalMatrix(), i, j, m, 1 );
+                View( ARows, ALocal, i, 0, m, ALocal.Width() );
+                y.ResizeTo( ARows.Width(), 1 );
+                Gemv( ADJOINT, F(1), ARows, v, F(0), y );
+                Ger( -tauk, v, y, ARows );
+            }
+        }
+    }
+    A = A_STAR_VR;
+
+    // Apply the transforms from the reduction to banded form
+    if( bandwidth < n )
+        internal::ApplyBandReductionReflectors( bandwidth, H, t, A );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
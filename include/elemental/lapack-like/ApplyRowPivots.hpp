@@ -147,6 +147,63 @@ ApplyInverseRowPivots
 #endif
 }
 
+template<typename F>
+inline void
+ApplyRowPivots
+( Matrix<F>& A,
+  const std::vector<int>& image,
+  const std::vector<int>& preimage )
+{
+    const int b = image.size();
+#ifndef RELEASE
+    PushCallStack("ApplyRowPivots");
+    if( A.Height() < b || b != (int)preimage.size() )
+        throw std::logic_error
+        ("image and preimage must be vectors of equal length that are not "
+         "taller than A.");
+#endif
+    const int width = A.Width();
+    if( A.Height() == 0 || width == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    // Save the top b rows, pull the image into them, and then send the saved
+    // rows which leave the top block to their destinations
+    const int ldim = A.LDim();
+    Matrix<F> ATCopy( b, width );
+    for( int j=0; j<width; ++j )
+        MemCopy( ATCopy.Buffer(0,j), A.LockedBuffer(0,j), b );
+    for( int i=0; i<b; ++i )
+    {
+        const int k = image[i];
+        const F* source = ( k < b ? ATCopy.LockedBuffer(k,0)
+                                  : A.LockedBuffer(k,0) );
+        const int sourceLDim = ( k < b ? ATCopy.LDim() : ldim );
+        F* Ai = A.Buffer(i,0);
+        for( int j=0; j<width; ++j )
+            Ai[j*ldim] = source[j*sourceLDim];
+    }
+    for( int i=0; i<b; ++i )
+    {
+        const int k = preimage[i];
+        if( k >= b )
+        {
+            const F* source = ATCopy.LockedBuffer(i,0);
+            const int sourceLDim = ATCopy.LDim();
+            F* Ak = A.Buffer(k,0);
+            for( int j=0; j<width; ++j )
+                Ak[j*ldim] = source[j*sourceLDim];
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 template<typename F> 
 inline void
 ApplyRowPivots
@@ -0,0 +1,114 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+// See D. O'Leary, "The block conjugate gradient algorithm and related
+// methods", Linear Algebra and its Applications, Vol. 29, pp. 293--322, 1980.
+
+template<typename F,class Preconditioner>
+inline int
+BlockCG
+( const DistSparseMatrix<F>& A, const DistMatrix<F,VC,STAR>& B,
+  DistMatrix<F,VC,STAR>& X, const Preconditioner& M,
+  typename Base<F>::type relTol, int maxIts )
+{
+#ifndef RELEASE
+    PushCallStack("BlockCG");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( B.Height() != A.Height() || X.Height() != A.Height() ||
+        X.Width() != B.Width() )
+        throw std::logic_error("Nonconformal BlockCG");
+    if( B.ColAlignment() != 0 || X.ColAlignment() != 0 )
+        throw std::logic_error("B and X must have column alignments of zero");
+#endif
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const int k = B.Width();
+
+    std::vector<R> bNorms, rNorms;
+    internal::ColumnNorms( B, bNorms );
+
+    // R := B - A X, Z := inv(M) R, P := Z, and RZ := R^H Z
+    DistMatrix<F,VC,STAR> RMat(g), Z(g), P(g), Q(g);
+    RMat = B;
+    Multiply( F(-1), A, X, F(1), RMat );
+    Z = RMat;
+    M.Apply( Z );
+    P = Z;
+    Zeros( n, k, Q );
+    Matrix<F> RZ, newRZ, PQ, alpha, beta;
+    internal::InnerProducts( RMat, Z, RZ );
+
+    bool converged = false;
+    int it;
+    for( it=0; it<=maxIts; ++it )
+    {
+        internal::ColumnNorms( RMat, rNorms );
+        converged = true;
+        for( int j=0; j<k; ++j )
+            converged = converged && ( rNorms[j] <= relTol*bNorms[j] );
+        if( converged || it == maxIts )
+            break;
+
+        // alpha := inv(P^H A P) (R^H Z), X := X + P alpha, R := R - A P alpha
+        Multiply( F(1), A, P, F(0), Q );
+        internal::InnerProducts( P, Q, PQ );
+        Cholesky( LOWER, PQ );
+        alpha = RZ;
+        SolveAfterCholesky( LOWER, NORMAL, PQ, alpha );
+        Gemm
+        ( NORMAL, NORMAL,
+          F(1), P.LockedLocalMatrix(), alpha, F(1), X.LocalMatrix() );
+        Gemm
+        ( NORMAL, NORMAL,
+          F(-1), Q.LockedLocalMatrix(), alpha, F(1), RMat.LocalMatrix() );
+
+        // beta := inv(R_old^H Z_old) (R^H Z) and P := Z + P beta
+        Z = RMat;
+        M.Apply( Z );
+        internal::InnerProducts( RMat, Z, newRZ );
+        beta = newRZ;
+        Cholesky( LOWER, RZ );
+        SolveAfterCholesky( LOWER, NORMAL, RZ, beta );
+        Q = Z;
+        Gemm
+        ( NORMAL, NORMAL,
+          F(1), P.LockedLocalMatrix(), beta, F(1), Q.LocalMatrix() );
+        P = Q;
+        RZ = newRZ;
+    }
+    if( !converged )
+        throw std::runtime_error("BlockCG did not converge");
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return it;
+}
+
+template<typename F>
+inline int
+BlockCG
+( const DistSparseMatrix<F>& A, const DistMatrix<F,VC,STAR>& B,
+  DistMatrix<F,VC,STAR>& X, typename Base<F>::type relTol, int maxIts )
+{
+#ifndef RELEASE
+    PushCallStack("BlockCG");
+#endif
+    const int numIts =
+        BlockCG( A, B, X, IdentityPreconditioner<F>(), relTol, maxIts );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return numIts;
+}
+
+} // namespace elem
@@ -0,0 +1,210 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+namespace internal {
+
+template<typename F>
+inline void
+InnerProducts
+( const DistMatrix<F,VC,STAR>& X, const DistMatrix<F,VC,STAR>& Y,
+  Matrix<F>& Z )
+{
+#ifndef RELEASE
+    PushCallStack("internal::InnerProducts");
+    if( X.Height() != Y.Height() )
+        throw std::logic_error("X and Y must be the same height");
+    if( X.ColAlignment() != Y.ColAlignment() )
+        throw std::logic_error("X and Y must be aligned");
+#endif
+    const int m = X.Width();
+    const int n = Y.Width();
+    Matrix<F> ZLocal;
+    Zeros( m, n, ZLocal );
+    if( X.LocalHeight() > 0 )
+        Gemm
+        ( ADJOINT, NORMAL,
+          F(1), X.LockedLocalMatrix(), Y.LockedLocalMatrix(), F(0), ZLocal );
+    Zeros( m, n, Z );
+    if( m > 0 && n > 0 )
+        mpi::AllReduce
+        ( ZLocal.LockedBuffer(), Z.Buffer(), m*n, mpi::SUM,
+          X.Grid().VCComm() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+ColumnInnerProducts
+( const DistMatrix<F,VC,STAR>& X, const DistMatrix<F,VC,STAR>& Y,
+  std::vector<F>& products )
+{
+#ifndef RELEASE
+    PushCallStack("internal::ColumnInnerProducts");
+    if( X.Height() != Y.Height() || X.Width() != Y.Width() )
+        throw std::logic_error("X and Y must be the same size");
+    if( X.ColAlignment() != Y.ColAlignment() )
+        throw std::logic_error("X and Y must be aligned");
+#endif
+    const int width = X.Width();
+    const int localHeight = X.LocalHeight();
+    std::vector<F> localProducts( width );
+    for( int j=0; j<width; ++j )
+    {
+        const F* x = X.LockedLocalBuffer(0,j);
+        const F* y = Y.LockedLocalBuffer(0,j);
+        F product = 0;
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+            product += Conj(x[iLocal])*y[iLocal];
+        localProducts[j] = product;
+    }
+    products.resize( width );
+    if( width > 0 )
+        mpi::AllReduce
+        ( &localProducts[0], &products[0], width, mpi::SUM,
+          X.Grid().VCComm() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+ColumnNorms
+( const DistMatrix<F,VC,STAR>& X, std::vector<typename Base<F>::type>& norms )
+{
+#ifndef RELEASE
+    PushCallStack("internal::ColumnNorms");
+#endif
+    std::vector<F> products;
+    ColumnInnerProducts( X, X, products );
+    const int width = X.Width();
+    norms.resize( width );
+    for( int j=0; j<width; ++j )
+        norms[j] = Sqrt( RealPart(products[j]) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace internal
+
+template<typename F,class Preconditioner>
+inline int
+CG
+( const DistSparseMatrix<F>& A, const DistMatrix<F,VC,STAR>& B,
+  DistMatrix<F,VC,STAR>& X, const Preconditioner& M,
+  typename Base<F>::type relTol, int maxIts )
+{
+#ifndef RELEASE
+    PushCallStack("CG");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( B.Height() != A.Height() || X.Height() != A.Height() ||
+        X.Width() != B.Width() )
+        throw std::logic_error("Nonconformal CG");
+    if( B.ColAlignment() != 0 || X.ColAlignment() != 0 )
+        throw std::logic_error("B and X must have column alignments of zero");
+#endif
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const int k = B.Width();
+    const int localHeight = X.LocalHeight();
+
+    std::vector<R> bNorms, rNorms;
+    internal::ColumnNorms( B, bNorms );
+
+    // R := B - A X, Z := inv(M) R, and P := Z
+    DistMatrix<F,VC,STAR> RMat(g), Z(g), P(g), Q(g);
+    RMat = B;
+    Multiply( F(-1), A, X, F(1), RMat );
+    Z = RMat;
+    M.Apply( Z );
+    P = Z;
+    Zeros( n, k, Q );
+    std::vector<F> rhos, pqs, newRhos;
+    internal::ColumnInnerProducts( RMat, Z, rhos );
+
+    std::vector<bool> converged( k );
+    int it;
+    for( it=0; it<=maxIts; ++it )
+    {
+        internal::ColumnNorms( RMat, rNorms );
+        bool allConverged = true;
+        for( int j=0; j<k; ++j )
+        {
+            converged[j] = ( rNorms[j] <= relTol*bNorms[j] );
+            allConverged = allConverged && converged[j];
+        }
+        if( allConverged || it == maxIts )
+            break;
+
+        // Q := A P and then update the unconverged columns of X and R
+        Multiply( F(1), A, P, F(0), Q );
+        internal::ColumnInnerProducts( P, Q, pqs );
+        for( int j=0; j<k; ++j )
+        {
+            if( converged[j] )
+                continue;
+            const F alpha = rhos[j] / pqs[j];
+            blas::Axpy
+            ( localHeight, alpha,
+              P.LockedLocalBuffer(0,j), 1, X.LocalBuffer(0,j), 1 );
+            blas::Axpy
+            ( localHeight, -alpha,
+              Q.LockedLocalBuffer(0,j), 1, RMat.LocalBuffer(0,j), 1 );
+        }
+
+        // Z := inv(M) R and then P := Z + P diag(beta)
+        Z = RMat;
+        M.Apply( Z );
+        internal::ColumnInnerProducts( RMat, Z, newRhos );
+        for( int j=0; j<k; ++j )
+        {
+            if( converged[j] )
+                continue;
+            const F beta = newRhos[j] / rhos[j];
+            rhos[j] = newRhos[j];
+            F* p = P.LocalBuffer(0,j);
+            const F* z = Z.LockedLocalBuffer(0,j);
+            for( int iLocal=0; iLocal<localHeight; ++iLocal )
+                p[iLocal] = z[iLocal] + beta*p[iLocal];
+        }
+    }
+    for( int j=0; j<k; ++j )
+        if( !converged[j] )
+            throw std::runtime_error("CG did not converge");
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return it;
+}
+
+template<typename F>
+inline int
+CG
+( const DistSparseMatrix<F>& A, const DistMatrix<F,VC,STAR>& B,
+  DistMatrix<F,VC,STAR>& X, typename Base<F>::type relTol, int maxIts )
+{
+#ifndef RELEASE
+    PushCallStack("CG");
+#endif
+    const int numIts = 
+        CG( A, B, X, IdentityPreconditioner<F>(), relTol, maxIts );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return numIts;
+}
+
+} // namespace elem
@@ -13,6 +13,8 @@
 #include "./Cholesky/UVar2.hpp"
 #include "./Cholesky/UVar3.hpp"
 #include "./Cholesky/UVar3Square.hpp"
+#include "./Cholesky/Batch.hpp"
+#include "./Cholesky/OutOfCore.hpp"
 
 namespace elem {
 
@@ -43,10 +45,11 @@ Cholesky( UpperOrLower uplo, Matrix<F>& A )
     if( A.Height() != A.Width() )
         throw std::logic_error("A must be square");
 #endif
-    if( uplo == LOWER )
-        internal::CholeskyLVar3( A );
-    else
-        internal::CholeskyUVar3( A );
+    // LAPACK's potrf is blocked (and typically recursive and multithreaded
+    // in optimized implementations), which is important since this routine
+    // is on the critical path of the distributed factorizations
+    const char uploChar = UpperOrLowerToChar( uplo );
+    lapack::Cholesky( uploChar, A.Height(), A.Buffer(), A.LDim() );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -0,0 +1,165 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace internal {
+
+// The following kernels work directly on buffers (without the call stack or
+// matrix views) so that they may be run on many small matrices concurrently.
+// Rather than throwing, they return whether or not the matrix was HPD.
+
+template<typename F>
+inline bool
+BatchCholeskyLUnb( int n, F* A, int lda )
+{
+    typedef typename Base<F>::type R;
+    for( int j=0; j<n; ++j )
+    {
+        R alpha = RealPart(A[j+j*lda]);
+        if( alpha <= R(0) )
+            return false;
+        alpha = Sqrt( alpha );
+        A[j+j*lda] = alpha;
+        const R alphaInv = R(1) / alpha;
+        for( int i=j+1; i<n; ++i )
+            A[i+j*lda] *= alphaInv;
+        for( int k=j+1; k<n; ++k )
+        {
+            const F gamma = Conj(A[k+j*lda]);
+            for( int i=k; i<n; ++i )
+                A[i+k*lda] -= A[i+j*lda]*gamma;
+        }
+    }
+    return true;
+}
+
+// Column j of U only depends upon the previous columns of U, which allows for
+// unit-stride dot products
+template<typename F>
+inline bool
+BatchCholeskyUUnb( int n, F* A, int lda )
+{
+    typedef typename Base<F>::type R;
+    for( int j=0; j<n; ++j )
+    {
+        F* a = &A[j*lda];
+        for( int i=0; i<j; ++i )
+        {
+            const F* u = &A[i*lda];
+            F gamma = a[i];
+            for( int k=0; k<i; ++k )
+                gamma -= Conj(u[k])*a[k];
+            a[i] = gamma / u[i];
+        }
+        R alpha = RealPart(a[j]);
+        for( int k=0; k<j; ++k )
+            alpha -= RealPart(Conj(a[k])*a[k]);
+        if( alpha <= R(0) )
+            return false;
+        a[j] = Sqrt( alpha );
+    }
+    return true;
+}
+
+template<typename F>
+inline bool
+BatchCholesky( UpperOrLower uplo, int n, F* A, int lda )
+{
+    const int bsize = SMALL_BATCH_SIZE;
+    if( n <= bsize )
+    {
+        if( uplo == LOWER )
+            return BatchCholeskyLUnb( n, A, lda );
+        else
+            return BatchCholeskyUUnb( n, A, lda );
+    }
+
+    // A right-looking blocked algorithm for larger matrices
+    for( int k=0; k<n; k+=bsize )
+    {
+        const int nb = std::min(bsize,n-k);
+        const int nRest = n-(k+nb);
+        F* A11 = &A[k+k*lda];
+        F* A22 = &A[(k+nb)+(k+nb)*lda];
+        if( uplo == LOWER )
+        {
+            if( !BatchCholeskyLUnb( nb, A11, lda ) )
+                return false;
+            F* A21 = &A[(k+nb)+k*lda];
+            blas::Trsm
+            ( 'R', 'L', 'C', 'N', nRest, nb, F(1), A11, lda, A21, lda );
+            blas::Herk
+            ( 'L', 'N', nRest, nb, F(-1), A21, lda, F(1), A22, lda );
+        }
+        else
+        {
+            if( !BatchCholeskyUUnb( nb, A11, lda ) )
+                return false;
+            F* A12 = &A[k+(k+nb)*lda];
+            blas::Trsm
+            ( 'L', 'U', 'C', 'N', nb, nRest, F(1), A11, lda, A12, lda );
+            blas::Herk
+            ( 'U', 'C', nRest, nb, F(-1), A12, lda, F(1), A22, lda );
+        }
+    }
+    return true;
+}
+
+} // namespace internal
+
+template<typename F>
+inline void
+Cholesky( UpperOrLower uplo, MatrixBatch<F>& A )
+{
+#ifndef RELEASE
+    PushCallStack("Cholesky");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Can only compute Cholesky factors of square "
+                               "matrices");
+#endif
+    const int n = A.Height();
+    const int count = A.Count();
+    const int lda = A.LDim();
+    const int stride = A.Stride();
+    F* ABuffer = A.Buffer();
+    std::vector<char> succeeded( count );
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for
+#endif
+    for( int l=0; l<count; ++l )
+        succeeded[l] = 
+            internal::BatchCholesky( uplo, n, &ABuffer[l*stride], lda );
+    for( int l=0; l<count; ++l )
+    {
+        if( !succeeded[l] )
+        {
+            std::ostringstream msg;
+            msg << "Matrix " << l << " of the batch was not HPD";
+            throw NonHPDMatrixException( msg.str().c_str() );
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+Cholesky( UpperOrLower uplo, DistMatrixBatch<F>& A )
+{
+#ifndef RELEASE
+    PushCallStack("Cholesky");
+#endif
+    Cholesky( uplo, A.LocalBatch() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
@@ -0,0 +1,98 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace internal {
+
+// Each column panel is brought up to date with the previous panels and then
+// factored with the in-core LVar3 (or UVar3) blocked algorithm.
+template<typename F>
+class CholeskyOutOfCoreUpdater
+{
+public:
+    CholeskyOutOfCoreUpdater( UpperOrLower uplo ) : uplo_(uplo) { }
+
+    void Update( int k, DistMatrix<F>& Pk, int j, const DistMatrix<F>& Pj )
+    {
+        const Grid& g = Pk.Grid();
+        const int n = Pk.Height();
+        const int nb = Pk.Width();
+        DistMatrix<F> PjT(g), PjB(g), PkT(g), PkB(g);
+        if( uplo_ == LOWER )
+        {
+            // A(k:n,k:k+nb) -= L(k:n,j:j+nb) L(k:k+nb,j:j+nb)^H
+            LockedView( PjT, Pj, k,    0, nb,     Pj.Width() );
+            LockedView( PjB, Pj, k+nb, 0, n-k-nb, Pj.Width() );
+            View( PkT, Pk, k,    0, nb,     nb );
+            View( PkB, Pk, k+nb, 0, n-k-nb, nb );
+            Herk( LOWER, NORMAL, F(-1), PjT, F(1), PkT );
+            Gemm( NORMAL, ADJOINT, F(-1), PjB, PjT, F(1), PkB );
+        }
+        else
+        {
+            // U(j:j+nbj,k:k+nb) :=
+            //   inv(U(j:j+nbj,j:j+nbj)^H) (A(j:j+nbj,k:k+nb) -
+            //                              U(0:j,j:j+nbj)^H U(0:j,k:k+nb))
+            const int nbj = Pj.Width();
+            LockedView( PjT, Pj, 0, 0, j,   nbj );
+            LockedView( PjB, Pj, j, 0, nbj, nbj );
+            LockedView( PkT, Pk, 0, 0, j,   nb );
+            View( PkB, Pk, j, 0, nbj, nb );
+            if( j > 0 )
+                Gemm( ADJOINT, NORMAL, F(-1), PjT, PkT, F(1), PkB );
+            Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), PjB, PkB );
+        }
+    }
+
+    void Factor( int k, DistMatrix<F>& Pk )
+    {
+        const Grid& g = Pk.Grid();
+        const int n = Pk.Height();
+        const int nb = Pk.Width();
+        DistMatrix<F> Pk01(g), Pk11(g), Pk21(g);
+        View( Pk11, Pk, k, 0, nb, nb );
+        if( uplo_ == LOWER )
+        {
+            View( Pk21, Pk, k+nb, 0, n-k-nb, nb );
+            Cholesky( LOWER, Pk11 );
+            Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), Pk11, Pk21 );
+        }
+        else
+        {
+            LockedView( Pk01, Pk, 0, 0, k, nb );
+            if( k > 0 )
+                Herk( UPPER, ADJOINT, F(-1), Pk01, F(1), Pk11 );
+            Cholesky( UPPER, Pk11 );
+        }
+    }
+
+private:
+    UpperOrLower uplo_;
+};
+
+} // namespace internal
+
+template<typename F>
+inline void
+Cholesky( UpperOrLower uplo, OutOfCoreMatrix<F>& A )
+{
+#ifndef RELEASE
+    PushCallStack("Cholesky");
+    if( A.Height() != A.Width() )
+        throw std::logic_error
+        ("Can only compute Cholesky factor of square matrices");
+#endif
+    internal::CholeskyOutOfCoreUpdater<F> updater( uplo );
+    internal::LeftLookingOutOfCore( A, updater );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
@@ -63,4 +63,69 @@ CholeskySolve( UpperOrLower uplo, DistMatrix<F>& A, DistMatrix<F>& B )
 #endif
 }
 
+template<typename F>
+inline void
+CholeskySolve( UpperOrLower uplo, MatrixBatch<F>& A, MatrixBatch<F>& B )
+{
+#ifndef RELEASE
+    PushCallStack("CholeskySolve");
+    if( A.Width() != B.Height() || A.Count() != B.Count() )
+        throw std::logic_error("A and B do not conform");
+#endif
+    Cholesky( uplo, A );
+
+    const int n = B.Height();
+    const int numRhs = B.Width();
+    const int count = B.Count();
+    const int lda = A.LDim();
+    const int ldb = B.LDim();
+    const int strideA = A.Stride();
+    const int strideB = B.Stride();
+    const F* ABuffer = A.LockedBuffer();
+    F* BBuffer = B.Buffer();
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for
+#endif
+    for( int l=0; l<count; ++l )
+    {
+        const F* AMat = &ABuffer[l*strideA];
+        F* BMat = &BBuffer[l*strideB];
+        if( uplo == LOWER )
+        {
+            // B := inv(L L^H) B = inv(L)^H inv(L) B
+            blas::Trsm
+            ( 'L', 'L', 'N', 'N', n, numRhs, F(1), AMat, lda, BMat, ldb );
+            blas::Trsm
+            ( 'L', 'L', 'C', 'N', n, numRhs, F(1), AMat, lda, BMat, ldb );
+        }
+        else
+        {
+            // B := inv(U^H U) B = inv(U) inv(U)^H B
+            blas::Trsm
+            ( 'L', 'U', 'C', 'N', n, numRhs, F(1), AMat, lda, BMat, ldb );
+            blas::Trsm
+            ( 'L', 'U', 'N', 'N', n, numRhs, F(1), AMat, lda, BMat, ldb );
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+CholeskySolve
+( UpperOrLower uplo, DistMatrixBatch<F>& A, DistMatrixBatch<F>& B )
+{
+#ifndef RELEASE
+    PushCallStack("CholeskySolve");
+    if( A.Grid() != B.Grid() )
+        throw std::logic_error("{A,B} must be distributed over the same grid");
+#endif
+    CholeskySolve( uplo, A.LocalBatch(), B.LocalBatch() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 } // namespace elem
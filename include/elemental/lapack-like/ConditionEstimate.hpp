@@ -0,0 +1,317 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace internal {
+
+// Since the one-norm estimator only manipulates vectors, which are cheap
+// relative to the solves, every process redundantly stores the entire vector
+// and only the solves are distributed.
+
+template<typename F>
+inline void
+ReplicatedToDist( const Matrix<F>& x, DistMatrix<F>& xDist )
+{
+    xDist.ResizeTo( x.Height(), 1 );
+    const int colShift = xDist.ColShift();
+    const int colStride = xDist.ColStride();
+    const int localHeight = xDist.LocalHeight();
+    const int localWidth = xDist.LocalWidth();
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+            xDist.SetLocal
+            ( iLocal, jLocal, x.Get(colShift+iLocal*colStride,0) );
+}
+
+template<typename F>
+inline void
+DistToReplicated( const DistMatrix<F>& xDist, Matrix<F>& x )
+{
+    DistMatrix<F,STAR,STAR> x_STAR_STAR( xDist );
+    x = x_STAR_STAR.LockedLocalMatrix();
+}
+
+// The following overwrite x with inv(op(A)) x given a factorization of A
+
+template<typename F>
+class LUInverseSolver
+{
+public:
+    LUInverseSolver( const Matrix<F>& A, const Matrix<int>& p )
+    : A_(A), p_(p) { }
+
+    void operator()( Orientation orientation, Matrix<F>& x ) const
+    { SolveAfterLU( orientation, A_, p_, x ); }
+
+private:
+    const Matrix<F>& A_;
+    const Matrix<int>& p_;
+};
+
+template<typename F>
+class DistLUInverseSolver
+{
+public:
+    DistLUInverseSolver
+    ( const DistMatrix<F>& A, const DistMatrix<int,VC,STAR>& p )
+    : A_(A), p_(p), xDist_(A.Grid()) { }
+
+    void operator()( Orientation orientation, Matrix<F>& x )
+    {
+        ReplicatedToDist( x, xDist_ );
+        SolveAfterLU( orientation, A_, p_, xDist_ );
+        DistToReplicated( xDist_, x );
+    }
+
+private:
+    const DistMatrix<F>& A_;
+    const DistMatrix<int,VC,STAR>& p_;
+    DistMatrix<F> xDist_;
+};
+
+// A is Hermitian, so the orientation is irrelevant
+template<typename F>
+class CholeskyInverseSolver
+{
+public:
+    CholeskyInverseSolver( UpperOrLower uplo, const Matrix<F>& A )
+    : uplo_(uplo), A_(A) { }
+
+    void operator()( Orientation orientation, Matrix<F>& x ) const
+    { SolveAfterCholesky( uplo_, NORMAL, A_, x ); }
+
+private:
+    UpperOrLower uplo_;
+    const Matrix<F>& A_;
+};
+
+template<typename F>
+class DistCholeskyInverseSolver
+{
+public:
+    DistCholeskyInverseSolver( UpperOrLower uplo, const DistMatrix<F>& A )
+    : uplo_(uplo), A_(A), xDist_(A.Grid()) { }
+
+    void operator()( Orientation orientation, Matrix<F>& x )
+    {
+        ReplicatedToDist( x, xDist_ );
+        SolveAfterCholesky( uplo_, NORMAL, A_, xDist_ );
+        DistToReplicated( xDist_, x );
+    }
+
+private:
+    UpperOrLower uplo_;
+    const DistMatrix<F>& A_;
+    DistMatrix<F> xDist_;
+};
+
+// Overwrite x with the entrywise sign of x, where sign(0) := 1, and return
+// whether or not the result is equal to y
+template<typename F>
+inline bool
+EntrywiseSign( Matrix<F>& x, const Matrix<F>& y )
+{
+    typedef typename Base<F>::type R;
+    const int n = x.Height();
+    bool equal = ( y.Height() == n );
+    for( int i=0; i<n; ++i )
+    {
+        const F alpha = x.Get(i,0);
+        const R alphaAbs = Abs(alpha);
+        const F sign = ( alphaAbs == R(0) ? F(1) : alpha/alphaAbs );
+        x.Set( i, 0, sign );
+        if( equal && y.Get(i,0) != sign )
+            equal = false;
+    }
+    return equal;
+}
+
+// The first index of an entry of maximum magnitude
+template<typename F>
+inline int
+MaxAbsIndex( const Matrix<F>& x )
+{
+    typedef typename Base<F>::type R;
+    int index = 0;
+    R maxAbs = 0;
+    for( int i=0; i<x.Height(); ++i )
+    {
+        const R alphaAbs = Abs(x.Get(i,0));
+        if( alphaAbs > maxAbs )
+        {
+            index = i;
+            maxAbs = alphaAbs;
+        }
+    }
+    return index;
+}
+
+// Hager and Higham's estimate of || inv(A) ||_1 (see LAPACK's xLACN2), which
+// is always a lower bound and usually exact. It requires roughly four to ten
+// solves with either A or A^H.
+template<typename F,class Solver>
+inline typename Base<F>::type
+InverseOneNormEstimate( Solver& solve, int n )
+{
+#ifndef RELEASE
+    PushCallStack("internal::InverseOneNormEstimate");
+#endif
+    typedef typename Base<F>::type R;
+    const int maxIts = 5;
+    R estimate = 0;
+    if( n == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return estimate;
+    }
+
+    Matrix<F> x( n, 1 ), xi;
+    for( int i=0; i<n; ++i )
+        x.Set( i, 0, F(R(1)/R(n)) );
+    solve( NORMAL, x );
+    estimate = Norm( x, ONE_NORM );
+    if( n > 1 )
+    {
+        EntrywiseSign( x, xi );
+        xi = x;
+        solve( ADJOINT, x );
+        int j = MaxAbsIndex( x );
+        for( int it=2; it<=maxIts; ++it )
+        {
+            // x := inv(A) e_j
+            MakeZeros( x );
+            x.Set( j, 0, F(1) );
+            solve( NORMAL, x );
+            const R lastEstimate = estimate;
+            estimate = Norm( x, ONE_NORM );
+
+            // Stop if the sign pattern repeated or the estimate stagnated
+            if( EntrywiseSign( x, xi ) || estimate <= lastEstimate )
+            {
+                estimate = std::max( estimate, lastEstimate );
+                break;
+            }
+            xi = x;
+            solve( ADJOINT, x );
+            const int jLast = j;
+            j = MaxAbsIndex( x );
+            if( Abs(x.Get(jLast,0)) == Abs(x.Get(j,0)) )
+                break;
+        }
+
+        // Guard against the above failing for the canonical counterexamples
+        // by testing a vector with alternating signs and growing magnitudes
+        for( int i=0; i<n; ++i )
+        {
+            const R magnitude = 1 + R(i)/R(n-1);
+            x.Set( i, 0, F( i%2==0 ? magnitude : -magnitude ) );
+        }
+        solve( NORMAL, x );
+        estimate = std::max( estimate, 2*Norm( x, ONE_NORM )/(3*R(n)) );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return estimate;
+}
+
+} // namespace internal
+
+// Estimate the one-norm condition number of A, || A ||_1 || inv(A) ||_1,
+// given || A ||_1 and an LU factorization of A with partial pivoting
+
+template<typename F>
+inline typename Base<F>::type
+ConditionEstimateAfterLU
+( const Matrix<F>& A, const Matrix<int>& p, typename Base<F>::type oneNorm )
+{
+#ifndef RELEASE
+    PushCallStack("ConditionEstimateAfterLU");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( p.Height() != A.Height() )
+        throw std::logic_error("A and p must be the same height");
+#endif
+    internal::LUInverseSolver<F> solve( A, p );
+    const typename Base<F>::type estimate =
+        oneNorm*internal::InverseOneNormEstimate<F>( solve, A.Height() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return estimate;
+}
+
+template<typename F>
+inline typename Base<F>::type
+ConditionEstimateAfterLU
+( const DistMatrix<F>& A, const DistMatrix<int,VC,STAR>& p,
+  typename Base<F>::type oneNorm )
+{
+#ifndef RELEASE
+    PushCallStack("ConditionEstimateAfterLU");
+    if( A.Grid() != p.Grid() )
+        throw std::logic_error("{A,p} must be distributed over the same grid");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( p.Height() != A.Height() )
+        throw std::logic_error("A and p must be the same height");
+#endif
+    internal::DistLUInverseSolver<F> solve( A, p );
+    const typename Base<F>::type estimate =
+        oneNorm*internal::InverseOneNormEstimate<F>( solve, A.Height() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return estimate;
+}
+
+// Estimate the one-norm condition number of an HPD matrix A given || A ||_1
+// and its Cholesky factor
+
+template<typename F>
+inline typename Base<F>::type
+ConditionEstimateAfterCholesky
+( UpperOrLower uplo, const Matrix<F>& A, typename Base<F>::type oneNorm )
+{
+#ifndef RELEASE
+    PushCallStack("ConditionEstimateAfterCholesky");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+#endif
+    internal::CholeskyInverseSolver<F> solve( uplo, A );
+    const typename Base<F>::type estimate =
+        oneNorm*internal::InverseOneNormEstimate<F>( solve, A.Height() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return estimate;
+}
+
+template<typename F>
+inline typename Base<F>::type
+ConditionEstimateAfterCholesky
+( UpperOrLower uplo, const DistMatrix<F>& A, typename Base<F>::type oneNorm )
+{
+#ifndef RELEASE
+    PushCallStack("ConditionEstimateAfterCholesky");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+#endif
+    internal::DistCholeskyInverseSolver<F> solve( uplo, A );
+    const typename Base<F>::type estimate =
+        oneNorm*internal::InverseOneNormEstimate<F>( solve, A.Height() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return estimate;
+}
+
+} // namespace elem
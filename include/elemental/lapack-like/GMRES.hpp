@@ -0,0 +1,173 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+template<typename F,class Preconditioner>
+inline int
+GMRES
+( const DistSparseMatrix<F>& A, const DistMatrix<F,VC,STAR>& B,
+  DistMatrix<F,VC,STAR>& X, const Preconditioner& M,
+  typename Base<F>::type relTol, int restart, int maxIts )
+{
+#ifndef RELEASE
+    PushCallStack("GMRES");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( B.Height() != A.Height() || X.Height() != A.Height() ||
+        X.Width() != B.Width() )
+        throw std::logic_error("Nonconformal GMRES");
+    if( B.ColAlignment() != 0 || X.ColAlignment() != 0 )
+        throw std::logic_error("B and X must have column alignments of zero");
+    if( restart < 1 )
+        throw std::logic_error("Restart length must be positive");
+#endif
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const int k = B.Width();
+
+    DistMatrix<F,VC,STAR> r(g), w(g), V(g), Vi(g), VPrev(g);
+    Matrix<F> H, c, y;
+    std::vector<R> norms, cs( restart );
+    std::vector<F> sn( restart ), gamma( restart+1 );
+    int maxNumIts = 0;
+    for( int j=0; j<k; ++j )
+    {
+        DistMatrix<F,VC,STAR> b(g), x(g);
+        LockedView( b, B, 0, j, n, 1 );
+        View( x, X, 0, j, n, 1 );
+        internal::ColumnNorms( b, norms );
+        const R bNorm = norms[0];
+
+        int numIts = 0;
+        while( true )
+        {
+            // r := b - A x
+            r = b;
+            Multiply( F(-1), A, x, F(1), r );
+            internal::ColumnNorms( r, norms );
+            const R beta = norms[0];
+            if( beta <= relTol*bNorm )
+                break;
+            if( numIts >= maxIts )
+                throw std::runtime_error("GMRES did not converge");
+
+            // Arnoldi with right preconditioning: the columns of V form an
+            // orthonormal basis for the Krylov subspace of A inv(M), and the
+            // upper Hessenberg H is reduced to triangular form with Givens
+            // rotations as it is formed
+            Zeros( n, restart+1, V );
+            Zeros( restart+1, restart, H );
+            View( Vi, V, 0, 0, n, 1 );
+            Vi = r;
+            Scale( F(1)/beta, Vi.LocalMatrix() );
+            gamma.assign( restart+1, F(0) );
+            gamma[0] = beta;
+            int i;
+            for( i=0; i<restart && numIts<maxIts; ++i, ++numIts )
+            {
+                // w := A inv(M) v_i
+                View( Vi, V, 0, i, n, 1 );
+                w = Vi;
+                M.Apply( w );
+                r = w;
+                Multiply( F(1), A, r, F(0), w );
+
+                // Orthogonalize w against v_0, ..., v_i with two passes of
+                // classical Gram-Schmidt, which only require one reduction
+                // each
+                LockedView( VPrev, V, 0, 0, n, i+1 );
+                for( int pass=0; pass<2; ++pass )
+                {
+                    internal::InnerProducts( VPrev, w, c );
+                    Gemm
+                    ( NORMAL, NORMAL,
+                      F(-1), VPrev.LockedLocalMatrix(), c,
+                      F(1), w.LocalMatrix() );
+                    for( int l=0; l<=i; ++l )
+                        H.Update( l, i, c.Get(l,0) );
+                }
+                internal::ColumnNorms( w, norms );
+                const R omega = norms[0];
+                H.Set( i+1, i, omega );
+                if( omega != R(0) )
+                {
+                    View( Vi, V, 0, i+1, n, 1 );
+                    Vi = w;
+                    Scale( F(1)/omega, Vi.LocalMatrix() );
+                }
+
+                // Apply the previous rotations to the new column of H and
+                // then annihilate its subdiagonal entry
+                for( int l=0; l<i; ++l )
+                {
+                    const F eta0 = H.Get(l,i);
+                    const F eta1 = H.Get(l+1,i);
+                    H.Set( l, i, cs[l]*eta0 + sn[l]*eta1 );
+                    H.Set( l+1, i, -Conj(sn[l])*eta0 + cs[l]*eta1 );
+                }
+                F rho;
+                lapack::ComputeGivens
+                ( H.Get(i,i), H.Get(i+1,i), &cs[i], &sn[i], &rho );
+                H.Set( i, i, rho );
+                H.Set( i+1, i, F(0) );
+                gamma[i+1] = -Conj(sn[i])*gamma[i];
+                gamma[i] = cs[i]*gamma[i];
+                if( Abs(gamma[i+1]) <= relTol*bNorm || omega == R(0) )
+                {
+                    ++i;
+                    ++numIts;
+                    break;
+                }
+            }
+
+            // x := x + inv(M) V y, where y solves the triangular system
+            // H(0:i-1,0:i-1) y = gamma(0:i-1)
+            Matrix<F> HTL;
+            LockedView( HTL, H, 0, 0, i, i );
+            Zeros( i, 1, y );
+            for( int l=0; l<i; ++l )
+                y.Set( l, 0, gamma[l] );
+            Trsv( UPPER, NORMAL, NON_UNIT, HTL, y );
+            LockedView( VPrev, V, 0, 0, n, i );
+            Zeros( n, 1, w );
+            Gemm
+            ( NORMAL, NORMAL,
+              F(1), VPrev.LockedLocalMatrix(), y, F(0), w.LocalMatrix() );
+            M.Apply( w );
+            Axpy( F(1), w.LockedLocalMatrix(), x.LocalMatrix() );
+        }
+        maxNumIts = std::max( maxNumIts, numIts );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return maxNumIts;
+}
+
+template<typename F>
+inline int
+GMRES
+( const DistSparseMatrix<F>& A, const DistMatrix<F,VC,STAR>& B,
+  DistMatrix<F,VC,STAR>& X,
+  typename Base<F>::type relTol, int restart, int maxIts )
+{
+#ifndef RELEASE
+    PushCallStack("GMRES");
+#endif
+    const int numIts =
+        GMRES( A, B, X, IdentityPreconditioner<F>(), relTol, restart, maxIts );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return numIts;
+}
+
+} // namespace elem
@@ -7,6 +7,216 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 
+namespace elem {
+
+namespace hermitian_eig {
+
+// The sequential eigensolvers directly call LAPACK's MRRR implementation,
+// which avoids the overhead of the distributed tridiagonalization, PMRRR, and
+// the redistributions of the eigenvectors. If Z is null, then only the 
+// eigenvalues are computed.
+template<typename F>
+inline void
+SequentialEig
+( UpperOrLower uplo, Matrix<F>& A, 
+  Matrix<typename Base<F>::type>& w, Matrix<F>* Z, 
+  char range, typename Base<F>::type vl, typename Base<F>::type vu, 
+  int il, int iu )
+{
+    typedef typename Base<F>::type R;
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+    const int n = A.Height();
+    if( range == 'I' && (il < 0 || il > iu || iu >= n) )
+        throw std::logic_error("Invalid index range");
+
+    const char jobz = ( Z == 0 ? 'N' : 'V' );
+    const char uploChar = UpperOrLowerToChar( uplo );
+    const int maxEigs = ( range == 'I' ? iu-il+1 : n );
+    const R abstol = lapack::MachineSafeMin<R>();
+    w.ResizeTo( n, 1 );
+    F* ZBuffer = 0;
+    int ldz = 1;
+    if( Z != 0 )
+    {
+        Z->ResizeTo( n, maxEigs );
+        ZBuffer = Z->Buffer();
+        ldz = Z->LDim();
+    }
+    const int k = lapack::HermitianEig
+    ( jobz, range, uploChar, n, A.Buffer(), A.LDim(), vl, vu, il+1, iu+1,
+      abstol, w.Buffer(), ZBuffer, ldz );
+    w.ResizeTo( k, 1 );
+    if( Z != 0 )
+        Z->ResizeTo( n, k );
+}
+
+} // namespace hermitian_eig
+
+//----------------------------------------------------------------------------//
+// Sequential versions                                                        //
+//----------------------------------------------------------------------------//
+
+template<typename F>
+inline void
+HermitianEig
+( UpperOrLower uplo, Matrix<F>& A, 
+  Matrix<typename Base<F>::type>& w, Matrix<F>& Z )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianEig");
+#endif
+    hermitian_eig::SequentialEig( uplo, A, w, &Z, 'A', 0, 0, 0, 0 );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+HermitianEig
+( UpperOrLower uplo, Matrix<F>& A, 
+  Matrix<typename Base<F>::type>& w, Matrix<F>& Z, int a, int b )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianEig");
+#endif
+    hermitian_eig::SequentialEig( uplo, A, w, &Z, 'I', 0, 0, a, b );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+HermitianEig
+( UpperOrLower uplo, Matrix<F>& A, 
+  Matrix<typename Base<F>::type>& w, Matrix<F>& Z, 
+  typename Base<F>::type a, typename Base<F>::type b )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianEig");
+#endif
+    hermitian_eig::SequentialEig( uplo, A, w, &Z, 'V', a, b, 0, 0 );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+HermitianEig
+( UpperOrLower uplo, Matrix<F>& A, Matrix<typename Base<F>::type>& w )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianEig");
+#endif
+    hermitian_eig::SequentialEig<F>( uplo, A, w, 0, 'A', 0, 0, 0, 0 );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+HermitianEig
+( UpperOrLower uplo, Matrix<F>& A, Matrix<typename Base<F>::type>& w,
+  int a, int b )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianEig");
+#endif
+    hermitian_eig::SequentialEig<F>( uplo, A, w, 0, 'I', 0, 0, a, b );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+HermitianEig
+( UpperOrLower uplo, Matrix<F>& A, Matrix<typename Base<F>::type>& w,
+  typename Base<F>::type a, typename Base<F>::type b )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianEig");
+#endif
+    hermitian_eig::SequentialEig<F>( uplo, A, w, 0, 'V', a, b, 0, 0 );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+//----------------------------------------------------------------------------//
+// Batched version                                                            //
+//----------------------------------------------------------------------------//
+
+template<typename F>
+inline void
+HermitianEig
+( UpperOrLower uplo, MatrixBatch<F>& A, 
+  MatrixBatch<typename Base<F>::type>& w, MatrixBatch<F>& Z )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianEig");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+#endif
+    typedef typename Base<F>::type R;
+    const int n = A.Height();
+    const int count = A.Count();
+    w.ResizeTo( n, 1, count );
+    Z.ResizeTo( n, n, count );
+    const char uploChar = UpperOrLowerToChar( uplo );
+    const R abstol = lapack::MachineSafeMin<R>();
+    std::vector<char> succeeded( count, 1 );
+    // The LAPACK wrappers maintain the (serial) call stack in debug mode
+#if defined(HAVE_OPENMP) && defined(RELEASE)
+    #pragma omp parallel for
+#endif
+    for( int l=0; l<count; ++l )
+    {
+        try
+        {
+            lapack::HermitianEig
+            ( 'V', 'A', uploChar, n, A.Buffer(l), A.LDim(), R(0), R(0), 
+              0, 0, abstol, w.Buffer(l), Z.Buffer(l), Z.LDim() );
+        }
+        catch( std::exception& e ) { succeeded[l] = 0; }
+    }
+    for( int l=0; l<count; ++l )
+    {
+        if( !succeeded[l] )
+        {
+            std::ostringstream msg;
+            msg << "Eigensolver failed on matrix " << l << " of the batch";
+            throw std::runtime_error( msg.str().c_str() );
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+HermitianEig
+( UpperOrLower uplo, DistMatrixBatch<F>& A, 
+  DistMatrixBatch<typename Base<F>::type>& w, DistMatrixBatch<F>& Z )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianEig");
+#endif
+    w.ResizeTo( A.Height(), 1, A.Count() );
+    Z.ResizeTo( A.Height(), A.Height(), A.Count() );
+    HermitianEig( uplo, A.LocalBatch(), w.LocalBatch(), Z.LocalBatch() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
+
 #ifndef WITHOUT_PMRRR
 
 namespace elem {
@@ -216,6 +426,89 @@ CheckScale
     }
 }
 
+// The Householder transforms from the reduction to tridiagonal form. The
+// two-stage approach additionally stores those from the bulge chasing in V 
+// and tau.
+template<typename F>
+struct TridiagReflectors
+{
+    bool twoStage;
+    int bandwidth;
+    DistMatrix<F,STAR,STAR> t;
+    DistMatrix<F,STAR,VR> V, tau;
+
+    TridiagReflectors( const Grid& g )
+    : twoStage(false), bandwidth(1), t(g), V(g), tau(g)
+    { }
+};
+
+template<typename F>
+inline void
+TridiagTwoStage( UpperOrLower uplo, DistMatrix<F>& A, TridiagReflectors<F>& Q )
+{
+    Q.twoStage = true;
+    Q.bandwidth = GetHermitianTridiagBandwidth();
+    HermitianTridiagTwoStage( uplo, Q.bandwidth, A, Q.t, Q.V, Q.tau );
+}
+
+template<typename R>
+inline void
+Tridiag( UpperOrLower uplo, DistMatrix<R>& A, TridiagReflectors<R>& Q )
+{
+    if( GetHermitianTridiagApproach() == HERMITIAN_TRIDIAG_TWO_STAGE )
+        TridiagTwoStage( uplo, A, Q );
+    else
+        HermitianTridiag( uplo, A );
+}
+
+template<typename R>
+inline void
+Tridiag
+( UpperOrLower uplo, DistMatrix<Complex<R> >& A, 
+  TridiagReflectors<Complex<R> >& Q )
+{
+    if( GetHermitianTridiagApproach() == HERMITIAN_TRIDIAG_TWO_STAGE )
+        TridiagTwoStage( uplo, A, Q );
+    else
+        HermitianTridiag( uplo, A, Q.t );
+}
+
+template<typename R>
+inline void
+BackTransform
+( UpperOrLower uplo, const DistMatrix<R>& A, 
+  const TridiagReflectors<R>& Q, DistMatrix<R>& Z )
+{
+    const int subdiagonal = ( uplo==LOWER ? -1 : +1 );
+    if( Q.twoStage )
+        ApplyTwoStageReflectors( Q.bandwidth, A, Q.t, Q.V, Q.tau, Z );
+    else if( uplo == LOWER )
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, BACKWARD, subdiagonal, A, Z );
+    else
+        ApplyPackedReflectors
+        ( LEFT, UPPER, VERTICAL, FORWARD,  subdiagonal, A, Z );
+}
+
+template<typename R>
+inline void
+BackTransform
+( UpperOrLower uplo, const DistMatrix<Complex<R> >& A, 
+  const TridiagReflectors<Complex<R> >& Q, DistMatrix<Complex<R> >& Z )
+{
+    const int subdiagonal = ( uplo==LOWER ? -1 : +1 );
+    if( Q.twoStage )
+        ApplyTwoStageReflectors( Q.bandwidth, A, Q.t, Q.V, Q.tau, Z );
+    else if( uplo == LOWER )
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED, 
+          subdiagonal, A, Q.t, Z );
+    else
+        ApplyPackedReflectors
+        ( LEFT, UPPER, VERTICAL, FORWARD, UNCONJUGATED, 
+          subdiagonal, A, Q.t, Z );
+}
+
 } // namespace hermitian_eig
 
 //----------------------------------------------------------------------------//
@@ -283,7 +576,8 @@ HermitianEig
         ScaleTrapezoid( scale, LEFT, uplo, 0, A );
 
     // Tridiagonalize A
-    HermitianTridiag( uplo, A );
+    hermitian_eig::TridiagReflectors<R> Q( g );
+    hermitian_eig::Tridiag( uplo, A, Q );
 
     // Grab copies of the diagonal and subdiagonal of A
     DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
@@ -366,12 +660,7 @@ HermitianEig
 
     // Backtransform the tridiagonal eigenvectors, Z
     paddedZ.ResizeTo( A.Height(), w.Height() ); // We can simply shrink matrices
-    if( uplo == LOWER )
-        ApplyPackedReflectors
-        ( LEFT, LOWER, VERTICAL, BACKWARD, subdiagonal, A, paddedZ );
-    else
-        ApplyPackedReflectors
-        ( LEFT, UPPER, VERTICAL, FORWARD,  subdiagonal, A, paddedZ );
+    hermitian_eig::BackTransform( uplo, A, Q, paddedZ );
 
     // Rescale the eigenvalues if necessary
     if( needRescaling )
@@ -450,7 +739,8 @@ HermitianEig
         ScaleTrapezoid( scale, LEFT, uplo, 0, A );
 
     // Tridiagonalize A
-    HermitianTridiag( uplo, A );
+    hermitian_eig::TridiagReflectors<R> Q( g );
+    hermitian_eig::Tridiag( uplo, A, Q );
 
     // Grab copies of the diagonal and subdiagonal of A
     DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
@@ -534,12 +824,7 @@ HermitianEig
 
     // Backtransform the tridiagonal eigenvectors, Z
     paddedZ.ResizeTo( A.Height(), w.Height() );
-    if( uplo == LOWER )
-        ApplyPackedReflectors
-        ( LEFT, LOWER, VERTICAL, BACKWARD, subdiagonal, A, paddedZ );
-    else
-        ApplyPackedReflectors
-        ( LEFT, UPPER, VERTICAL, FORWARD,  subdiagonal, A, paddedZ );
+    hermitian_eig::BackTransform( uplo, A, Q, paddedZ );
 
     // Rescale the eigenvalues if necessary
     if( needRescaling )
@@ -611,7 +896,8 @@ HermitianEig
         ScaleTrapezoid( scale, LEFT, uplo, 0, A );
 
     // Tridiagonalize A
-    HermitianTridiag( uplo, A );
+    hermitian_eig::TridiagReflectors<R> Q( g );
+    hermitian_eig::Tridiag( uplo, A, Q );
 
     // Grab copies of the diagonal and subdiagonal of A
     DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
@@ -716,12 +1002,7 @@ HermitianEig
 
     // Backtransform the tridiagonal eigenvectors, Z
     paddedZ.ResizeTo( A.Height(), w.Height() );
-    if( uplo == LOWER )
-        ApplyPackedReflectors
-        ( LEFT, LOWER, VERTICAL, BACKWARD, subdiagonal, A, paddedZ );
-    else
-        ApplyPackedReflectors
-        ( LEFT, UPPER, VERTICAL, FORWARD,  subdiagonal, A, paddedZ );
+    hermitian_eig::BackTransform( uplo, A, Q, paddedZ );
 
     // Rescale the eigenvalues if necessary
     if( needRescaling )
@@ -774,7 +1055,8 @@ HermitianEig
         ScaleTrapezoid( scale, LEFT, uplo, 0, A );
 
     // Tridiagonalize A
-    HermitianTridiag( uplo, A );
+    hermitian_eig::TridiagReflectors<R> Q( g );
+    hermitian_eig::Tridiag( uplo, A, Q );
 
     // Grab copies of the diagonal and subdiagonal of A
     DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
@@ -858,7 +1140,8 @@ HermitianEig
         ScaleTrapezoid( scale, LEFT, uplo, 0, A );
 
     // Tridiagonalize A
-    HermitianTridiag( uplo, A );
+    hermitian_eig::TridiagReflectors<R> Q( g );
+    hermitian_eig::Tridiag( uplo, A, Q );
 
     // Grab copies of the diagonal and subdiagonal of A
     DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
@@ -938,7 +1221,8 @@ HermitianEig
         ScaleTrapezoid( scale, LEFT, uplo, 0, A );
 
     // Tridiagonalize A
-    HermitianTridiag( uplo, A );
+    hermitian_eig::TridiagReflectors<R> Q( g );
+    hermitian_eig::Tridiag( uplo, A, Q );
 
     // Grab copies of the diagonal and subdiagonal of A
     DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
@@ -1041,8 +1325,8 @@ HermitianEig
         ScaleTrapezoid( C(scale), LEFT, uplo, 0, A );
 
     // Tridiagonalize A
-    DistMatrix<C,STAR,STAR> t(g);
-    HermitianTridiag( uplo, A, t );
+    hermitian_eig::TridiagReflectors<C> Q( g );
+    hermitian_eig::Tridiag( uplo, A, Q );
 
     // Grab copies of the diagonal and subdiagonal of A
     DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
@@ -1125,14 +1409,7 @@ HermitianEig
 
     // Backtransform the tridiagonal eigenvectors, Z
     paddedZ.ResizeTo( A.Height(), w.Height() ); 
-    if( uplo == LOWER )
-        ApplyPackedReflectors
-        ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED, 
-          subdiagonal, A, t, paddedZ );
-    else
-        ApplyPackedReflectors
-        ( LEFT, UPPER, VERTICAL, FORWARD, UNCONJUGATED, 
-          subdiagonal, A, t, paddedZ );
+    hermitian_eig::BackTransform( uplo, A, Q, paddedZ );
 
     // Rescale the eigenvalues if necessary
     if( needRescaling )
@@ -1211,8 +1488,8 @@ HermitianEig
         ScaleTrapezoid( C(scale), LEFT, uplo, 0, A );
 
     // Tridiagonalize A
-    DistMatrix<C,STAR,STAR> t(g);
-    HermitianTridiag( uplo, A, t );
+    hermitian_eig::TridiagReflectors<C> Q( g );
+    hermitian_eig::Tridiag( uplo, A, Q );
 
     // Grab copies of the diagonal and subdiagonal of A
     DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
@@ -1296,14 +1573,7 @@ HermitianEig
 
     // Backtransform the tridiagonal eigenvectors, Z
     paddedZ.ResizeTo( A.Height(), w.Height() );
-    if( uplo == LOWER )
-        ApplyPackedReflectors
-        ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED, 
-          subdiagonal, A, t, paddedZ );
-    else
-        ApplyPackedReflectors
-        ( LEFT, UPPER, VERTICAL, FORWARD, UNCONJUGATED, 
-          subdiagonal, A, t, paddedZ );
+    hermitian_eig::BackTransform( uplo, A, Q, paddedZ );
 
     // Rescale the eigenvalues if necessary
     if( needRescaling )
@@ -1375,8 +1645,8 @@ HermitianEig
         ScaleTrapezoid( C(scale), LEFT, uplo, 0, A );
 
     // Tridiagonalize A
-    DistMatrix<C,STAR,STAR> t(g);
-    HermitianTridiag( uplo, A, t );
+    hermitian_eig::TridiagReflectors<C> Q( g );
+    hermitian_eig::Tridiag( uplo, A, Q );
 
     // Grab copies of the diagonal and subdiagonal of A
     DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
@@ -1481,14 +1751,7 @@ HermitianEig
 
     // Backtransform the tridiagonal eigenvectors, Z
     paddedZ.ResizeTo( A.Height(), w.Height() );
-    if( uplo == LOWER )
-        ApplyPackedReflectors
-        ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED, 
-          subdiagonal, A, t, paddedZ );
-    else
-        ApplyPackedReflectors
-        ( LEFT, UPPER, VERTICAL, FORWARD, UNCONJUGATED, 
-          subdiagonal, A, t, paddedZ );
+    hermitian_eig::BackTransform( uplo, A, Q, paddedZ );
 
     // Rescale the eigenvalues if necessary
     if( needRescaling )
@@ -1542,8 +1805,8 @@ HermitianEig
         ScaleTrapezoid( C(scale), LEFT, uplo, 0, A );
 
     // Tridiagonalize A
-    DistMatrix<C,STAR,STAR> t(g);
-    HermitianTridiag( uplo, A, t );
+    hermitian_eig::TridiagReflectors<C> Q( g );
+    hermitian_eig::Tridiag( uplo, A, Q );
 
     // Grab copies of the diagonal and subdiagonal of A
     DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
@@ -1627,8 +1890,8 @@ HermitianEig
         ScaleTrapezoid( C(scale), LEFT, uplo, 0, A );
 
     // Tridiagonalize A
-    DistMatrix<C,STAR,STAR> t(g);
-    HermitianTridiag( uplo, A, t );
+    hermitian_eig::TridiagReflectors<C> Q( g );
+    hermitian_eig::Tridiag( uplo, A, Q );
 
     // Grab copies of the diagonal and subdiagonal of A
     DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
@@ -1708,8 +1971,8 @@ HermitianEig
         ScaleTrapezoid( C(scale), LEFT, uplo, 0, A );
 
     // Tridiagonalize A
-    DistMatrix<C,STAR,STAR> t(g);
-    HermitianTridiag( uplo, A, t );
+    hermitian_eig::TridiagReflectors<C> Q( g );
+    hermitian_eig::Tridiag( uplo, A, Q );
 
     // Grab copies of the diagonal and subdiagonal of A
     DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
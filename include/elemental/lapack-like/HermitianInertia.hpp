@@ -0,0 +1,124 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+namespace internal {
+
+// A := A + alpha I
+template<typename F>
+inline void
+ShiftDiagonal( Matrix<F>& A, F alpha )
+{
+    const int minDim = std::min(A.Height(),A.Width());
+    for( int j=0; j<minDim; ++j )
+        A.Update( j, j, alpha );
+}
+
+template<typename F>
+inline void
+ShiftDiagonal( DistMatrix<F>& A, F alpha )
+{
+    const int colShift = A.ColShift();
+    const int rowShift = A.RowShift();
+    const int colStride = A.ColStride();
+    const int rowStride = A.RowStride();
+    const int localWidth = A.LocalWidth();
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        const int j = rowShift + jLocal*rowStride;
+        if( j < A.Height() && (j-colShift) % colStride == 0 )
+        {
+            const int iLocal = (j-colShift) / colStride;
+            A.UpdateLocal( iLocal, jLocal, alpha );
+        }
+    }
+}
+
+template<typename F>
+inline InertiaType
+InertiaFromDiagonal( const Matrix<F>& d )
+{
+    InertiaType inertia;
+    inertia.numPositive = inertia.numNegative = 0;
+    const int n = d.Height();
+    for( int i=0; i<n; ++i )
+    {
+        const typename Base<F>::type delta = RealPart(d.Get(i,0));
+        if( delta > 0 )
+            ++inertia.numPositive;
+        else
+            ++inertia.numNegative;
+    }
+    return inertia;
+}
+
+} // namespace internal
+
+template<typename F>
+inline InertiaType
+HermitianInertia
+( UpperOrLower uplo, const Matrix<F>& A, typename Base<F>::type shift )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianInertia");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+#endif
+    // LDL^H only reads from the lower triangle
+    Matrix<F> B( A );
+    MakeHermitian( uplo, B );
+    internal::ShiftDiagonal( B, F(-shift) );
+
+    Matrix<F> d;
+    LDLH( B, d );
+    const InertiaType inertia = internal::InertiaFromDiagonal( d );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return inertia;
+}
+
+template<typename F>
+inline InertiaType
+HermitianInertia
+( UpperOrLower uplo, const DistMatrix<F>& A, typename Base<F>::type shift )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianInertia");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+#endif
+    const Grid& g = A.Grid();
+    DistMatrix<F> B( A );
+    MakeHermitian( uplo, B );
+    internal::ShiftDiagonal( B, F(-shift) );
+    LDLH( B );
+
+    // The diagonal of B now holds D
+    DistMatrix<F,MD,STAR> d(g);
+    B.GetDiagonal( d );
+    InertiaType localInertia;
+    localInertia.numPositive = localInertia.numNegative = 0;
+    if( d.Participating() )
+        localInertia = internal::InertiaFromDiagonal( d.LockedLocalMatrix() );
+    const int localCounts[2] =
+      { localInertia.numPositive, localInertia.numNegative };
+    int counts[2];
+    mpi::AllReduce( localCounts, counts, 2, mpi::SUM, g.VCComm() );
+    InertiaType inertia;
+    inertia.numPositive = counts[0];
+    inertia.numNegative = counts[1];
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return inertia;
+}
+
+} // namespace elem
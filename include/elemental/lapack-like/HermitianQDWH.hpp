@@ -49,10 +49,10 @@ int HermitianQDWH
     int numIts=0;
     R frobNormADiff;
     Matrix<F> ALast;
-    Matrix<F> Q( 2*height, height );
-    Matrix<F> QT, QB;
-    PartitionDown( Q, QT,
-                      QB, height );
+    Matrix<F> W( 2*height, height ), Q;
+    Matrix<F> WT, WB, QT, QB;
+    PartitionDown( W, WT,
+                      WB, height );
     Matrix<F> C;
     Matrix<F> ATemp;
     do
@@ -89,10 +89,12 @@ int HermitianQDWH
             // The standard QR-based algorithm
             //
             MakeHermitian( uplo, A );
-            QT = A;
-            Scale( Sqrt(c), QT );
-            MakeIdentity( QB );
-            ExplicitQR( Q );
+            WT = A;
+            Scale( Sqrt(c), WT );
+            MakeIdentity( WB );
+            internal::StructuredExplicitQR( W, height, Q );
+            PartitionDown( Q, QT,
+                              QB, height );
             Trrk( uplo, NORMAL, ADJOINT, alpha/Sqrt(c), QT, QB, beta, A );
         }
         else
@@ -154,10 +156,10 @@ int HermitianQDWH
     int numIts=0;
     R frobNormADiff;
     DistMatrix<F> ALast( g );
-    DistMatrix<F> Q( 2*height, height, g );
-    DistMatrix<F> QT(g), QB(g);
-    PartitionDown( Q, QT,
-                      QB, height );
+    DistMatrix<F> W( 2*height, height, g ), Q( g );
+    DistMatrix<F> WT(g), WB(g), QT(g), QB(g);
+    PartitionDown( W, WT,
+                      WB, height );
     DistMatrix<F> C( g );
     DistMatrix<F> ATemp( g );
     do
@@ -194,10 +196,12 @@ int HermitianQDWH
             // The standard QR-based algorithm
             //
             MakeHermitian( uplo, A );
-            QT = A;
-            Scale( Sqrt(c), QT );
-            MakeIdentity( QB );
-            ExplicitQR( Q );
+            WT = A;
+            Scale( Sqrt(c), WT );
+            MakeIdentity( WB );
+            internal::StructuredExplicitQR( W, height, Q );
+            PartitionDown( Q, QT,
+                              QB, height );
             Trrk( uplo, NORMAL, ADJOINT, alpha/Sqrt(c), QT, QB, beta, A );
         }
         else
@@ -0,0 +1,356 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace internal {
+
+// Return the number of eigenvalues of the Hermitian matrix A which are at
+// most 'shift'. An exact zero pivot in the unpivoted LDL^H factorization
+// means that the shift is (numerically) an eigenvalue, or that the
+// factorization broke down, so the shift is nudged upwards and we try again.
+template<typename F>
+inline int
+NumEigenvaluesAtMost
+( const DistMatrix<F>& A,
+  typename Base<F>::type shift, typename Base<F>::type nudge )
+{
+#ifndef RELEASE
+    PushCallStack("internal::NumEigenvaluesAtMost");
+#endif
+    const int maxAttempts = 10;
+    int numNegative = 0;
+    for( int attempt=0; attempt<maxAttempts; ++attempt )
+    {
+        try
+        {
+            numNegative = HermitianInertia( LOWER, A, shift ).numNegative;
+            break;
+        }
+        catch( SingularMatrixException& e )
+        {
+            if( attempt == maxAttempts-1 )
+                throw;
+            shift += nudge;
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return numNegative;
+}
+
+// Compute the 'numEigs' eigenpairs of the explicitly Hermitian matrix A with
+// eigenvalues in (a,b] via shift-and-invert subspace iteration with the
+// shift at the center of the interval. Every eigenvalue in the interval is
+// closer to the shift than those outside of it, so the desired eigenpairs
+// are the dominant ones of inv(A - shift I).
+template<typename F>
+inline void
+SliceSubspaceIteration
+( const DistMatrix<F>& A,
+  typename Base<F>::type a, typename Base<F>::type b, int numEigs,
+  typename Base<F>::type tol, int maxIts, typename Base<F>::type nudge,
+  Matrix<typename Base<F>::type>& w, DistMatrix<F>& Z )
+{
+#ifndef RELEASE
+    PushCallStack("internal::SliceSubspaceIteration");
+#endif
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const int k = std::min( n, numEigs+std::max(numEigs,10) );
+
+    // Factor A - shift I with partial pivoting, nudging the shift if it
+    // happens to be an eigenvalue
+    R shift = (a+b)/2;
+    DistMatrix<F> AShift(g);
+    DistMatrix<int,VC,STAR> p(g);
+    const int maxAttempts = 10;
+    for( int attempt=0; attempt<maxAttempts; ++attempt )
+    {
+        try
+        {
+            AShift = A;
+            internal::ShiftDiagonal( AShift, F(-shift) );
+            LU( AShift, p );
+            break;
+        }
+        catch( SingularMatrixException& e )
+        {
+            if( attempt == maxAttempts-1 )
+                throw;
+            shift += nudge;
+        }
+    }
+
+    DistMatrix<F> X(g), AX(g);
+    Uniform( n, k, X );
+    ExplicitQR( X );
+    DistMatrix<F,VC,STAR> X_VC_STAR(g), AX_VC_STAR(g),
+                          XS_VC_STAR(g), AXS_VC_STAR(g);
+    AX_VC_STAR.AlignWith( X_VC_STAR );
+    XS_VC_STAR.AlignWith( X_VC_STAR );
+    AXS_VC_STAR.AlignWith( X_VC_STAR );
+    Matrix<F> HLocal, H, S;
+    Matrix<R> theta;
+    std::vector<R> localResids(k), resids(k);
+    std::vector<int> found;
+    for( int it=0; it<maxIts; ++it )
+    {
+        // X := orth(inv(A - shift I) X)
+        SolveAfterLU( NORMAL, AShift, p, X );
+        ExplicitQR( X );
+
+        // Rayleigh-Ritz: form H := X^H A X and its eigenpairs (theta,S)
+        Zeros( n, k, AX );
+        Gemm( NORMAL, NORMAL, F(1), A, X, F(0), AX );
+        X_VC_STAR = X;
+        AX_VC_STAR = AX;
+        Zeros( k, k, HLocal );
+        Gemm
+        ( ADJOINT, NORMAL,
+          F(1), X_VC_STAR.LockedLocalMatrix(),
+                AX_VC_STAR.LockedLocalMatrix(),
+          F(0), HLocal );
+        Zeros( k, k, H );
+        mpi::AllReduce
+        ( HLocal.LockedBuffer(), H.Buffer(), k*k, mpi::SUM, g.VCComm() );
+        HermitianEig( LOWER, H, theta, S );
+
+        // Rotate into the Ritz vectors
+        const int localHeight = X_VC_STAR.LocalHeight();
+        Zeros( n, k, XS_VC_STAR );
+        Zeros( n, k, AXS_VC_STAR );
+        Gemm
+        ( NORMAL, NORMAL,
+          F(1), X_VC_STAR.LockedLocalMatrix(), S,
+          F(0), XS_VC_STAR.LocalMatrix() );
+        Gemm
+        ( NORMAL, NORMAL,
+          F(1), AX_VC_STAR.LockedLocalMatrix(), S,
+          F(0), AXS_VC_STAR.LocalMatrix() );
+
+        // Compute the residual norms of the Ritz pairs
+        for( int j=0; j<k; ++j )
+        {
+            const R omega = theta.Get(j,0);
+            R localResid = 0;
+            for( int iLocal=0; iLocal<localHeight; ++iLocal )
+            {
+                const F rho = AXS_VC_STAR.GetLocal(iLocal,j) -
+                              omega*XS_VC_STAR.GetLocal(iLocal,j);
+                localResid += RealPart(rho*Conj(rho));
+            }
+            localResids[j] = localResid;
+        }
+        mpi::AllReduce( &localResids[0], &resids[0], k, mpi::SUM, g.VCComm() );
+
+        // Only accept converged Ritz pairs, as the Ritz values of the 
+        // unconverged guard vectors can lie anywhere, including in (a,b]
+        found.clear();
+        for( int j=0; j<k; ++j )
+        {
+            const R omega = theta.Get(j,0);
+            if( omega > a && omega <= b && Sqrt(resids[j]) <= tol )
+                found.push_back( j );
+        }
+        if( int(found.size()) >= numEigs )
+            break;
+
+        X = XS_VC_STAR;
+    }
+
+    // Return the converged Ritz pairs within the interval
+    const int numFound = found.size();
+    w.ResizeTo( numFound, 1 );
+    DistMatrix<F,VC,STAR> Z_VC_STAR(g);
+    Z_VC_STAR.AlignWith( XS_VC_STAR );
+    Zeros( n, numFound, Z_VC_STAR );
+    const int localHeight = XS_VC_STAR.LocalHeight();
+    for( int j=0; j<numFound; ++j )
+    {
+        w.Set( j, 0, theta.Get(found[j],0) );
+        MemCopy
+        ( Z_VC_STAR.LocalBuffer(0,j), XS_VC_STAR.LockedLocalBuffer(0,found[j]),
+          localHeight );
+    }
+    Z = Z_VC_STAR;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace internal
+
+template<typename F>
+inline void
+HermitianSlicedEig
+( UpperOrLower uplo, DistMatrix<F>& A,
+  DistMatrix<typename Base<F>::type,VR,STAR>& w, DistMatrix<F>& Z,
+  typename Base<F>::type lowerBound, typename Base<F>::type upperBound,
+  int numSubgrids, int slicesPerSubgrid )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianSlicedEig");
+    if( A.Grid() != w.Grid() || A.Grid() != Z.Grid() )
+        throw std::logic_error("{A,w,Z} must be distributed over same grid");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( lowerBound >= upperBound )
+        throw std::logic_error("The interval (a,b] must be nonempty");
+    if( numSubgrids < 1 || numSubgrids > A.Grid().Size() )
+        throw std::logic_error("Invalid number of subgrids");
+    if( slicesPerSubgrid < 1 )
+        throw std::logic_error("Must use at least one slice per subgrid");
+#endif
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const int p = g.Size();
+    const int numSlices = numSubgrids*slicesPerSubgrid;
+
+    // Both triangles are needed for the shift-and-invert iterations
+    MakeHermitian( uplo, A );
+    const R frobNorm = Norm( A, FROBENIUS_NORM );
+    const R eps = lapack::MachineEpsilon<R>();
+    const R tol = std::max(n,10)*eps*frobNorm;
+    const R nudge = 10*eps*std::max(frobNorm,R(1));
+    const int maxIts = 100;
+
+    // Split the processes into (nearly) equally-sized subgrids, which each
+    // hold a copy of A
+    mpi::Group owningGroup = g.OwningGroup();
+    mpi::Comm viewingComm = g.ViewingComm();
+    std::vector<mpi::Group> subgroups( numSubgrids );
+    std::vector<Grid*> subgrids( numSubgrids );
+    std::vector<DistMatrix<F>*> ASubs( numSubgrids );
+    int mySubgrid = -1;
+    for( int s=0; s<numSubgrids; ++s )
+    {
+        const int firstRank = (s*p)/numSubgrids;
+        const int subgridSize = ((s+1)*p)/numSubgrids - firstRank;
+        std::vector<int> ranks( subgridSize );
+        for( int i=0; i<subgridSize; ++i )
+            ranks[i] = firstRank + i;
+        mpi::GroupIncl( owningGroup, subgridSize, &ranks[0], subgroups[s] );
+        subgrids[s] = new Grid( viewingComm, subgroups[s] );
+        if( subgrids[s]->InGrid() )
+            mySubgrid = s;
+        ASubs[s] = new DistMatrix<F>( *subgrids[s] );
+        *ASubs[s] = A;
+    }
+    const bool isSubgridRoot =
+        ( mySubgrid != -1 && subgrids[mySubgrid]->VCRank() == 0 );
+
+    // Count the eigenvalues at most each of the slice boundaries,
+    //   a = sigma_0 < sigma_1 < ... < sigma_{numSlices} = b,
+    // via Sylvester's law of inertia
+    std::vector<R> shifts( numSlices+1 );
+    for( int i=0; i<=numSlices; ++i )
+        shifts[i] = lowerBound + (i*(upperBound-lowerBound))/numSlices;
+    shifts[numSlices] = upperBound;
+    std::vector<int> localCounts( numSlices+1, 0 ), counts( numSlices+1 );
+    for( int i=0; i<=numSlices; ++i )
+    {
+        if( i % numSubgrids == mySubgrid )
+        {
+            const int count =
+                internal::NumEigenvaluesAtMost( *ASubs[mySubgrid],
+                                                shifts[i], nudge );
+            if( isSubgridRoot )
+                localCounts[i] = count;
+        }
+    }
+    mpi::AllReduce
+    ( &localCounts[0], &counts[0], numSlices+1, mpi::SUM, viewingComm );
+
+    // Greedily assign the most populated remaining slice to the subgrid with
+    // the fewest eigenpairs to compute
+    std::vector<std::pair<int,int> > slicePops( numSlices );
+    for( int i=0; i<numSlices; ++i )
+        slicePops[i] = std::make_pair( -(counts[i+1]-counts[i]), i );
+    std::sort( slicePops.begin(), slicePops.end() );
+    std::vector<int> owners( numSlices ), loads( numSubgrids, 0 );
+    for( int i=0; i<numSlices; ++i )
+    {
+        const int slice = slicePops[i].second;
+        const int s =
+            std::min_element( loads.begin(), loads.end() ) - loads.begin();
+        owners[slice] = s;
+        loads[s] -= slicePops[i].first;
+    }
+
+    // Independently compute the eigenpairs of each slice on its subgrid
+    std::vector<Matrix<R> > wSlices( numSlices );
+    std::vector<DistMatrix<F>*> ZSlices( numSlices );
+    std::vector<int> localSizes( numSlices, 0 ), sizes( numSlices );
+    for( int i=0; i<numSlices; ++i )
+    {
+        const int numEigs = counts[i+1] - counts[i];
+        ZSlices[i] = new DistMatrix<F>( *subgrids[owners[i]] );
+        if( owners[i] == mySubgrid && numEigs > 0 )
+        {
+            internal::SliceSubspaceIteration
+            ( *ASubs[mySubgrid], shifts[i], shifts[i+1], numEigs,
+              tol, maxIts, nudge, wSlices[i], *ZSlices[i] );
+            if( isSubgridRoot )
+                localSizes[i] = wSlices[i].Height();
+        }
+    }
+    mpi::AllReduce
+    ( &localSizes[0], &sizes[0], numSlices, mpi::SUM, viewingComm );
+
+    // Gather the eigenvalues, which are sorted since the slices are
+    std::vector<int> offsets( numSlices+1 );
+    offsets[0] = 0;
+    for( int i=0; i<numSlices; ++i )
+        offsets[i+1] = offsets[i] + sizes[i];
+    const int numFound = offsets[numSlices];
+    std::vector<R> localEigs( numFound, 0 ), eigs( numFound );
+    for( int i=0; i<numSlices; ++i )
+        if( owners[i] == mySubgrid && isSubgridRoot )
+            for( int j=0; j<sizes[i]; ++j )
+                localEigs[offsets[i]+j] = wSlices[i].Get(j,0);
+    if( numFound > 0 )
+        mpi::AllReduce
+        ( &localEigs[0], &eigs[0], numFound, mpi::SUM, viewingComm );
+    w.ResizeTo( numFound, 1 );
+    const int colShift = w.ColShift();
+    const int colStride = w.ColStride();
+    const int localHeight = w.LocalHeight();
+    for( int iLocal=0; iLocal<localHeight; ++iLocal )
+        w.SetLocal( iLocal, 0, eigs[colShift+iLocal*colStride] );
+
+    // Redistribute the eigenvectors from each subgrid
+    Z.ResizeTo( n, numFound );
+    DistMatrix<F> ZSlice(g);
+    for( int i=0; i<numSlices; ++i )
+    {
+        if( sizes[i] > 0 )
+        {
+            if( owners[i] != mySubgrid )
+                ZSlices[i]->ResizeTo( n, sizes[i] );
+            View( ZSlice, Z, 0, offsets[i], n, sizes[i] );
+            ZSlice = *ZSlices[i];
+        }
+        delete ZSlices[i];
+    }
+
+    for( int s=0; s<numSubgrids; ++s )
+    {
+        delete ASubs[s];
+        delete subgrids[s];
+        mpi::GroupFree( subgroups[s] );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
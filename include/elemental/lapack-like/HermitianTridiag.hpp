@@ -16,6 +16,7 @@
 #include "./HermitianTridiag/U.hpp"
 #include "./HermitianTridiag/USquare.hpp"
 #include "./HermitianTridiag/Local.hpp"
+#include "./HermitianTridiag/TwoStage.hpp"
 
 namespace elem {
 
@@ -81,7 +82,8 @@ HermitianTridiag( UpperOrLower uplo, DistMatrix<R>& A )
     else
     {
         // Use the normal approach unless we're already on a square 
-        // grid, in which case we use the fast square method.
+        // grid, in which case we use the fast square method. The two-stage
+        // approach is only available through HermitianTridiagTwoStage.
         if( g.Height() == g.Width() )
         {
             if( uplo == LOWER )
@@ -169,7 +171,8 @@ HermitianTridiag
     else
     {
         // Use the normal approach unless we're already on a square 
-        // grid, in which case we use the fast square method.
+        // grid, in which case we use the fast square method. The two-stage
+        // approach is only available through HermitianTridiagTwoStage.
         if( g.Height() == g.Width() )
         {
             if( uplo == LOWER )
@@ -190,4 +193,50 @@ HermitianTridiag
 #endif
 }
 
+template<typename F>
+inline void
+HermitianTridiagTwoStage
+( UpperOrLower uplo, int bandwidth, DistMatrix<F>& A, 
+  DistMatrix<F,STAR,STAR>& t, 
+  DistMatrix<F,STAR,VR>& V, DistMatrix<F,STAR,VR>& tau )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianTridiagTwoStage");
+    if( A.Grid() != t.Grid() || A.Grid() != V.Grid() || 
+        A.Grid() != tau.Grid() )
+        throw std::logic_error
+        ("{A,t,V,tau} must be distributed over the same grid");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( bandwidth < 1 )
+        throw std::logic_error("Bandwidth must be positive");
+#endif
+    const int n = A.Height();
+
+    // The two-sided updates of the first stage need both triangles of A
+    MakeHermitian( uplo, A );
+    internal::HermitianBandReduction( bandwidth, A, t );
+
+    // The band only requires O(n bandwidth) storage, so every process 
+    // chases the bulges on its own copy
+    Matrix<F> W;
+    internal::GatherBand( bandwidth, A, W );
+    internal::ChaseBulges( bandwidth, W, V, tau );
+
+    // Store the (real) tridiagonal matrix in both triangles of A
+    for( int j=0; j<n; ++j )
+    {
+        A.Set( j, j, RealPart(W.Get(0,j)) );
+        if( j < n-1 )
+        {
+            const F epsilon = RealPart(W.Get(1,j));
+            A.Set( j+1, j, epsilon );
+            A.Set( j, j+1, epsilon );
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 } // namespace elem
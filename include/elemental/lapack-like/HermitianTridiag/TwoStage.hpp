@@ -0,0 +1,274 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace internal {
+
+// Factor a panel below the band and apply the resulting transforms to the
+// rows to its right and to both sides of the (explicitly Hermitian) trailing 
+// matrix, which is the bottom-right corner of ARight
+template<typename R>
+inline void
+TwoStagePanel
+( DistMatrix<R>& APan, DistMatrix<R>& ARight, DistMatrix<R>& A22, 
+  DistMatrix<R,STAR,STAR>& tPan )
+{
+    QR( APan );
+    ApplyPackedReflectors( LEFT, LOWER, VERTICAL, FORWARD, 0, APan, ARight );
+    ApplyPackedReflectors( RIGHT, LOWER, VERTICAL, FORWARD, 0, APan, A22 );
+}
+
+template<typename R>
+inline void
+TwoStagePanel
+( DistMatrix<Complex<R> >& APan, DistMatrix<Complex<R> >& ARight,
+  DistMatrix<Complex<R> >& A22, DistMatrix<Complex<R>,STAR,STAR>& tPan )
+{
+    DistMatrix<Complex<R>,MD,STAR> tPan_MD_STAR( APan.Grid() );
+    QR( APan, tPan_MD_STAR );
+    tPan = tPan_MD_STAR;
+    ApplyPackedReflectors
+    ( LEFT, LOWER, VERTICAL, FORWARD, CONJUGATED,
+      0, APan, tPan_MD_STAR, ARight );
+    ApplyPackedReflectors
+    ( RIGHT, LOWER, VERTICAL, FORWARD, UNCONJUGATED,
+      0, APan, tPan_MD_STAR, A22 );
+}
+
+// The first stage: reduce the explicitly Hermitian matrix A to a lower band
+// of the given width using only BLAS-3 updates. The transforms are stored
+// below the band, with their implicit ones on the -bandwidth diagonal.
+template<typename F>
+inline void
+HermitianBandReduction
+( int bandwidth, DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& t )
+{
+#ifndef RELEASE
+    PushCallStack("internal::HermitianBandReduction");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const int numTransforms = std::max(n-bandwidth,0);
+    Zeros( numTransforms, 1, t );
+
+    DistMatrix<F> APan(g), ARight(g), A22(g);
+    DistMatrix<F,STAR,STAR> tPan(g);
+    for( int k=0; k<numTransforms; k+=bandwidth )
+    {
+        const int nb = std::min(bandwidth,numTransforms-k);
+        const int m = n-k-bandwidth;
+        View( APan, A, k+bandwidth, k, m, nb );
+        View( ARight, A, k+bandwidth, k+nb, m, n-k-nb );
+        View( A22, A, k+bandwidth, k+bandwidth, m, m );
+        View( tPan, t, k, 0, nb, 1 );
+        TwoStagePanel( APan, ARight, A22, tPan );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// Redundantly store the lower band of A in W, where W(d,j) = A(j+d,j). W has
+// room for the bulges (which extend up to 2*bandwidth-1 below the diagonal).
+template<typename F>
+inline void
+GatherBand( int bandwidth, const DistMatrix<F>& A, Matrix<F>& W )
+{
+#ifndef RELEASE
+    PushCallStack("internal::GatherBand");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    Zeros( 2*bandwidth, n, W );
+    for( int d=0; d<=std::min(bandwidth,n-1); ++d )
+    {
+        DistMatrix<F,MD,STAR> a_MD_STAR(g);
+        A.GetDiagonal( a_MD_STAR, -d );
+        DistMatrix<F,STAR,STAR> a_STAR_STAR( a_MD_STAR );
+        for( int j=0; j<n-d; ++j )
+            W.Set( d, j, a_STAR_STAR.GetLocal(j,0) );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// C := A(i:i+height-1,j:j+width-1), where the block lies below the diagonal
+template<typename F>
+inline void
+GetBandBlock
+( const Matrix<F>& W, int i, int j, int height, int width, Matrix<F>& C )
+{
+    C.ResizeTo( height, width );
+    const int WLDim = W.LDim();
+    const int CLDim = C.LDim();
+    const F* WBuffer = W.LockedBuffer();
+    F* CBuffer = C.Buffer();
+    for( int jLocal=0; jLocal<width; ++jLocal )
+    {
+        const F* WCol = &WBuffer[(i-(j+jLocal))+(j+jLocal)*WLDim];
+        MemCopy( &CBuffer[jLocal*CLDim], WCol, height );
+    }
+}
+
+template<typename F>
+inline void
+SetBandBlock( Matrix<F>& W, int i, int j, const Matrix<F>& C )
+{
+    const int height = C.Height();
+    const int width = C.Width();
+    const int WLDim = W.LDim();
+    const int CLDim = C.LDim();
+    const F* CBuffer = C.LockedBuffer();
+    F* WBuffer = W.Buffer();
+    for( int jLocal=0; jLocal<width; ++jLocal )
+    {
+        F* WCol = &WBuffer[(i-(j+jLocal))+(j+jLocal)*WLDim];
+        MemCopy( WCol, &CBuffer[jLocal*CLDim], height );
+    }
+}
+
+// D := A(i:i+n-1,i:i+n-1), with both triangles filled in
+template<typename F>
+inline void
+GetBandDiagonalBlock( const Matrix<F>& W, int i, int n, Matrix<F>& D )
+{
+    D.ResizeTo( n, n );
+    const int WLDim = W.LDim();
+    const int DLDim = D.LDim();
+    const F* WBuffer = W.LockedBuffer();
+    F* DBuffer = D.Buffer();
+    for( int jLocal=0; jLocal<n; ++jLocal )
+    {
+        const F* WCol = &WBuffer[(i+jLocal)*WLDim];
+        for( int iLocal=jLocal; iLocal<n; ++iLocal )
+        {
+            const F alpha = WCol[iLocal-jLocal];
+            DBuffer[iLocal+jLocal*DLDim] = alpha;
+            DBuffer[jLocal+iLocal*DLDim] = Conj(alpha);
+        }
+    }
+}
+
+template<typename F>
+inline void
+SetBandDiagonalBlock( Matrix<F>& W, int i, const Matrix<F>& D )
+{
+    const int n = D.Height();
+    const int WLDim = W.LDim();
+    const int DLDim = D.LDim();
+    const F* DBuffer = D.LockedBuffer();
+    F* WBuffer = W.Buffer();
+    for( int jLocal=0; jLocal<n; ++jLocal )
+        MemCopy
+        ( &WBuffer[(i+jLocal)*WLDim], &DBuffer[jLocal+jLocal*DLDim], 
+          n-jLocal );
+}
+
+// The second stage: reduce the band stored in W to real symmetric
+// tridiagonal form by chasing bulges down the band, one sweep per column,
+// using Householder transforms of length at most 'bandwidth'. The k'th
+// transform of sweep s acts on rows
+//
+//   s+1+k*bandwidth, ..., min(s+(k+1)*bandwidth,n)-1,
+//
+// so that the transforms of each sweep tile column s of V, and their scalars
+// are stored in column s of 'tau'. Every process redundantly chases the
+// bulges, but only stores the sweeps that it owns.
+template<typename F>
+inline void
+ChaseBulges
+( int bandwidth, Matrix<F>& W,
+  DistMatrix<F,STAR,VR>& V, DistMatrix<F,STAR,VR>& tau )
+{
+#ifndef RELEASE
+    PushCallStack("internal::ChaseBulges");
+#endif
+    const int n = W.Width();
+    const int numSweeps = std::max(n-1,0);
+    const int maxTransforms = (numSweeps+bandwidth-1)/bandwidth;
+    Zeros( n, numSweeps, V );
+    Zeros( maxTransforms, numSweeps, tau );
+    const int rowShift = V.RowShift();
+    const int rowStride = V.RowStride();
+
+    Matrix<F> C, CRight, D, chi, x, v, vPrev, y;
+    F tauPrev = 0;
+    for( int s=0; s<numSweeps; ++s )
+    {
+        const bool ownSweep =
+            ( s >= rowShift && (s-rowShift) % rowStride == 0 );
+        const int sLocal = (s-rowShift) / rowStride;
+
+        // The first transform annihilates column s below the subdiagonal,
+        // and each of the following ones annihilates the first column of
+        // the bulge created by its predecessor
+        int jPrev = s;
+        int nPrev = 1;
+        int k = 0;
+        for( int i=s+1; i<n; i+=bandwidth, ++k )
+        {
+            const int m = std::min(bandwidth,n-i);
+            GetBandBlock( W, i, jPrev, m, nPrev, C );
+            if( k > 0 )
+            {
+                // C := C H_prev, which creates the bulge
+                y.ResizeTo( m, 1 );
+                Gemv( NORMAL, F(1), C, vPrev, F(0), y );
+                Ger( -tauPrev, y, vPrev, C );
+            }
+
+            View( chi, C, 0, 0, 1, 1 );
+            View( x, C, 1, 0, m-1, 1 );
+            const F tauNew = Reflector( chi, x );
+            v.ResizeTo( m, 1 );
+            F* vBuffer = v.Buffer();
+            F* xBuffer = x.Buffer();
+            vBuffer[0] = 1;
+            MemCopy( &vBuffer[1], xBuffer, m-1 );
+            MemZero( xBuffer, m-1 );
+
+            // Apply adjoint(H) to the remainder of C from the left
+            if( nPrev > 1 )
+            {
+                View( CRight, C, 0, 1, m, nPrev-1 );
+                y.ResizeTo( nPrev-1, 1 );
+                Gemv( ADJOINT, F(1), CRight, v, F(0), y );
+                Ger( -Conj(tauNew), v, y, CRight );
+            }
+            SetBandBlock( W, i, jPrev, C );
+
+            // D := adjoint(H) D H
+            GetBandDiagonalBlock( W, i, m, D );
+            y.ResizeTo( m, 1 );
+            Gemv( NORMAL, F(1), D, v, F(0), y );
+            Ger( -tauNew, y, v, D );
+            Gemv( ADJOINT, F(1), D, v, F(0), y );
+            Ger( -Conj(tauNew), v, y, D );
+            SetBandDiagonalBlock( W, i, D );
+
+            if( ownSweep )
+            {
+                MemCopy
+                ( V.LocalBuffer(i,sLocal), v.LockedBuffer(), m );
+                tau.SetLocal( k, sLocal, tauNew );
+            }
+            vPrev = v;
+            tauPrev = tauNew;
+            jPrev = i;
+            nPrev = m;
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace internal
+} // namespace elem
@@ -8,7 +8,11 @@
 */
 
 #include "./LU/Local.hpp"
+#include "./LU/TournamentPanel.hpp"
 #include "./LU/Panel.hpp"
+#include "./LU/LookAhead.hpp"
+#include "./LU/Batch.hpp"
+#include "./LU/OutOfCore.hpp"
 
 namespace elem {
 
@@ -163,66 +167,9 @@ LU( Matrix<F>& A, Matrix<int>& p )
     if( !p.Viewing() )
         p.ResizeTo( std::min(A.Height(),A.Width()), 1 );
 
-    // Matrix views
-    Matrix<F>
-        ATL, ATR,  A00, A01, A02,  ABRL, ABRR,
-        ABL, ABR,  A10, A11, A12,  
-                   A20, A21, A22;
-
-    Matrix<int>
-        pT,  p0, 
-        pB,  p1,
-             p2;
-
-    // Pivot composition
-    std::vector<int> image, preimage;
-
-    // Start the algorithm
-    PartitionDownDiagonal
-    ( A, ATL, ATR,
-         ABL, ABR, 0 );
-    PartitionDown
-    ( p, pT,
-         pB, 0 );
-    while( ATL.Height() < A.Height() && ATL.Width() < A.Width() )
-    {
-        RepartitionDownDiagonal
-        ( ATL, /**/ ATR,  A00, /**/ A01, A02,
-         /*************/ /******************/
-               /**/       A10, /**/ A11, A12,
-          ABL, /**/ ABR,  A20, /**/ A21, A22 );
-
-        RepartitionDown
-        ( pT,  p0,
-         /**/ /**/
-               p1,
-          pB,  p2 );
-
-        PartitionRight( ABR, ABRL, ABRR, A11.Width() );
-
-        const int pivotOffset = A01.Height();
-        //--------------------------------------------------------------------//
-        internal::PanelLU( ABRL, p1, pivotOffset );
-        internal::ComposePanelPivots( p1, pivotOffset, image, preimage );
-        ApplyRowPivots( ABL, image, preimage );
-        ApplyRowPivots( ABRR, image, preimage );
-
-        Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A11, A12 );
-        Gemm( NORMAL, NORMAL, F(-1), A21, A12, F(1), A22 );
-        //--------------------------------------------------------------------//
-
-        SlidePartitionDownDiagonal
-        ( ATL, /**/ ATR,  A00, A01, /**/ A02,
-               /**/       A10, A11, /**/ A12,
-         /*************/ /******************/
-          ABL, /**/ ABR,  A20, A21, /**/ A22 );
-
-        SlidePartitionDown
-        ( pT,  p0,
-               p1,
-         /**/ /**/
-          pB,  p2 );
-    }
+    // LAPACK's getrf is blocked (and typically recursive and multithreaded
+    // in optimized implementations) and uses the same pivot format
+    lapack::LU( A.Height(), A.Width(), A.Buffer(), A.LDim(), p.Buffer() );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -244,6 +191,14 @@ LU( DistMatrix<F>& A, DistMatrix<int,VC,STAR>& p )
     const Grid& g = A.Grid();
     if( !p.Viewing() )
         p.ResizeTo( std::min(A.Height(),A.Width()), 1 );
+    if( GetLUApproach() == LU_LOOK_AHEAD )
+    {
+        internal::LULookAhead( A, p );
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
 
     // Matrix views
     DistMatrix<F>
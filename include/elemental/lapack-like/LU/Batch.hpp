@@ -0,0 +1,144 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace internal {
+
+// Partial pivoting on columns [k,k+nb) of the n x n matrix A, swapping entire
+// rows, and with the pivots stored in the same format as LU( A, p ). Returns
+// false if a zero pivot was encountered.
+template<typename F>
+inline bool
+BatchPanelLU( int n, int k, int nb, F* A, int lda, int* p )
+{
+    for( int j=k; j<k+nb; ++j )
+    {
+        F* a = &A[j*lda];
+        int pivotRow = j;
+        typename Base<F>::type pivotAbs = FastAbs(a[j]);
+        for( int i=j+1; i<n; ++i )
+        {
+            if( FastAbs(a[i]) > pivotAbs )
+            {
+                pivotAbs = FastAbs(a[i]);
+                pivotRow = i;
+            }
+        }
+        p[j] = pivotRow;
+        if( pivotRow != j )
+            for( int jj=0; jj<n; ++jj )
+                std::swap( A[j+jj*lda], A[pivotRow+jj*lda] );
+        if( a[j] == F(0) )
+            return false;
+
+        const F alphaInv = F(1) / a[j];
+        for( int i=j+1; i<n; ++i )
+            a[i] *= alphaInv;
+        for( int jj=j+1; jj<k+nb; ++jj )
+        {
+            F* b = &A[jj*lda];
+            const F gamma = b[j];
+            for( int i=j+1; i<n; ++i )
+                b[i] -= a[i]*gamma;
+        }
+    }
+    return true;
+}
+
+template<typename F>
+inline bool
+BatchLU( int n, F* A, int lda, int* p )
+{
+    const int bsize = SMALL_BATCH_SIZE;
+    for( int k=0; k<n; k+=bsize )
+    {
+        const int nb = std::min(bsize,n-k);
+        const int nRest = n-(k+nb);
+        if( !BatchPanelLU( n, k, nb, A, lda, p ) )
+            return false;
+        if( nRest > 0 )
+        {
+            const F* A11 = &A[k+k*lda];
+            const F* A21 = &A[(k+nb)+k*lda];
+            F* A12 = &A[k+(k+nb)*lda];
+            F* A22 = &A[(k+nb)+(k+nb)*lda];
+            blas::Trsm
+            ( 'L', 'L', 'N', 'U', nb, nRest, F(1), A11, lda, A12, lda );
+            blas::Gemm
+            ( 'N', 'N', nRest, nRest, nb, 
+              F(-1), A21, lda, A12, lda, F(1), A22, lda );
+        }
+    }
+    return true;
+}
+
+} // namespace internal
+
+template<typename F>
+inline void
+LU( MatrixBatch<F>& A, MatrixBatch<int>& p )
+{
+#ifndef RELEASE
+    PushCallStack("LU");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Batched LU requires square matrices");
+    if( p.Viewing() && 
+        (p.Height() != A.Height() || p.Width() != 1 || 
+         p.Count() != A.Count()) )
+        throw std::logic_error("p must be a batch of vectors conforming "
+                               "with A");
+#endif
+    const int n = A.Height();
+    const int count = A.Count();
+    if( !p.Viewing() )
+        p.ResizeTo( n, 1, count );
+    const int lda = A.LDim();
+    const int strideA = A.Stride();
+    const int strideP = p.Stride();
+    F* ABuffer = A.Buffer();
+    int* pBuffer = p.Buffer();
+    std::vector<char> succeeded( count );
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for
+#endif
+    for( int l=0; l<count; ++l )
+        succeeded[l] = 
+            internal::BatchLU
+            ( n, &ABuffer[l*strideA], lda, &pBuffer[l*strideP] );
+    for( int l=0; l<count; ++l )
+    {
+        if( !succeeded[l] )
+        {
+            std::ostringstream msg;
+            msg << "Matrix " << l << " of the batch was singular";
+            throw SingularMatrixException( msg.str().c_str() );
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+LU( DistMatrixBatch<F>& A, DistMatrixBatch<int>& p )
+{
+#ifndef RELEASE
+    PushCallStack("LU");
+    if( A.Grid() != p.Grid() )
+        throw std::logic_error("{A,p} must be distributed over the same grid");
+#endif
+    p.ResizeTo( A.Height(), 1, A.Count() );
+    LU( A.LocalBatch(), p.LocalBatch() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
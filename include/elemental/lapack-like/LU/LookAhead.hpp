@@ -0,0 +1,164 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace internal {
+
+// LU with partial pivoting and a look-ahead of depth one: the columns of
+// A22 which form the next panel are updated first, so that the next panel can
+// be redistributed while the rest of A22 is updated and then factored before
+// the next iteration begins. The factored panel (and its pivots) is carried
+// over into the next iteration through the *Next temporaries.
+
+template<typename F>
+inline void
+LULookAhead( DistMatrix<F>& A, DistMatrix<int,VC,STAR>& p )
+{
+#ifndef RELEASE
+    PushCallStack("internal::LULookAhead");
+#endif
+    const Grid& g = A.Grid();
+
+    // Matrix views
+    DistMatrix<F>
+        ATL(g), ATR(g),  A00(g), A01(g), A02(g),  AB(g),
+        ABL(g), ABR(g),  A10(g), A11(g), A12(g),
+                         A20(g), A21(g), A22(g);
+    DistMatrix<F> A22L(g), A22R(g), A11Next(g), A21Next(g);
+
+    DistMatrix<int,VC,STAR>
+        pT(g),  p0(g),
+        pB(g),  p1(g),
+                p2(g);
+
+    // Temporary distributions
+    DistMatrix<F,  STAR,STAR> A11_STAR_STAR(g), A11Next_STAR_STAR(g);
+    DistMatrix<F,  MC,  STAR> A21_MC_STAR(g), A21Next_MC_STAR(g);
+    DistMatrix<F,  STAR,VR  > A12_STAR_VR(g);
+    DistMatrix<F,  STAR,MR  > A12_STAR_MR(g), A12L_STAR_MR(g), A12R_STAR_MR(g);
+    DistMatrix<int,STAR,STAR> p1_STAR_STAR(g), p1Next_STAR_STAR(g);
+    RedistPlan<F,MC,STAR,MC,MR> panelPlan;
+
+    // Pivot composition
+    std::vector<int> image, preimage;
+
+    // Factor the first panel
+    const int firstWidth =
+        std::min(Blocksize(),std::min(A.Height(),A.Width()));
+    LockedView( A11Next, A, 0, 0, firstWidth, firstWidth );
+    LockedView
+    ( A21Next, A, firstWidth, 0, A.Height()-firstWidth, firstWidth );
+    A11_STAR_STAR = A11Next;
+    panelPlan.Execute( A21_MC_STAR, A21Next );
+    p1_STAR_STAR.ResizeTo( firstWidth, 1 );
+    internal::PanelLU( A11_STAR_STAR, A21_MC_STAR, p1_STAR_STAR, 0 );
+
+    // Start the algorithm
+    PartitionDownDiagonal
+    ( A, ATL, ATR,
+         ABL, ABR, 0 );
+    PartitionDown
+    ( p, pT,
+         pB, 0 );
+    while( ATL.Height() < A.Height() && ATL.Width() < A.Width() )
+    {
+        RepartitionDownDiagonal
+        ( ATL, /**/ ATR,  A00, /**/ A01, A02,
+         /*************/ /******************/
+               /**/       A10, /**/ A11, A12,
+          ABL, /**/ ABR,  A20, /**/ A21, A22 );
+
+        RepartitionDown
+        ( pT,  p0,
+         /**/ /**/
+               p1,
+          pB,  p2 );
+
+        View1x2( AB, ABL, ABR );
+
+        const int pivotOffset = A01.Height();
+        const int nextWidth =
+            std::min(Blocksize(),std::min(A22.Height(),A22.Width()));
+        A12_STAR_VR.AlignWith( A22 );
+        A12_STAR_MR.AlignWith( A22 );
+        //--------------------------------------------------------------------//
+        // The current panel was factored during the previous iteration
+        internal::ComposePanelPivots
+        ( p1_STAR_STAR, pivotOffset, image, preimage );
+        ApplyRowPivots( AB, image, preimage );
+
+        A12_STAR_VR = A12;
+        internal::LocalTrsm
+        ( LEFT, LOWER, NORMAL, UNIT, F(1), A11_STAR_STAR, A12_STAR_VR );
+        A12_STAR_MR = A12_STAR_VR;
+
+        A11 = A11_STAR_STAR;
+        A12 = A12_STAR_MR;
+        A21 = A21_MC_STAR;
+        p1 = p1_STAR_STAR;
+
+        if( nextWidth > 0 )
+        {
+            // Update the next panel and begin gathering it
+            PartitionRight( A22, A22L, A22R, nextWidth );
+            LockedPartitionRight
+            ( A12_STAR_MR, A12L_STAR_MR, A12R_STAR_MR, nextWidth );
+            internal::LocalGemm
+            ( NORMAL, NORMAL, F(-1), A21_MC_STAR, A12L_STAR_MR, F(1), A22L );
+            LockedPartitionDown
+            ( A22L, A11Next,
+                    A21Next, nextWidth );
+            A21Next_MC_STAR.FreeAlignments();
+            StartRedistribute( panelPlan, A21Next_MC_STAR, A21Next );
+            A11Next_STAR_STAR = A11Next;
+
+            // Update the remainder of A22 while the panel is in flight
+            internal::LocalGemm
+            ( NORMAL, NORMAL, F(-1), A21_MC_STAR, A12R_STAR_MR, F(1), A22R );
+
+            // Factor the next panel
+            panelPlan.Wait();
+            p1Next_STAR_STAR.ResizeTo( nextWidth, 1 );
+            internal::PanelLU
+            ( A11Next_STAR_STAR, A21Next_MC_STAR, p1Next_STAR_STAR,
+              pivotOffset+A11.Width() );
+
+            A11_STAR_STAR = A11Next_STAR_STAR;
+            A21_MC_STAR.FreeAlignments();
+            A21_MC_STAR = A21Next_MC_STAR;
+            p1_STAR_STAR = p1Next_STAR_STAR;
+        }
+        else
+        {
+            internal::LocalGemm
+            ( NORMAL, NORMAL, F(-1), A21_MC_STAR, A12_STAR_MR, F(1), A22 );
+        }
+        //--------------------------------------------------------------------//
+        A12_STAR_VR.FreeAlignments();
+        A12_STAR_MR.FreeAlignments();
+
+        SlidePartitionDownDiagonal
+        ( ATL, /**/ ATR,  A00, A01, /**/ A02,
+               /**/       A10, A11, /**/ A12,
+         /*************/ /******************/
+          ABL, /**/ ABR,  A20, A21, /**/ A22 );
+
+        SlidePartitionDown
+        ( pT,  p0,
+               p1,
+         /**/ /**/
+          pB,  p2 );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace internal
+} // namespace elem
@@ -0,0 +1,150 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace internal {
+
+// The previous panels are never rewritten during the sweep, so the rows of
+// panel j's multipliers are only permuted by its own pivots and those of the
+// panels before it. Each panel is therefore updated with panel j only after
+// it has been pivoted consistently, i.e., by the pivots of panels 0,...,j,
+// and the later pivots are applied to the multipliers in a final pass.
+template<typename F>
+class LUOutOfCoreUpdater
+{
+public:
+    LUOutOfCoreUpdater( int n ) : pivots_(n) { }
+
+    void Update( int k, DistMatrix<F>& Pk, int j, const DistMatrix<F>& Pj )
+    {
+        const Grid& g = Pk.Grid();
+        const int n = Pk.Height();
+        const int nb = Pk.Width();
+        const int nbj = Pj.Width();
+        DistMatrix<F> PjT(g), PjB(g), PkT(g), PkB(g), PkBottom(g);
+
+        // Apply the pivots from panel j's factorization
+        DistMatrix<int,STAR,STAR> pj( nbj, 1, g );
+        MemCopy( pj.LocalBuffer(), &pivots_[j], nbj );
+        internal::ComposePanelPivots( pj, j, image_, preimage_ );
+        View( PkBottom, Pk, j, 0, n-j, nb );
+        ApplyRowPivots( PkBottom, image_, preimage_ );
+
+        // U(j:j+nbj,k:k+nb) := inv(L(j:j+nbj,j:j+nbj)) A(j:j+nbj,k:k+nb) and
+        // A(j+nbj:n,k:k+nb) -= L(j+nbj:n,j:j+nbj) U(j:j+nbj,k:k+nb)
+        LockedView( PjT, Pj, j,     0, nbj,       nbj );
+        LockedView( PjB, Pj, j+nbj, 0, n-j-nbj,   nbj );
+        View( PkT, Pk, j,     0, nbj,     nb );
+        View( PkB, Pk, j+nbj, 0, n-j-nbj, nb );
+        Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), PjT, PkT );
+        Gemm( NORMAL, NORMAL, F(-1), PjB, PkT, F(1), PkB );
+    }
+
+    void Factor( int k, DistMatrix<F>& Pk )
+    {
+        const Grid& g = Pk.Grid();
+        const int n = Pk.Height();
+        const int nb = Pk.Width();
+        DistMatrix<F> PkBottom(g);
+        DistMatrix<int,VC,STAR> pk(g);
+        View( PkBottom, Pk, k, 0, n-k, nb );
+        LU( PkBottom, pk );
+
+        // Store the pivots relative to the entire matrix
+        DistMatrix<int,STAR,STAR> pk_STAR_STAR( pk );
+        for( int i=0; i<nb; ++i )
+            pivots_[k+i] = pk_STAR_STAR.GetLocal(i,0) + k;
+    }
+
+    const std::vector<int>& Pivots() const { return pivots_; }
+
+private:
+    std::vector<int> pivots_, image_, preimage_;
+};
+
+} // namespace internal
+
+template<typename F>
+inline void
+LU( OutOfCoreMatrix<F>& A, DistMatrix<int,VC,STAR>& p )
+{
+#ifndef RELEASE
+    PushCallStack("LU");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Out-of-core LU requires a square matrix");
+    if( A.Grid() != p.Grid() )
+        throw std::logic_error("{A,p} must be distributed over the same grid");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const int bsize = Blocksize();
+    internal::LUOutOfCoreUpdater<F> updater( n );
+    internal::LeftLookingOutOfCore( A, updater );
+    const std::vector<int>& pivots = updater.Pivots();
+
+    // Apply the pivots of the later panels to the multipliers of each panel,
+    // prefetching the next panel while the current one is permuted. The
+    // composition of the later pivots is formed from the back, so that each
+    // panel only requires O(n) work to form its permutation: destination[i]
+    // is the final position of row i.
+    const int numPanels = ( n + bsize - 1 ) / bsize;
+    std::vector<int> destination( n ), image, preimage;
+    for( int i=0; i<n; ++i )
+        destination[i] = i;
+    DistMatrix<F> P0(g), P1(g), PBottom(g);
+    DistMatrix<F>* P[2] = { &P0, &P1 };
+    mpi::Request readRequest, writeRequests[2];
+    writeRequests[0] = writeRequests[1] = mpi::REQUEST_NULL;
+    if( numPanels > 1 )
+    {
+        const int jPanel = numPanels-2;
+        A.StartReadPanel( jPanel*bsize, bsize, *P[jPanel%2], readRequest );
+    }
+    for( int jPanel=numPanels-2; jPanel>=0; --jPanel )
+    {
+        const int j = jPanel*bsize;
+        const int jNext = j + bsize;
+        DistMatrix<F>& Pj = *P[jPanel%2];
+        mpi::Wait( readRequest );
+        mpi::Wait( writeRequests[(jPanel+1)%2] );
+        if( jPanel > 0 )
+            A.StartReadPanel
+            ( j-bsize, bsize, *P[(jPanel+1)%2], readRequest );
+
+        // Prepend the pivots of panel j+1 to the composition
+        const int nbNext = std::min(bsize,n-jNext);
+        for( int i=jNext+nbNext-1; i>=jNext; --i )
+            std::swap( destination[i], destination[pivots[i]] );
+        image.resize( n-jNext );
+        preimage.resize( n-jNext );
+        for( int i=jNext; i<n; ++i )
+        {
+            preimage[i-jNext] = destination[i]-jNext;
+            image[destination[i]-jNext] = i-jNext;
+        }
+        View( PBottom, Pj, jNext, 0, n-jNext, Pj.Width() );
+        ApplyRowPivots( PBottom, image, preimage );
+        A.StartWritePanel( j, Pj, writeRequests[jPanel%2] );
+    }
+    mpi::Wait( writeRequests[0] );
+    mpi::Wait( writeRequests[1] );
+
+    // Distribute the pivots
+    p.ResizeTo( n, 1 );
+    const int colShift = p.ColShift();
+    const int colStride = p.ColStride();
+    const int localHeight = p.LocalHeight();
+    for( int iLocal=0; iLocal<localHeight; ++iLocal )
+        p.SetLocal( iLocal, 0, pivots[colShift+iLocal*colStride] );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
@@ -106,6 +106,16 @@ PanelLU
     if( A.Height() != p.Height() || p.Width() != 1 )
         throw std::logic_error("p must be a vector that conforms with A");
 #endif
+    if( GetLUPanelPivoting() == LU_PANEL_TOURNAMENT && 
+        A.Height() == A.Width() )
+    {
+        TournamentPanelLU( A, B, p, pivotOffset );
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
     const Grid& g = A.Grid();
     const int r = g.Height();
     const int colShift = B.ColShift();
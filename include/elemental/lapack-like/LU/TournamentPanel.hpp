@@ -0,0 +1,304 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace internal {
+
+// Tournament pivoting (as in communication-avoiding LU, or CALU) for the
+// panel [A; B], where A is replicated and B is distributed over each process
+// column. Each process selects its best pivot candidates with Gaussian
+// elimination with partial pivoting (GEPP) on its own rows, and the candidate
+// sets are then played off against each other along a butterfly over the
+// process column, so that all of the panel's pivots are selected with
+// log2(r) messages rather than with one reduction per column.
+//
+// A set of candidates is exchanged as a single message of the form
+//   [ candidate rows (row-major) | number of candidates | row indices ],
+// where the row indices are relative to the top of the panel, with the rows
+// of B following those of A.
+
+template<typename F>
+class PivotCandidates
+{
+public:
+    PivotCandidates( int width, int maxRows )
+    : width_(width), maxRows_(maxRows),
+      data_(maxRows*width*sizeof(F)+(maxRows+1)*sizeof(int))
+    { SetNumRows( 0 ); }
+
+    int Width() const { return width_; }
+    int MaxRows() const { return maxRows_; }
+    int NumRows() const { return *Header(); }
+    void SetNumRows( int numRows ) { *Header() = numRows; }
+
+    F* Row( int i ) { return (F*)&data_[i*width_*sizeof(F)]; }
+    const F* Row( int i ) const
+    { return (const F*)&data_[i*width_*sizeof(F)]; }
+    int& Index( int i ) { return Header()[i+1]; }
+    int Index( int i ) const { return Header()[i+1]; }
+
+    byte* Buffer() { return &data_[0]; }
+    int NumBytes() const { return data_.size(); }
+
+    void Push( const F* row, int rowStride, int index )
+    {
+        const int i = NumRows();
+        F* dest = Row( i );
+        for( int j=0; j<width_; ++j )
+            dest[j] = row[j*rowStride];
+        Index( i ) = index;
+        SetNumRows( i+1 );
+    }
+
+    void Append( const PivotCandidates<F>& other )
+    {
+        for( int i=0; i<other.NumRows(); ++i )
+            Push( other.Row(i), 1, other.Index(i) );
+    }
+
+private:
+    int width_, maxRows_;
+    std::vector<byte> data_;
+
+    int* Header() { return (int*)&data_[maxRows_*width_*sizeof(F)]; }
+    const int* Header() const
+    { return (const int*)&data_[maxRows_*width_*sizeof(F)]; }
+};
+
+// Run GEPP on the first numPivots columns of a copy of the candidates and
+// keep only the selected rows (in pivot order) of the original candidates
+template<typename F>
+inline void
+SelectPivotCandidates
+( PivotCandidates<F>& candidates, int numPivots,
+  PivotCandidates<F>& selection )
+{
+#ifndef RELEASE
+    PushCallStack("internal::SelectPivotCandidates");
+#endif
+    typedef typename Base<F>::type R;
+    const int numRows = candidates.NumRows();
+    const int width = candidates.Width();
+    numPivots = std::min(numPivots,numRows);
+
+    std::vector<F> work( numRows*width );
+    std::vector<int> order( numRows );
+    for( int i=0; i<numRows; ++i )
+    {
+        MemCopy( &work[i*width], candidates.Row(i), width );
+        order[i] = i;
+    }
+
+    for( int j=0; j<numPivots; ++j )
+    {
+        int pivotRow = j;
+        R pivotValue = FastAbs(work[j*width+j]);
+        for( int i=j+1; i<numRows; ++i )
+        {
+            const R value = FastAbs(work[i*width+j]);
+            if( value > pivotValue )
+            {
+                pivotValue = value;
+                pivotRow = i;
+            }
+        }
+        if( pivotRow != j )
+        {
+            for( int k=0; k<width; ++k )
+                std::swap( work[j*width+k], work[pivotRow*width+k] );
+            std::swap( order[j], order[pivotRow] );
+        }
+
+        const F pivot = work[j*width+j];
+        if( pivot == F(0) )
+            continue;
+        const F pivotInv = F(1) / pivot;
+        for( int i=j+1; i<numRows; ++i )
+        {
+            const F gamma = work[i*width+j]*pivotInv;
+            F* workRow = &work[i*width];
+            const F* pivotWorkRow = &work[j*width];
+            for( int k=j+1; k<width; ++k )
+                workRow[k] -= gamma*pivotWorkRow[k];
+        }
+    }
+
+    selection.SetNumRows( 0 );
+    for( int i=0; i<numPivots; ++i )
+        selection.Push
+        ( candidates.Row(order[i]), 1, candidates.Index(order[i]) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// Play the candidates of this process against those of a partner in the
+// process column. Both partners stack the lower-ranked process's candidates on
+// top so that they arrive at identical selections.
+template<typename F>
+inline void
+PlayPivotCandidates
+( PivotCandidates<F>& mine, const PivotCandidates<F>& theirs,
+  bool mineFirst, int numPivots, PivotCandidates<F>& stack )
+{
+    stack.SetNumRows( 0 );
+    if( mineFirst )
+    {
+        stack.Append( mine );
+        stack.Append( theirs );
+    }
+    else
+    {
+        stack.Append( theirs );
+        stack.Append( mine );
+    }
+    SelectPivotCandidates( stack, numPivots, mine );
+}
+
+template<typename F>
+inline void
+TournamentPanelLU
+( DistMatrix<F,  STAR,STAR>& A,
+  DistMatrix<F,  MC,  STAR>& B,
+  DistMatrix<int,STAR,STAR>& p,
+  int pivotOffset )
+{
+#ifndef RELEASE
+    PushCallStack("internal::TournamentPanelLU");
+    if( A.Grid() != p.Grid() || p.Grid() != B.Grid() )
+        throw std::logic_error
+        ("Matrices must be distributed over the same grid");
+    if( A.Width() != B.Width() )
+        throw std::logic_error("A and B must be the same width");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Tournament pivoting requires a square A");
+    if( A.Height() != p.Height() || p.Width() != 1 )
+        throw std::logic_error("p must be a vector that conforms with A");
+#endif
+    const Grid& g = A.Grid();
+    const int r = g.Height();
+    const int colShift = B.ColShift();
+    const int colAlignment = B.ColAlignment();
+    const int n = A.Width();
+    const int localHeightOfB = B.LocalHeight();
+    const mpi::Comm colComm = g.ColComm();
+    const int colRank = mpi::CommRank( colComm );
+
+    // Select the best local candidates (the rows of A are only entered into
+    // the tournament by the root of the process column)
+    PivotCandidates<F>
+        local( n, n+localHeightOfB ), mine( n, n ), theirs( n, n ),
+        stack( n, 2*n );
+    const F* ABuffer = A.LockedLocalBuffer();
+    const F* BBuffer = B.LockedLocalBuffer();
+    const int ALDim = A.LocalLDim();
+    const int BLDim = B.LocalLDim();
+    if( colRank == 0 )
+        for( int i=0; i<n; ++i )
+            local.Push( &ABuffer[i], ALDim, i );
+    for( int iLocal=0; iLocal<localHeightOfB; ++iLocal )
+        local.Push( &BBuffer[iLocal], BLDim, n+colShift+iLocal*r );
+    SelectPivotCandidates( local, n, mine );
+
+    // Fold the processes beyond the largest power of two into the butterfly
+    int powerOfTwo = 1;
+    while( 2*powerOfTwo <= r )
+        powerOfTwo *= 2;
+    const int numBytes = mine.NumBytes();
+    if( colRank >= powerOfTwo )
+    {
+        mpi::Send( mine.Buffer(), numBytes, colRank-powerOfTwo, 0, colComm );
+        mpi::Recv( mine.Buffer(), numBytes, colRank-powerOfTwo, 0, colComm );
+    }
+    else
+    {
+        if( colRank+powerOfTwo < r )
+        {
+            mpi::Recv
+            ( theirs.Buffer(), numBytes, colRank+powerOfTwo, 0, colComm );
+            PlayPivotCandidates( mine, theirs, true, n, stack );
+        }
+        for( int mask=1; mask<powerOfTwo; mask*=2 )
+        {
+            const int partner = colRank ^ mask;
+            mpi::SendRecv
+            ( mine.Buffer(),   numBytes, partner, 0,
+              theirs.Buffer(), numBytes, partner, 0, colComm );
+            PlayPivotCandidates( mine, theirs, colRank<partner, n, stack );
+        }
+        if( colRank+powerOfTwo < r )
+            mpi::Send
+            ( mine.Buffer(), numBytes, colRank+powerOfTwo, 0, colComm );
+    }
+
+    // Convert the winners into a sequence of row swaps. Since each swap moves
+    // a winner into the top of the panel, only original rows of A are ever
+    // swapped down into B.
+    std::map<int,int> contentOf, positionOf;
+    for( int i=0; i<n; ++i )
+    {
+        const int winner = mine.Index(i);
+        const int winnerPosition =
+            ( positionOf.count(winner) ? positionOf[winner] : winner );
+        const int displaced = ( contentOf.count(i) ? contentOf[i] : i );
+        p.SetLocal( i, 0, winnerPosition+pivotOffset );
+
+        contentOf[winnerPosition] = displaced;
+        positionOf[displaced] = winnerPosition;
+        contentOf[i] = winner;
+        positionOf[winner] = i;
+    }
+
+    // Move the displaced rows of A into B
+    std::map<int,int>::const_iterator it;
+    for( it=contentOf.begin(); it!=contentOf.end(); ++it )
+    {
+        const int position = it->first;
+        const int content = it->second;
+        if( position < n )
+            continue;
+#ifndef RELEASE
+        if( content >= n )
+            throw std::logic_error("Invalid tournament row swap");
+#endif
+        const int ownerRank = (colAlignment+(position-n)) % r;
+        if( g.Row() == ownerRank )
+        {
+            const int localRow = ((position-n)-colShift) / r;
+            F* BRow = B.LocalBuffer(localRow,0);
+            const F* ARow = &ABuffer[content];
+            for( int j=0; j<n; ++j )
+                BRow[j*BLDim] = ARow[j*ALDim];
+        }
+    }
+
+    // Move the winners into A
+    F* AWriteBuffer = A.LocalBuffer();
+    for( int i=0; i<n; ++i )
+    {
+        const F* winnerRow = mine.Row(i);
+        for( int j=0; j<n; ++j )
+            AWriteBuffer[i+j*ALDim] = winnerRow[j];
+    }
+
+    // Factor the panel without any further pivoting
+    LU( A.LocalMatrix() );
+    for( int j=0; j<n; ++j )
+        if( A.GetLocal(j,j) == F(0) )
+            throw SingularMatrixException();
+    Trsm
+    ( RIGHT, UPPER, NORMAL, NON_UNIT,
+      F(1), A.LockedLocalMatrix(), B.LocalMatrix() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace internal
+} // namespace elem
@@ -0,0 +1,87 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace internal {
+
+// The left-looking ordering reads each of the previous panels once per panel
+// and writes each panel exactly once, whereas a right-looking out-of-core
+// algorithm would rewrite the entire trailing matrix after every panel.
+//
+// Panel k is held in P[k%3]: while it is updated and factored, panel k+1 is
+// prefetched into P[(k+1)%3] and panel k-1 (whose write may still be in
+// flight) is reused directly from P[(k-1)%3]. The older panels are streamed
+// through a pair of buffers, so that the read of panel j+1 overlaps the
+// update with panel j. At most five panels are held in memory at once.
+template<typename F,class PanelUpdater>
+inline void
+LeftLookingOutOfCore( OutOfCoreMatrix<F>& A, PanelUpdater& updater )
+{
+#ifndef RELEASE
+    PushCallStack("internal::LeftLookingOutOfCore");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Width();
+    const int bsize = Blocksize();
+    const int numPanels = ( n + bsize - 1 ) / bsize;
+
+    DistMatrix<F> P0(g), P1(g), P2(g), S0(g), S1(g);
+    DistMatrix<F>* P[3] = { &P0, &P1, &P2 };
+    DistMatrix<F>* S[2] = { &S0, &S1 };
+    mpi::Request readRequest, streamRequests[2], writeRequests[3];
+    for( int i=0; i<3; ++i )
+        writeRequests[i] = mpi::REQUEST_NULL;
+
+    if( numPanels > 0 )
+        A.StartReadPanel( 0, std::min(bsize,n), *P[0], readRequest );
+    for( int kPanel=0; kPanel<numPanels; ++kPanel )
+    {
+        const int k = kPanel*bsize;
+        DistMatrix<F>& Pk = *P[kPanel%3];
+        mpi::Wait( readRequest );
+
+        // Panel k-2 must be on disk before it is streamed back in, and its
+        // buffer is about to be reused for prefetching panel k+1
+        mpi::Wait( writeRequests[(kPanel+1)%3] );
+        if( kPanel+1 < numPanels )
+        {
+            const int kNext = k + bsize;
+            A.StartReadPanel
+            ( kNext, std::min(bsize,n-kNext), *P[(kPanel+1)%3], readRequest );
+        }
+
+        if( kPanel > 1 )
+            A.StartReadPanel( 0, bsize, *S[0], streamRequests[0] );
+        for( int jPanel=0; jPanel<kPanel; ++jPanel )
+        {
+            const int j = jPanel*bsize;
+            if( jPanel == kPanel-1 )
+            {
+                updater.Update( k, Pk, j, *P[jPanel%3] );
+                continue;
+            }
+            mpi::Wait( streamRequests[jPanel%2] );
+            if( jPanel+1 < kPanel-1 )
+                A.StartReadPanel
+                ( j+bsize, bsize, *S[(jPanel+1)%2],
+                  streamRequests[(jPanel+1)%2] );
+            updater.Update( k, Pk, j, *S[jPanel%2] );
+        }
+        updater.Factor( k, Pk );
+        A.StartWritePanel( k, Pk, writeRequests[kPanel%3] );
+    }
+    for( int i=0; i<3; ++i )
+        mpi::Wait( writeRequests[i] );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace internal
+} // namespace elem
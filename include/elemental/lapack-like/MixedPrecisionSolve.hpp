@@ -0,0 +1,252 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace internal {
+
+template<typename F> struct ReducedPrecision { };
+template<> struct ReducedPrecision<double> { typedef float type; };
+template<>
+struct ReducedPrecision<Complex<double> > { typedef Complex<float> type; };
+
+template<typename S,typename T>
+inline void
+ConvertScalar( const T& alpha, S& beta )
+{ beta = alpha; }
+
+template<typename S,typename T>
+inline void
+ConvertScalar( const Complex<T>& alpha, Complex<S>& beta )
+{ beta = Complex<S>( alpha.real, alpha.imag ); }
+
+// Entrywise conversion between the precisions of two [MC,MR] matrices,
+// which requires no communication since B is aligned with A
+template<typename T,typename S>
+inline void
+ConvertPrecision( const DistMatrix<T>& A, DistMatrix<S>& B )
+{
+#ifndef RELEASE
+    PushCallStack("internal::ConvertPrecision");
+#endif
+    if( B.ColAlignment() != A.ColAlignment() ||
+        B.RowAlignment() != A.RowAlignment() )
+    {
+        B.Empty();
+        B.AlignWith( A );
+    }
+    B.ResizeTo( A.Height(), A.Width() );
+
+    const int localHeight = A.LocalHeight();
+    const int localWidth = A.LocalWidth();
+    const T* ABuffer = A.LockedLocalBuffer();
+    const int ALDim = A.LocalLDim();
+    S* BBuffer = B.LocalBuffer();
+    const int BLDim = B.LocalLDim();
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+            ConvertScalar
+            ( ABuffer[iLocal+jLocal*ALDim], BBuffer[iLocal+jLocal*BLDim] );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// Solves with a reduced-precision LU factorization of A and forms residuals
+// with the original A
+template<typename F>
+class MixedLUSolver
+{
+public:
+    typedef typename ReducedPrecision<F>::type S;
+
+    MixedLUSolver( const DistMatrix<F>& A )
+    : A_(A), ALow_(A.Grid()), p_(A.Grid()), XLow_(A.Grid())
+    {
+        ConvertPrecision( A, ALow_ );
+        LU( ALow_, p_ );
+    }
+
+    void Solve( DistMatrix<F>& X )
+    {
+        ConvertPrecision( X, XLow_ );
+        SolveAfterLU( NORMAL, ALow_, p_, XLow_ );
+        ConvertPrecision( XLow_, X );
+    }
+
+    // R := R - A X
+    void UpdateResidual( const DistMatrix<F>& X, DistMatrix<F>& R ) const
+    { Gemm( NORMAL, NORMAL, F(-1), A_, X, F(1), R ); }
+
+private:
+    const DistMatrix<F>& A_;
+    DistMatrix<S> ALow_;
+    DistMatrix<int,VC,STAR> p_;
+    DistMatrix<S> XLow_;
+};
+
+// Solves with a reduced-precision Cholesky factorization of A (which throws
+// a NonHPDMatrixException if A is not numerically HPD in that precision)
+template<typename F>
+class MixedCholeskySolver
+{
+public:
+    typedef typename ReducedPrecision<F>::type S;
+
+    MixedCholeskySolver( UpperOrLower uplo, const DistMatrix<F>& A )
+    : uplo_(uplo), A_(A), ALow_(A.Grid()), XLow_(A.Grid())
+    {
+        ConvertPrecision( A, ALow_ );
+        Cholesky( uplo, ALow_ );
+    }
+
+    void Solve( DistMatrix<F>& X )
+    {
+        ConvertPrecision( X, XLow_ );
+        SolveAfterCholesky( uplo_, NORMAL, ALow_, XLow_ );
+        ConvertPrecision( XLow_, X );
+    }
+
+    // R := R - A X
+    void UpdateResidual( const DistMatrix<F>& X, DistMatrix<F>& R ) const
+    { Hemm( LEFT, uplo_, F(-1), A_, X, F(1), R ); }
+
+private:
+    UpperOrLower uplo_;
+    const DistMatrix<F>& A_;
+    DistMatrix<S> ALow_;
+    DistMatrix<S> XLow_;
+};
+
+// Iteratively refine X ~= inv(A) B until, as in LAPACK's [d,z]sgesv,
+//     || B - A X ||_max <= || X ||_max || A ||_max sqrt(n) eps,
+// returning the number of refinement steps, or -1 if the residual norm failed
+// to decrease by at least a factor of two or maxIts steps were not enough.
+template<typename F,class MixedSolver>
+inline int
+MixedRefinement
+( MixedSolver& solver, typename Base<F>::type ANorm,
+  const DistMatrix<F>& B, DistMatrix<F>& X, int maxIts )
+{
+#ifndef RELEASE
+    PushCallStack("internal::MixedRefinement");
+#endif
+    typedef typename Base<F>::type R;
+    const R tol = ANorm*lapack::MachineEpsilon<R>()*Sqrt(R(B.Height()));
+
+    X = B;
+    solver.Solve( X );
+    DistMatrix<F> Residual( B.Grid() );
+    R lastResidualNorm = 0;
+    int its = -1;
+    for( int it=0; it<=maxIts; ++it )
+    {
+        Residual = B;
+        solver.UpdateResidual( X, Residual );
+        const R residualNorm = Norm( Residual, MAX_NORM );
+        if( residualNorm <= tol*Norm( X, MAX_NORM ) )
+        {
+            its = it;
+            break;
+        }
+        // The negated comparison also catches NaN's
+        if( it == maxIts || (it > 0 && !(2*residualNorm < lastResidualNorm)) )
+            break;
+        lastResidualNorm = residualNorm;
+
+        solver.Solve( Residual );
+        Axpy( F(1), Residual, X );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return its;
+}
+
+} // namespace internal
+
+template<typename F>
+inline int
+LinearSolveMixed( DistMatrix<F>& A, DistMatrix<F>& B, int maxIts )
+{
+#ifndef RELEASE
+    PushCallStack("LinearSolveMixed");
+    if( A.Grid() != B.Grid() )
+        throw std::logic_error("{A,B} must be distributed over the same grid");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( A.Height() != B.Height() )
+        throw std::logic_error("A and B must be the same height");
+#endif
+    typedef typename Base<F>::type R;
+    typedef typename internal::ReducedPrecision<F>::type S;
+    typedef typename Base<S>::type RS;
+
+    // Entries beyond the range of the reduced precision cannot be converted
+    int its = -1;
+    const R ANorm = Norm( A, MAX_NORM );
+    const R overflow = lapack::MachineOverflowThreshold<RS>();
+    if( ANorm <= overflow && Norm( B, MAX_NORM ) <= overflow )
+    {
+        internal::MixedLUSolver<F> solver( A );
+        DistMatrix<F> X( A.Grid() );
+        its = internal::MixedRefinement( solver, ANorm, B, X, maxIts );
+        if( its >= 0 )
+            B = X;
+    }
+    if( its < 0 )
+        GaussianElimination( A, B );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return its;
+}
+
+template<typename F>
+inline int
+CholeskySolveMixed
+( UpperOrLower uplo, DistMatrix<F>& A, DistMatrix<F>& B, int maxIts )
+{
+#ifndef RELEASE
+    PushCallStack("CholeskySolveMixed");
+    if( A.Grid() != B.Grid() )
+        throw std::logic_error("{A,B} must be distributed over the same grid");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( A.Height() != B.Height() )
+        throw std::logic_error("A and B must be the same height");
+#endif
+    typedef typename Base<F>::type R;
+    typedef typename internal::ReducedPrecision<F>::type S;
+    typedef typename Base<S>::type RS;
+
+    int its = -1;
+    const R ANorm = HermitianNorm( uplo, A, MAX_NORM );
+    const R overflow = lapack::MachineOverflowThreshold<RS>();
+    if( ANorm <= overflow && Norm( B, MAX_NORM ) <= overflow )
+    {
+        try
+        {
+            internal::MixedCholeskySolver<F> solver( uplo, A );
+            DistMatrix<F> X( A.Grid() );
+            its = internal::MixedRefinement( solver, ANorm, B, X, maxIts );
+            if( its >= 0 )
+                B = X;
+        }
+        // A may be too ill-conditioned to be HPD in the reduced precision
+        catch( NonHPDMatrixException& e ) { }
+    }
+    if( its < 0 )
+        CholeskySolve( uplo, A, B );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return its;
+}
+
+} // namespace elem
@@ -0,0 +1,311 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+template<typename F>
+inline bool
+PackedReflectors<F>::PanelKey::operator<( const PanelKey& key ) const
+{
+    if( i != key.i )
+        return i < key.i;
+    if( j != key.j )
+        return j < key.j;
+    if( height != key.height )
+        return height < key.height;
+    if( width != key.width )
+        return width < key.width;
+    if( uplo != key.uplo )
+        return uplo < key.uplo;
+    return conjugation < key.conjugation;
+}
+
+template<typename F>
+inline
+PackedReflectors<F>::PackedReflectors( const Grid& g )
+: uplo_(LOWER), dir_(VERTICAL), offset_(0), H_(0), t_(g)
+{ }
+
+template<typename F>
+inline void
+PackedReflectors<F>::Attach
+( UpperOrLower uplo, VerticalOrHorizontal dir, int offset,
+  const DistMatrix<F>& H )
+{
+#ifndef RELEASE
+    PushCallStack("PackedReflectors::Attach");
+#endif
+    uplo_ = uplo;
+    dir_ = dir;
+    offset_ = offset;
+    H_ = &H;
+    t_.Empty();
+    cache_.clear();
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+PackedReflectors<F>::Attach
+( UpperOrLower uplo, VerticalOrHorizontal dir, int offset,
+  const DistMatrix<F>& H, const DistMatrix<F,MD,STAR>& t )
+{
+#ifndef RELEASE
+    PushCallStack("PackedReflectors::Attach");
+    if( H.Grid() != t.Grid() )
+        throw std::logic_error("{H,t} must be distributed over the same grid");
+    if( t.Height() != H.DiagonalLength( offset ) )
+        throw std::logic_error("t must be the same length as H's offset diag.");
+#endif
+    Attach( uplo, dir, offset, H );
+    t_.AlignWithDiagonal( H, offset );
+    t_ = t;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+PackedReflectors<F>::Attach
+( UpperOrLower uplo, VerticalOrHorizontal dir, int offset,
+  const DistMatrix<F>& H, const DistMatrix<F,STAR,STAR>& t )
+{
+#ifndef RELEASE
+    PushCallStack("PackedReflectors::Attach");
+    if( H.Grid() != t.Grid() )
+        throw std::logic_error("{H,t} must be distributed over the same grid");
+    if( t.Height() != H.DiagonalLength( offset ) )
+        throw std::logic_error("t must be the same length as H's offset diag.");
+#endif
+    Attach( uplo, dir, offset, H );
+    t_.AlignWithDiagonal( H, offset );
+    t_ = t;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline UpperOrLower
+PackedReflectors<F>::Uplo() const
+{ return uplo_; }
+
+template<typename F>
+inline VerticalOrHorizontal
+PackedReflectors<F>::Dir() const
+{ return dir_; }
+
+template<typename F>
+inline int
+PackedReflectors<F>::Offset() const
+{ return offset_; }
+
+template<typename F>
+inline const DistMatrix<F>&
+PackedReflectors<F>::H() const
+{
+    if( H_ == 0 )
+        throw std::logic_error("No reflectors have been attached");
+    return *H_;
+}
+
+template<typename F>
+inline const DistMatrix<F,MD,STAR>&
+PackedReflectors<F>::t() const
+{ return t_; }
+
+template<typename F>
+inline int
+PackedReflectors<F>::NumCachedPanels() const
+{ return cache_.size(); }
+
+template<typename F>
+inline void
+PackedReflectors<F>::ClearCache()
+{ cache_.clear(); }
+
+template<typename F>
+inline bool
+PackedReflectors<F>::FindPanel
+( int i, int j, int height, int width, UpperOrLower uplo,
+  Conjugation conjugation, DistMatrix<F,STAR,STAR>& SInv ) const
+{
+    PanelKey key = { i, j, height, width, uplo, conjugation };
+    typename std::map<PanelKey,Matrix<F> >::const_iterator it =
+        cache_.find( key );
+    if( it == cache_.end() )
+        return false;
+    SInv.LocalMatrix() = it->second;
+    return true;
+}
+
+template<typename F>
+inline void
+PackedReflectors<F>::StorePanel
+( int i, int j, int height, int width, UpperOrLower uplo,
+  Conjugation conjugation, const DistMatrix<F,STAR,STAR>& SInv ) const
+{
+    PanelKey key = { i, j, height, width, uplo, conjugation };
+    cache_[key] = SInv.LockedLocalMatrix();
+}
+
+// Factorizations which return their Householder transforms as a
+// PackedReflectors object
+
+template<typename R>
+inline void
+QR( DistMatrix<R>& A, PackedReflectors<R>& Q )
+{
+#ifndef RELEASE
+    PushCallStack("QR");
+#endif
+    QR( A );
+    Q.Attach( LOWER, VERTICAL, 0, A );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename R>
+inline void
+QR( DistMatrix<Complex<R> >& A, PackedReflectors<Complex<R> >& Q )
+{
+#ifndef RELEASE
+    PushCallStack("QR");
+#endif
+    DistMatrix<Complex<R>,MD,STAR> t( A.Grid() );
+    QR( A, t );
+    Q.Attach( LOWER, VERTICAL, 0, A, t );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename R>
+inline void
+LQ( DistMatrix<R>& A, PackedReflectors<R>& Q )
+{
+#ifndef RELEASE
+    PushCallStack("LQ");
+#endif
+    LQ( A );
+    Q.Attach( UPPER, HORIZONTAL, 0, A );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename R>
+inline void
+LQ( DistMatrix<Complex<R> >& A, PackedReflectors<Complex<R> >& Q )
+{
+#ifndef RELEASE
+    PushCallStack("LQ");
+#endif
+    DistMatrix<Complex<R>,MD,STAR> t( A.Grid() );
+    LQ( A, t );
+    Q.Attach( UPPER, HORIZONTAL, 0, A, t );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// A = Q B P^H, where Q and P share the storage of A
+template<typename R>
+inline void
+Bidiag( DistMatrix<R>& A, PackedReflectors<R>& P, PackedReflectors<R>& Q )
+{
+#ifndef RELEASE
+    PushCallStack("Bidiag");
+#endif
+    Bidiag( A );
+    if( A.Height() >= A.Width() )
+    {
+        Q.Attach( LOWER, VERTICAL, 0, A );
+        P.Attach( UPPER, HORIZONTAL, 1, A );
+    }
+    else
+    {
+        Q.Attach( LOWER, VERTICAL, -1, A );
+        P.Attach( UPPER, HORIZONTAL, 0, A );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename R>
+inline void
+Bidiag
+( DistMatrix<Complex<R> >& A,
+  PackedReflectors<Complex<R> >& P, PackedReflectors<Complex<R> >& Q )
+{
+#ifndef RELEASE
+    PushCallStack("Bidiag");
+#endif
+    const Grid& g = A.Grid();
+    DistMatrix<Complex<R>,STAR,STAR> tP(g), tQ(g);
+    Bidiag( A, tP, tQ );
+    if( A.Height() >= A.Width() )
+    {
+        Q.Attach( LOWER, VERTICAL, 0, A, tQ );
+        P.Attach( UPPER, HORIZONTAL, 1, A, tP );
+    }
+    else
+    {
+        Q.Attach( LOWER, VERTICAL, -1, A, tQ );
+        P.Attach( UPPER, HORIZONTAL, 0, A, tP );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename R>
+inline void
+HermitianTridiag
+( UpperOrLower uplo, DistMatrix<R>& A, PackedReflectors<R>& Q )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianTridiag");
+#endif
+    HermitianTridiag( uplo, A );
+    if( uplo == LOWER )
+        Q.Attach( LOWER, VERTICAL, -1, A );
+    else
+        Q.Attach( UPPER, VERTICAL, 1, A );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename R>
+inline void
+HermitianTridiag
+( UpperOrLower uplo, DistMatrix<Complex<R> >& A,
+  PackedReflectors<Complex<R> >& Q )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianTridiag");
+#endif
+    DistMatrix<Complex<R>,STAR,STAR> t( A.Grid() );
+    HermitianTridiag( uplo, A, t );
+    if( uplo == LOWER )
+        Q.Attach( LOWER, VERTICAL, -1, A, t );
+    else
+        Q.Attach( UPPER, VERTICAL, 1, A, t );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
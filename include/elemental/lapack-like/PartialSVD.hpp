@@ -0,0 +1,273 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+// Approximate the k largest singular triplets of the m x n matrix A using
+// Golub-Kahan-Lanczos bidiagonalization with full reorthogonalization. After
+// j steps,
+//
+//   A V_j = U_j B_j,   A^H U_j = V_j B_j^H + beta_j v_{j+1} e_j^T,
+//
+// where B_j is j x j upper bidiagonal and the columns of U_j and V_j are
+// orthonormal. If B_j = X S W^H, then the Ritz triplets (U_j X, S, V_j W)
+// have residuals || A^H U_j x_i - sigma_i V_j w_i ||_2 = beta_j |x_i(j)|,
+// and the iteration stops once each of the k largest is at most
+// tol || A ||_2, where || A ||_2 is estimated by the largest Ritz value.
+//
+// The Lanczos vectors are stored in [VC,* ] matrices (whose widths are 
+// doubled as needed) so that each reorthogonalization requires a single 
+// AllReduce of j entries, and every process redundantly computes the SVD of 
+// B_j. Unlike RandomizedSVD, the number of products with A adapts to the 
+// spectrum, which makes PartialSVD preferable when the singular values decay 
+// slowly. The number of Lanczos steps is returned.
+
+namespace svd {
+
+// v := v - V V^H v, performed twice to maintain orthogonality to working
+// precision ("twice is enough")
+template<typename F>
+inline void
+Reorthogonalize
+( const DistMatrix<F,VC,STAR>& V, DistMatrix<F,VC,STAR>& v )
+{
+    if( V.Width() == 0 )
+        return;
+    Matrix<F> coefficients;
+    for( int pass=0; pass<2; ++pass )
+    {
+        internal::InnerProducts( V, v, coefficients );
+        Gemm
+        ( NORMAL, NORMAL,
+          F(-1), V.LockedLocalMatrix(), coefficients,
+          F(1), v.LocalMatrix() );
+    }
+}
+
+// Replace a (numerically) zero Lanczos vector with a random unit vector
+// orthogonal to the current basis. This handles invariant subspaces, e.g.,
+// when the rank of A is smaller than the number of requested triplets.
+template<typename F>
+inline void
+RandomOrthogonalVector
+( const DistMatrix<F,VC,STAR>& V, DistMatrix<F,VC,STAR>& v )
+{
+    typedef typename Base<F>::type R;
+    MakeGaussian( v );
+    Reorthogonalize( V, v );
+    const R norm = Norm( v );
+    if( norm != R(0) )
+        Scale( R(1)/norm, v );
+}
+
+// Ensure that the basis has at least the specified number of columns
+template<typename F>
+inline void
+GrowBasis( DistMatrix<F,VC,STAR>& V, int minWidth, int maxWidth )
+{
+    const int height = V.Height();
+    const int width = V.Width();
+    if( width >= minWidth )
+        return;
+    const int newWidth = std::min( std::max(2*width,minWidth), maxWidth );
+    DistMatrix<F,VC,STAR> VOld( V ), VOldView( V.Grid() );
+    Zeros( height, newWidth, V );
+    View( VOldView, V, 0, 0, height, width );
+    VOldView = VOld;
+}
+
+// Compute the singular values of the j x j upper bidiagonal matrix B with
+// diagonal d and superdiagonal e, as well as the last row of its left
+// singular vectors
+template<typename F>
+inline void
+BidiagLastRow
+( const std::vector<typename Base<F>::type>& d,
+  const std::vector<typename Base<F>::type>& e,
+  std::vector<typename Base<F>::type>& sigma, Matrix<F>& lastRow )
+{
+    typedef typename Base<F>::type R;
+    const int j = d.size();
+    sigma = d;
+    std::vector<R> eCopy( std::max(j-1,1), 0 );
+    for( int i=0; i<j-1; ++i )
+        eCopy[i] = e[i];
+    Zeros( 1, j, lastRow );
+    lastRow.Set( 0, j-1, F(1) );
+    F* VAdj = 0;
+    lapack::BidiagQRAlg
+    ( 'U', j, 0, 1, &sigma[0], &eCopy[0], VAdj, 1,
+      lastRow.Buffer(), lastRow.LDim() );
+}
+
+} // namespace svd
+
+template<typename F>
+inline int
+PartialSVD
+( const DistMatrix<F>& A,
+  DistMatrix<typename Base<F>::type,VR,STAR>& s,
+  DistMatrix<F>& U, DistMatrix<F>& V,
+  int k, typename Base<F>::type tol, int maxBasisSize )
+{
+#ifndef RELEASE
+    PushCallStack("PartialSVD");
+    if( A.Grid() != s.Grid() || A.Grid() != U.Grid() ||
+        A.Grid() != V.Grid() )
+        throw std::logic_error("{A,s,U,V} must share the same grid");
+    if( k < 0 || k > std::min(A.Height(),A.Width()) )
+        throw std::logic_error("Invalid number of singular triplets");
+    if( maxBasisSize < 0 )
+        throw std::logic_error("Invalid maximum basis size");
+#endif
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    const int m = A.Height();
+    const int n = A.Width();
+    const int minDim = std::min(m,n);
+    const R eps = lapack::MachineEpsilon<R>();
+    if( tol == R(0) )
+        tol = Sqrt(eps);
+    int maxDim = ( maxBasisSize == 0 ? minDim : maxBasisSize );
+    maxDim = std::max( std::min(maxDim,minDim), k );
+
+    if( k == 0 )
+    {
+        Zeros( 0, 1, s );
+        Zeros( m, 0, U );
+        Zeros( n, 0, V );
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return 0;
+    }
+
+    // Storage for the Lanczos vectors, U_j and V_{j+1}
+    const int initialWidth = std::min( 2*k+16, maxDim );
+    DistMatrix<F,VC,STAR> UBasis( g ), VBasis( g );
+    Zeros( m, initialWidth, UBasis );
+    Zeros( n, initialWidth+1, VBasis );
+    DistMatrix<F,VC,STAR> u( g ), v( g ), UPrev( g ), VPrev( g ),
+                          uj( g ), vj( g );
+    u.AlignWith( UBasis );
+    v.AlignWith( VBasis );
+
+    // Start from a random unit vector
+    View( vj, VBasis, 0, 0, n, 1 );
+    LockedView( VPrev, VBasis, 0, 0, n, 0 );
+    svd::RandomOrthogonalVector( VPrev, vj );
+
+    std::vector<R> d, e, sigma;
+    Matrix<F> lastRow;
+    R normEst = 0;
+    int j = 0;
+    while( true )
+    {
+        svd::GrowBasis( UBasis, j+1, maxDim );
+        svd::GrowBasis( VBasis, j+2, maxDim+1 );
+
+        // u := A v_j, orthogonalized against U_j (which implicitly subtracts 
+        // beta_{j-1} u_{j-1})
+        View( vj, VBasis, 0, j, n, 1 );
+        Zeros( m, 1, u );
+        Gemv( NORMAL, F(1), A, vj, F(0), u );
+        LockedView( UPrev, UBasis, 0, 0, m, j );
+        svd::Reorthogonalize( UPrev, u );
+        R alpha = Norm( u );
+        normEst = std::max( normEst, alpha );
+        View( uj, UBasis, 0, j, m, 1 );
+        if( alpha <= eps*normEst )
+        {
+            alpha = 0;
+            svd::RandomOrthogonalVector( UPrev, u );
+        }
+        else
+            Scale( R(1)/alpha, u );
+        uj = u;
+        d.push_back( alpha );
+
+        // v := A^H u_j, orthogonalized against V_{j+1} (which implicitly 
+        // subtracts alpha_j v_j)
+        Zeros( n, 1, v );
+        Gemv( ADJOINT, F(1), A, uj, F(0), v );
+        LockedView( VPrev, VBasis, 0, 0, n, j+1 );
+        svd::Reorthogonalize( VPrev, v );
+        R beta = Norm( v );
+        normEst = std::max( normEst, beta );
+        if( beta <= eps*normEst )
+        {
+            beta = 0;
+            if( j+1 < n )
+                svd::RandomOrthogonalVector( VPrev, v );
+            else
+                MakeZeros( v );
+        }
+        else
+            Scale( R(1)/beta, v );
+        View( vj, VBasis, 0, j+1, n, 1 );
+        vj = v;
+        e.push_back( beta );
+        ++j;
+
+        // Check the residuals of the k largest Ritz triplets
+        if( j >= k )
+        {
+            svd::BidiagLastRow( d, e, sigma, lastRow );
+            bool converged = true;
+            for( int i=0; i<k; ++i )
+                if( beta*Abs(lastRow.Get(0,i)) > tol*sigma[0] )
+                    converged = false;
+            if( converged || j == maxDim )
+                break;
+        }
+    }
+
+    // Form the full SVD of B_j = X S W^H and then U := U_j X, V := V_j W
+    Matrix<F> X, W, XL, WL;
+    std::vector<R> eCopy( std::max(j-1,1), 0 );
+    for( int i=0; i<j-1; ++i )
+        eCopy[i] = e[i];
+    sigma = d;
+    Identity( j, j, X );
+    Matrix<F> WAdj;
+    Identity( j, j, WAdj );
+    lapack::BidiagQRAlg
+    ( 'U', j, j, j, &sigma[0], &eCopy[0], WAdj.Buffer(), WAdj.LDim(),
+      X.Buffer(), X.LDim() );
+    Adjoint( WAdj, W );
+    LockedView( XL, X, 0, 0, j, k );
+    LockedView( WL, W, 0, 0, j, k );
+
+    LockedView( UPrev, UBasis, 0, 0, m, j );
+    LockedView( VPrev, VBasis, 0, 0, n, j );
+    DistMatrix<F,VC,STAR> U_VC_STAR( g ), V_VC_STAR( g );
+    U_VC_STAR.AlignWith( UPrev );
+    V_VC_STAR.AlignWith( VPrev );
+    Zeros( m, k, U_VC_STAR );
+    Zeros( n, k, V_VC_STAR );
+    Gemm
+    ( NORMAL, NORMAL,
+      F(1), UPrev.LockedLocalMatrix(), XL, F(0), U_VC_STAR.LocalMatrix() );
+    Gemm
+    ( NORMAL, NORMAL,
+      F(1), VPrev.LockedLocalMatrix(), WL, F(0), V_VC_STAR.LocalMatrix() );
+    U = U_VC_STAR;
+    V = V_VC_STAR;
+
+    DistMatrix<R,STAR,STAR> s_STAR_STAR( k, 1, g );
+    for( int i=0; i<k; ++i )
+        s_STAR_STAR.SetLocal( i, 0, sigma[i] );
+    s = s_STAR_STAR;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return j;
+}
+
+} // namespace elem
@@ -0,0 +1,83 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+template<typename F>
+inline void
+IdentityPreconditioner<F>::Apply( DistMatrix<F,VC,STAR>& Z ) const
+{ }
+
+template<typename F>
+inline
+CholeskyPreconditioner<F>::CholeskyPreconditioner
+( UpperOrLower uplo, const DistMatrix<F>& M )
+: uplo_(uplo), M_(&M)
+{
+#ifndef RELEASE
+    PushCallStack("CholeskyPreconditioner::CholeskyPreconditioner");
+    if( M.Height() != M.Width() )
+        throw std::logic_error("M must be square");
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+CholeskyPreconditioner<F>::Apply( DistMatrix<F,VC,STAR>& Z ) const
+{
+#ifndef RELEASE
+    PushCallStack("CholeskyPreconditioner::Apply");
+    if( Z.Height() != M_->Height() )
+        throw std::logic_error("Z is not conformal with M");
+#endif
+    DistMatrix<F> Z_MC_MR( M_->Grid() );
+    Z_MC_MR = Z;
+    SolveAfterCholesky( uplo_, NORMAL, *M_, Z_MC_MR );
+    Z = Z_MC_MR;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline
+LUPreconditioner<F>::LUPreconditioner
+( const DistMatrix<F>& M, const DistMatrix<int,VC,STAR>& p )
+: M_(&M), p_(&p)
+{
+#ifndef RELEASE
+    PushCallStack("LUPreconditioner::LUPreconditioner");
+    if( M.Height() != M.Width() )
+        throw std::logic_error("M must be square");
+    if( p.Height() != M.Height() )
+        throw std::logic_error("p must be the same height as M");
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+LUPreconditioner<F>::Apply( DistMatrix<F,VC,STAR>& Z ) const
+{
+#ifndef RELEASE
+    PushCallStack("LUPreconditioner::Apply");
+    if( Z.Height() != M_->Height() )
+        throw std::logic_error("Z is not conformal with M");
+#endif
+    DistMatrix<F> Z_MC_MR( M_->Grid() );
+    Z_MC_MR = Z;
+    SolveAfterLU( NORMAL, *M_, *p_, Z_MC_MR );
+    Z = Z_MC_MR;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
@@ -7,6 +7,8 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 
+#include "./QDWH/StructuredQR.hpp"
+
 namespace elem {
 
 //
@@ -21,202 +23,426 @@ namespace elem {
 // The careful calculation of the coefficients is due to a suggestion from
 // Gregorio Quintana Orti.
 //
+// Each QR-based iteration factors [sqrt(c) A; I] with a Householder QR which 
+// skips the zeros below the identity block (see StructuredQR.hpp), and the 
+// fact that the bottom block of the orthogonal factor is upper triangular 
+// allows for a Trmm rather than a Gemm. As soon as c <= 100, the iterate is 
+// well-conditioned enough for the cheaper Cholesky-based iteration.
+//
+// The overloads which do not require bounds on the singular values compute 
+// the QR factorization A = Q0 R0, bound || A ||_2 = || R0 ||_2 from above 
+// with TwoNormUpperBound, and estimate the smallest singular value with the 
+// one-norm condition estimator applied to triangular solves with R0, i.e.,
+//
+//     sigma_min(A) >= 1 / (sqrt(n) || inv(R0) ||_1).
+//
+// If A is sufficiently tall, then the iteration is run on the n x n matrix R0 
+// instead of A, since polar(A) = Q0 polar(R0).
+//
+
+namespace qdwh {
+
+// Compute the weights of the next iteration, 
+//
+//     A := A (a I + b A^H A) inv(I + c A^H A) 
+//        = (b/c) A + (a-b/c) A inv(I + c A^H A),
+//
+// returning c and overwriting alpha := a-b/c, beta := b/c, and lowerBound 
+// with a lower bound on the smallest singular value of the next iterate.
+template<typename R>
+inline R
+Weights( R& lowerBound, R& alpha, R& beta )
+{
+    const R oneThird = R(1)/R(3);
+    const R tol = 5*lapack::MachineEpsilon<R>();
+
+    R L2;
+    Complex<R> dd, sqd;
+    if( Abs(1-lowerBound) < tol )
+    {
+        L2 = 1;
+        dd = 0;
+        sqd = 1;
+    }
+    else
+    {
+        L2 = lowerBound*lowerBound;
+        dd = Pow( 4*(1-L2)/(L2*L2), oneThird );
+        sqd = Sqrt( 1+dd );
+    }
+    const Complex<R> arg = 8 - 4*dd + 8*(2-L2)/(L2*sqd);
+    const R a = (sqd + Sqrt( arg )/2).real;
+    const R b = (a-1)*(a-1)/4;
+    const R c = a+b-1;
+    alpha = a-b/c;
+    beta = b/c;
+    lowerBound = lowerBound*(a+b*L2)/(1+c*L2);
+    return c;
+}
 
 template<typename F>
-int QDWH
-( Matrix<F>& A, 
-  typename Base<F>::type lowerBound,
-  typename Base<F>::type upperBound )
+inline void
+Iterate
+( Matrix<F>& A, typename Base<F>::type lowerBound, QDWHInfo& info )
 {
-#ifndef RELEASE
-    PushCallStack("QDWH");
-#endif
     typedef typename Base<F>::type R;
     const int height = A.Height();
     const int width = A.Width();
-    const R oneHalf = R(1)/R(2);
     const R oneThird = R(1)/R(3);
-
-    if( height < width )
-        throw std::logic_error("Height cannot be less than width");
-
-    const R epsilon = lapack::MachineEpsilon<R>();
-    const R tol = 5*epsilon;
+    const R tol = 5*lapack::MachineEpsilon<R>();
     const R cubeRootTol = Pow(tol,oneThird);
 
-    // Form the first iterate
-    Scale( 1/upperBound, A );
-
-    int numIts=0;
+    Timer qrTimer, cholTimer;
     R frobNormADiff;
     Matrix<F> ALast;
-    Matrix<F> Q( height+width, width );
-    Matrix<F> QT, QB;
-    PartitionDown( Q, QT,
-                      QB, height );
+    Matrix<F> W, WT, WB, Q, QT, QB;
     Matrix<F> C;
     Matrix<F> ATemp;
     do
     {
-        ++numIts;
+        ++info.numIts;
         ALast = A;
 
-        R L2;
-        Complex<R> dd, sqd;
-        if( Abs(1-lowerBound) < tol )
-        {
-            L2 = 1;
-            dd = 0;
-            sqd = 1;
-        }
-        else
-        {
-            L2 = lowerBound*lowerBound;
-            dd = Pow( 4*(1-L2)/(L2*L2), oneThird );
-            sqd = Sqrt( 1+dd );
-        }
-        const Complex<R> arg = 8 - 4*dd + 8*(2-L2)/(L2*sqd);
-        const R a = (sqd + Sqrt( arg )/2).real;
-        const R b = (a-1)*(a-1)/4;
-        const R c = a+b-1;
-        const Complex<R> alpha = a-b/c;
-        const Complex<R> beta = b/c;
-
-        lowerBound = lowerBound*(a+b*L2)/(1+c*L2);
-
+        R alpha, beta;
+        const R c = Weights( lowerBound, alpha, beta );
         if( c > 100 )
         {
             //
             // The standard QR-based algorithm
             //
-            QT = A;
-            Scale( Sqrt(c), QT );
-            MakeIdentity( QB );
-            ExplicitQR( Q );
-            Gemm( NORMAL, ADJOINT, alpha/Sqrt(c), QT, QB, beta, A );
+            qrTimer.Start();
+            W.ResizeTo( height+width, width );
+            PartitionDown
+            ( W, WT,
+                 WB, height );
+            WT = A;
+            Scale( Sqrt(c), WT );
+            MakeIdentity( WB );
+            internal::StructuredExplicitQR( W, height, Q );
+            PartitionDown
+            ( Q, QT,
+                 QB, height );
+            Trmm( RIGHT, UPPER, ADJOINT, NON_UNIT, F(1), QB, QT );
+            Scale( F(beta), A );
+            Axpy( F(alpha/Sqrt(c)), QT, A );
+            qrTimer.Stop();
+            ++info.numQRIts;
         }
         else
         {
             //
             // Use faster Cholesky-based algorithm since A is well-conditioned
             //
+            cholTimer.Start();
             Identity( width, width, C );
             Herk( LOWER, ADJOINT, F(c), A, F(1), C );
             Cholesky( LOWER, C );
             ATemp = A;
             Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, ATemp );
             Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, ATemp );
-            Scale( beta, A );
-            Axpy( alpha, ATemp, A );
+            Scale( F(beta), A );
+            Axpy( F(alpha), ATemp, A );
+            cholTimer.Stop();
+            ++info.numCholIts;
         }
 
         Axpy( F(-1), A, ALast );
         frobNormADiff = Norm( ALast, FROBENIUS_NORM );
     }
     while( frobNormADiff > cubeRootTol || Abs(1-lowerBound) > tol );
-#ifndef RELEASE
-    PopCallStack();
-#endif
-    return numIts;
+    info.qrTime += qrTimer.Time();
+    info.cholTime += cholTimer.Time();
 }
 
 template<typename F>
-int QDWH
-( DistMatrix<F>& A, 
-  typename Base<F>::type lowerBound,
-  typename Base<F>::type upperBound )
+inline void
+Iterate
+( DistMatrix<F>& A, typename Base<F>::type lowerBound, QDWHInfo& info )
 {
-#ifndef RELEASE
-    PushCallStack("QDWH");
-#endif
     typedef typename Base<F>::type R;
     const Grid& g = A.Grid();
     const int height = A.Height();
     const int width = A.Width();
-    const R oneHalf = R(1)/R(2);
     const R oneThird = R(1)/R(3);
-
-    if( height < width )
-        throw std::logic_error("Height cannot be less than width");
-
-    const R epsilon = lapack::MachineEpsilon<R>();
-    const R tol = 5*epsilon;
+    const R tol = 5*lapack::MachineEpsilon<R>();
     const R cubeRootTol = Pow(tol,oneThird);
 
-    // Form the first iterate
-    Scale( 1/upperBound, A );
-
-    int numIts=0;
+    Timer qrTimer, cholTimer;
     R frobNormADiff;
     DistMatrix<F> ALast( g );
-    DistMatrix<F> Q( height+width, width, g );
-    DistMatrix<F> QT(g), QB(g);
-    PartitionDown( Q, QT,
-                      QB, height );
+    DistMatrix<F> W( g ), WT( g ), WB( g ), Q( g ), QT( g ), QB( g );
     DistMatrix<F> C( g );
     DistMatrix<F> ATemp( g );
     do
     {
-        ++numIts;
+        ++info.numIts;
         ALast = A;
 
-        R L2;
-        Complex<R> dd, sqd;
-        if( Abs(1-lowerBound) < tol )
-        {
-            L2 = 1;
-            dd = 0;
-            sqd = 1;
-        }
-        else
-        {
-            L2 = lowerBound*lowerBound;
-            dd = Pow( 4*(1-L2)/(L2*L2), oneThird );
-            sqd = Sqrt( 1+dd );
-        }
-        const Complex<R> arg = 8 - 4*dd + 8*(2-L2)/(L2*sqd);
-        const R a = (sqd + Sqrt( arg )/2).real;
-        const R b = (a-1)*(a-1)/4;
-        const R c = a+b-1;
-        const Complex<R> alpha = a-b/c;
-        const Complex<R> beta = b/c;
-
-        lowerBound = lowerBound*(a+b*L2)/(1+c*L2);
-
+        R alpha, beta;
+        const R c = Weights( lowerBound, alpha, beta );
         if( c > 100 )
         {
             //
             // The standard QR-based algorithm
             //
-            QT = A;
-            Scale( Sqrt(c), QT );
-            MakeIdentity( QB );
-            ExplicitQR( Q );
-            Gemm( NORMAL, ADJOINT, alpha/Sqrt(c), QT, QB, beta, A );
+            qrTimer.Start();
+            W.ResizeTo( height+width, width );
+            PartitionDown
+            ( W, WT,
+                 WB, height );
+            WT = A;
+            Scale( Sqrt(c), WT );
+            MakeIdentity( WB );
+            internal::StructuredExplicitQR( W, height, Q );
+            PartitionDown
+            ( Q, QT,
+                 QB, height );
+            Trmm( RIGHT, UPPER, ADJOINT, NON_UNIT, F(1), QB, QT );
+            Scale( F(beta), A );
+            Axpy( F(alpha/Sqrt(c)), QT, A );
+            qrTimer.Stop();
+            ++info.numQRIts;
         }
         else
         {
             //
             // Use faster Cholesky-based algorithm since A is well-conditioned
             //
+            cholTimer.Start();
             Identity( width, width, C );
             Herk( LOWER, ADJOINT, F(c), A, F(1), C );
             Cholesky( LOWER, C );
             ATemp = A;
             Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, ATemp );
             Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, ATemp );
-            Scale( beta, A );
-            Axpy( alpha, ATemp, A );
+            Scale( F(beta), A );
+            Axpy( F(alpha), ATemp, A );
+            cholTimer.Stop();
+            ++info.numCholIts;
         }
 
         Axpy( F(-1), A, ALast );
         frobNormADiff = Norm( ALast, FROBENIUS_NORM );
     }
     while( frobNormADiff > cubeRootTol || Abs(1-lowerBound) > tol );
+    info.qrTime += qrTimer.Time();
+    info.cholTime += cholTimer.Time();
+}
+
+// Overwrite x with inv(op(R)) x, where R is upper triangular
+template<typename F>
+class TriangularInverseSolver
+{
+public:
+    TriangularInverseSolver( const Matrix<F>& R ) : R_(R) { }
+
+    void operator()( Orientation orientation, Matrix<F>& x ) const
+    { Trsv( UPPER, orientation, NON_UNIT, R_, x ); }
+
+private:
+    const Matrix<F>& R_;
+};
+
+template<typename F>
+class DistTriangularInverseSolver
+{
+public:
+    DistTriangularInverseSolver( const DistMatrix<F>& R )
+    : R_(R), xDist_(R.Grid()) { }
+
+    void operator()( Orientation orientation, Matrix<F>& x )
+    {
+        internal::ReplicatedToDist( x, xDist_ );
+        Trsv( UPPER, orientation, NON_UNIT, R_, xDist_ );
+        internal::DistToReplicated( xDist_, x );
+    }
+
+private:
+    const DistMatrix<F>& R_;
+    DistMatrix<F> xDist_;
+};
+
+// Given the upper bound || R ||_2 <= upperBound, return an estimate of a lower
+// bound on the smallest singular value of R / upperBound
+template<typename F,class Solver>
+inline typename Base<F>::type
+LowerBound( Solver& solve, int n, typename Base<F>::type upperBound )
+{
+    typedef typename Base<F>::type R;
+    const R eps = lapack::MachineEpsilon<R>();
+    const R invOneNorm = internal::InverseOneNormEstimate<F>( solve, n );
+    const R lowerBound = 1/(upperBound*Sqrt(R(n))*invOneNorm);
+    // A singular R yields either infinite or NaN estimates
+    if( !(lowerBound > eps) )
+        return eps;
+    else
+        return std::min( lowerBound, R(1) );
+}
+
+inline QDWHInfo
+NewInfo()
+{
+    QDWHInfo info;
+    info.numIts = info.numQRIts = info.numCholIts = 0;
+    info.estimateTime = info.qrTime = info.cholTime = info.totalTime = 0;
+    return info;
+}
+
+} // namespace qdwh
+
+template<typename F>
+inline int 
+QDWH
+( Matrix<F>& A, 
+  typename Base<F>::type lowerBound,
+  typename Base<F>::type upperBound )
+{
+#ifndef RELEASE
+    PushCallStack("QDWH");
+#endif
+    if( A.Height() < A.Width() )
+        throw std::logic_error("Height cannot be less than width");
+
+    // Form the first iterate
+    Scale( F(1/upperBound), A );
+
+    QDWHInfo info = qdwh::NewInfo();
+    qdwh::Iterate( A, lowerBound, info );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return info.numIts;
+}
+
+template<typename F>
+inline int 
+QDWH
+( DistMatrix<F>& A, 
+  typename Base<F>::type lowerBound,
+  typename Base<F>::type upperBound )
+{
+#ifndef RELEASE
+    PushCallStack("QDWH");
+#endif
+    if( A.Height() < A.Width() )
+        throw std::logic_error("Height cannot be less than width");
+
+    // Form the first iterate
+    Scale( F(1/upperBound), A );
+
+    QDWHInfo info = qdwh::NewInfo();
+    qdwh::Iterate( A, lowerBound, info );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return info.numIts;
+}
+
+template<typename F>
+inline QDWHInfo
+QDWH( Matrix<F>& A )
+{
+#ifndef RELEASE
+    PushCallStack("QDWH");
+#endif
+    typedef typename Base<F>::type R;
+    const int height = A.Height();
+    const int width = A.Width();
+    if( height < width )
+        throw std::logic_error("Height cannot be less than width");
+
+    QDWHInfo info = qdwh::NewInfo();
+    Timer totalTimer, estimateTimer;
+    totalTimer.Start();
+    estimateTimer.Start();
+
+    // A = Q0 R0
+    const bool reduce = ( 5*height > 6*width );
+    Matrix<F> Q0, R0;
+    Q0 = A;
+    ExplicitQR( Q0, R0 );
+    const R upperBound = TwoNormUpperBound( R0 );
+    if( upperBound == R(0) )
+        throw std::logic_error("The polar factor of zero is not unique");
+    qdwh::TriangularInverseSolver<F> solve( R0 );
+    const R lowerBound = qdwh::LowerBound<F>( solve, width, upperBound );
+    estimateTimer.Stop();
+
+    if( reduce )
+    {
+        Scale( F(1/upperBound), R0 );
+        qdwh::Iterate( R0, lowerBound, info );
+        Gemm( NORMAL, NORMAL, F(1), Q0, R0, F(0), A );
+    }
+    else
+    {
+        Q0.Empty();
+        R0.Empty();
+        Scale( F(1/upperBound), A );
+        qdwh::Iterate( A, lowerBound, info );
+    }
+
+    totalTimer.Stop();
+    info.estimateTime = estimateTimer.Time();
+    info.totalTime = totalTimer.Time();
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return info;
+}
+
+template<typename F>
+inline QDWHInfo
+QDWH( DistMatrix<F>& A )
+{
+#ifndef RELEASE
+    PushCallStack("QDWH");
+#endif
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    const int height = A.Height();
+    const int width = A.Width();
+    if( height < width )
+        throw std::logic_error("Height cannot be less than width");
+
+    QDWHInfo info = qdwh::NewInfo();
+    Timer totalTimer, estimateTimer;
+    totalTimer.Start();
+    estimateTimer.Start();
+
+    // A = Q0 R0
+    const bool reduce = ( 5*height > 6*width );
+    DistMatrix<F> Q0( g ), R0( g );
+    Q0 = A;
+    ExplicitQR( Q0, R0 );
+    const R upperBound = TwoNormUpperBound( R0 );
+    if( upperBound == R(0) )
+        throw std::logic_error("The polar factor of zero is not unique");
+    qdwh::DistTriangularInverseSolver<F> solve( R0 );
+    const R lowerBound = qdwh::LowerBound<F>( solve, width, upperBound );
+    estimateTimer.Stop();
+
+    if( reduce )
+    {
+        Scale( F(1/upperBound), R0 );
+        qdwh::Iterate( R0, lowerBound, info );
+        Gemm( NORMAL, NORMAL, F(1), Q0, R0, F(0), A );
+    }
+    else
+    {
+        Q0.Empty();
+        R0.Empty();
+        Scale( F(1/upperBound), A );
+        qdwh::Iterate( A, lowerBound, info );
+    }
+
+    totalTimer.Stop();
+    info.estimateTime = estimateTimer.Time();
+    info.totalTime = totalTimer.Time();
 #ifndef RELEASE
     PopCallStack();
 #endif
-    return numIts;
+    return info;
 }
 
 } // namespace elem
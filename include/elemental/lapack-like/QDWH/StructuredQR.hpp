@@ -0,0 +1,193 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace internal {
+
+//
+// Given the (m+n) x n matrix W = [X; I], where I is the n x n identity,
+// overwrite W with its packed Householder QR factorization and Q with the
+// explicit (m+n) x n orthonormal factor.
+//
+// Since the j'th column of W is zero below row m+j, so is the j'th Householder
+// vector, and a panel of nb columns beginning at column j only touches the
+// m+nb rows beginning at row j. Exploiting this structure roughly halves the
+// cost of both the factorization and the formation of Q relative to
+// ExplicitQR when X is square. Furthermore, since I = Q2 R, where Q2 is the
+// bottom n x n block of Q, Q2 = inv(R) is upper triangular.
+//
+
+template<typename R>
+inline void
+StructuredExplicitQR( Matrix<R>& W, int m, Matrix<R>& Q )
+{
+#ifndef RELEASE
+    PushCallStack("internal::StructuredExplicitQR");
+    if( W.Height() != m+W.Width() )
+        throw std::logic_error("W must be (m+n) x n");
+#endif
+    const int n = W.Width();
+    const int bsize = Blocksize();
+    Matrix<R> WPan, WRight, QPan;
+    for( int j=0; j<n; j+=bsize )
+    {
+        const int nb = std::min(bsize,n-j);
+        View( WPan, W, j, j, m+nb, nb );
+        View( WRight, W, j, j+nb, m+nb, n-j-nb );
+        PanelQR( WPan );
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, FORWARD, 0, WPan, WRight );
+    }
+
+    Identity( m+n, n, Q );
+    for( int j=((n-1)/bsize)*bsize; j>=0; j-=bsize )
+    {
+        const int nb = std::min(bsize,n-j);
+        LockedView( WPan, W, j, j, m+nb, nb );
+        View( QPan, Q, j, j, m+nb, n-j );
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, BACKWARD, 0, WPan, QPan );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename R>
+inline void
+StructuredExplicitQR
+( Matrix<Complex<R> >& W, int m, Matrix<Complex<R> >& Q )
+{
+#ifndef RELEASE
+    PushCallStack("internal::StructuredExplicitQR");
+    if( W.Height() != m+W.Width() )
+        throw std::logic_error("W must be (m+n) x n");
+#endif
+    typedef Complex<R> C;
+    const int n = W.Width();
+    const int bsize = Blocksize();
+    Matrix<C> WPan, WRight, QPan, t, t1;
+    t.ResizeTo( n, 1 );
+    for( int j=0; j<n; j+=bsize )
+    {
+        const int nb = std::min(bsize,n-j);
+        View( WPan, W, j, j, m+nb, nb );
+        View( WRight, W, j, j+nb, m+nb, n-j-nb );
+        View( t1, t, j, 0, nb, 1 );
+        PanelQR( WPan, t1 );
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, FORWARD, CONJUGATED,
+          0, WPan, t1, WRight );
+    }
+
+    Identity( m+n, n, Q );
+    for( int j=((n-1)/bsize)*bsize; j>=0; j-=bsize )
+    {
+        const int nb = std::min(bsize,n-j);
+        LockedView( WPan, W, j, j, m+nb, nb );
+        View( QPan, Q, j, j, m+nb, n-j );
+        LockedView( t1, t, j, 0, nb, 1 );
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED,
+          0, WPan, t1, QPan );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename R>
+inline void
+StructuredExplicitQR( DistMatrix<R>& W, int m, DistMatrix<R>& Q )
+{
+#ifndef RELEASE
+    PushCallStack("internal::StructuredExplicitQR");
+    if( W.Grid() != Q.Grid() )
+        throw std::logic_error("{W,Q} must be distributed over the same grid");
+    if( W.Height() != m+W.Width() )
+        throw std::logic_error("W must be (m+n) x n");
+#endif
+    const Grid& g = W.Grid();
+    const int n = W.Width();
+    const int bsize = Blocksize();
+    DistMatrix<R> WPan( g ), WRight( g ), QPan( g );
+    for( int j=0; j<n; j+=bsize )
+    {
+        const int nb = std::min(bsize,n-j);
+        View( WPan, W, j, j, m+nb, nb );
+        View( WRight, W, j, j+nb, m+nb, n-j-nb );
+        PanelQR( WPan );
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, FORWARD, 0, WPan, WRight );
+    }
+
+    Identity( m+n, n, Q );
+    for( int j=((n-1)/bsize)*bsize; j>=0; j-=bsize )
+    {
+        const int nb = std::min(bsize,n-j);
+        LockedView( WPan, W, j, j, m+nb, nb );
+        View( QPan, Q, j, j, m+nb, n-j );
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, BACKWARD, 0, WPan, QPan );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename R>
+inline void
+StructuredExplicitQR
+( DistMatrix<Complex<R> >& W, int m, DistMatrix<Complex<R> >& Q )
+{
+#ifndef RELEASE
+    PushCallStack("internal::StructuredExplicitQR");
+    if( W.Grid() != Q.Grid() )
+        throw std::logic_error("{W,Q} must be distributed over the same grid");
+    if( W.Height() != m+W.Width() )
+        throw std::logic_error("W must be (m+n) x n");
+#endif
+    typedef Complex<R> C;
+    const Grid& g = W.Grid();
+    const int n = W.Width();
+    const int bsize = Blocksize();
+    DistMatrix<C> WPan( g ), WRight( g ), QPan( g );
+    DistMatrix<C,MD,STAR> t( g ), t1( g );
+    t.AlignWithDiagonal( W );
+    t.ResizeTo( n, 1 );
+    for( int j=0; j<n; j+=bsize )
+    {
+        const int nb = std::min(bsize,n-j);
+        View( WPan, W, j, j, m+nb, nb );
+        View( WRight, W, j, j+nb, m+nb, n-j-nb );
+        View( t1, t, j, 0, nb, 1 );
+        PanelQR( WPan, t1 );
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, FORWARD, CONJUGATED,
+          0, WPan, t1, WRight );
+    }
+
+    Identity( m+n, n, Q );
+    for( int j=((n-1)/bsize)*bsize; j>=0; j-=bsize )
+    {
+        const int nb = std::min(bsize,n-j);
+        LockedView( WPan, W, j, j, m+nb, nb );
+        View( QPan, Q, j, j, m+nb, n-j );
+        LockedView( t1, t, j, 0, nb, 1 );
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED,
+          0, WPan, t1, QPan );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace internal
+} // namespace elem
@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 
+#include "./QR/TSQRPanel.hpp"
 #include "./QR/Panel.hpp"
 
 namespace elem {
@@ -73,6 +73,15 @@ PanelQR( DistMatrix<Real>& A )
 #ifndef RELEASE
     PushCallStack("internal::PanelQR");
 #endif
+    if( GetQRPanelApproach() == QR_PANEL_TSQR && A.Height() >= A.Width() )
+    {
+        TSQRPanelQR( A );
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
     const Grid& g = A.Grid();
 
     // Matrix views
@@ -250,6 +259,15 @@ PanelQR
     if( !t.AlignedWithDiagonal( A, 0 ) )
         throw std::logic_error("t must be aligned with A's main diagonal");
 #endif
+    if( GetQRPanelApproach() == QR_PANEL_TSQR && A.Height() >= A.Width() )
+    {
+        TSQRPanelQR( A, t );
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
     typedef Complex<R> C;
     const Grid& g = A.Grid();
 
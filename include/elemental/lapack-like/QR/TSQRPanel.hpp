@@ -0,0 +1,144 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace internal {
+
+// A panel factorization in the spirit of communication-avoiding QR (CAQR):
+// the panel is factored with TSQR, and Householder transforms equivalent to
+// those of the usual panel factorization are then reconstructed from the
+// explicit Q (Ballard et al., "Reconstructing Householder vectors from
+// tall-skinny QR"), so that the trailing matrix may still be updated with
+// ApplyPackedReflectors.
+//
+// Since Q has orthonormal columns, the unpivoted LU factorization
+//
+//   Q - [S; 0] = Y U,
+//
+// where each entry of the diagonal sign matrix S is chosen opposite to the
+// corresponding (updated) diagonal entry of Q so that the pivots are at least
+// one in magnitude, yields the unit lower-trapezoidal Householder vectors Y
+// such that Q = (I - Y T Y^H) [S; 0], with diag(T) = -diag(U) conj(S). The
+// upper triangle of the panel is then overwritten with S R.
+
+// Overwrite the top n x n block of Q with Y1 \ U and return the signs
+template<typename F>
+inline void
+ReconstructHouseholder( Matrix<F>& Q1, std::vector<F>& signs )
+{
+#ifndef RELEASE
+    PushCallStack("internal::ReconstructHouseholder");
+#endif
+    typedef typename Base<F>::type R;
+    const int n = Q1.Height();
+    F* Q1Buffer = Q1.Buffer();
+    const int ldim = Q1.LDim();
+
+    signs.resize( n );
+    for( int j=0; j<n; ++j )
+    {
+        const F alpha = Q1Buffer[j+j*ldim];
+        const R alphaAbs = Abs(alpha);
+        const F sign = ( alphaAbs == R(0) ? F(-1) : -alpha/alphaAbs );
+        signs[j] = sign;
+
+        const F pivot = alpha - sign;
+        Q1Buffer[j+j*ldim] = pivot;
+        const F pivotInv = F(1) / pivot;
+        for( int i=j+1; i<n; ++i )
+            Q1Buffer[i+j*ldim] *= pivotInv;
+        for( int k=j+1; k<n; ++k )
+        {
+            const F gamma = Q1Buffer[j+k*ldim];
+            for( int i=j+1; i<n; ++i )
+                Q1Buffer[i+k*ldim] -= Q1Buffer[i+j*ldim]*gamma;
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+TSQRPanelHelper( DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& t )
+{
+#ifndef RELEASE
+    PushCallStack("internal::TSQRPanelHelper");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Width();
+
+    DistMatrix<F,VC,STAR> A_VC_STAR(g), AT_VC_STAR(g), AB_VC_STAR(g);
+    DistMatrix<F,STAR,STAR> AT_STAR_STAR(g), R_STAR_STAR(g);
+    TSQRTree<F> tree;
+
+    A_VC_STAR = A;
+    TSQR( A_VC_STAR, R_STAR_STAR, tree );
+    ExpandTSQR( A_VC_STAR, tree );
+
+    // Reconstruct the Householder transforms from the explicit Q
+    PartitionDown
+    ( A_VC_STAR, AT_VC_STAR,
+                 AB_VC_STAR, n );
+    AT_STAR_STAR = AT_VC_STAR;
+    std::vector<F> signs;
+    ReconstructHouseholder( AT_STAR_STAR.LocalMatrix(), signs );
+    internal::LocalTrsm
+    ( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), AT_STAR_STAR, AB_VC_STAR );
+
+    // Form the Householder scalars and overwrite U with S R
+    t.ResizeTo( n, 1 );
+    for( int j=0; j<n; ++j )
+    {
+        t.SetLocal( j, 0, -AT_STAR_STAR.GetLocal(j,j)*Conj(signs[j]) );
+        for( int k=j; k<n; ++k )
+            AT_STAR_STAR.SetLocal
+            ( j, k, signs[j]*R_STAR_STAR.GetLocal(j,k) );
+    }
+    AT_VC_STAR = AT_STAR_STAR;
+    A = A_VC_STAR;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename Real>
+inline void
+TSQRPanelQR( DistMatrix<Real>& A )
+{
+#ifndef RELEASE
+    PushCallStack("internal::TSQRPanelQR");
+#endif
+    DistMatrix<Real,STAR,STAR> t( A.Grid() );
+    TSQRPanelHelper( A, t );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename Real>
+inline void
+TSQRPanelQR
+( DistMatrix<Complex<Real> >& A,
+  DistMatrix<Complex<Real>,MD,STAR>& t )
+{
+#ifndef RELEASE
+    PushCallStack("internal::TSQRPanelQR");
+#endif
+    DistMatrix<Complex<Real>,STAR,STAR> t_STAR_STAR( A.Grid() );
+    TSQRPanelHelper( A, t_STAR_STAR );
+    t = t_STAR_STAR;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace internal
+} // namespace elem
@@ -0,0 +1,136 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+// Approximate the k largest singular triplets of the m x n matrix A using the
+// randomized range finder of Halko, Martinsson, and Tropp:
+//
+//   1) Form Y := A Omega, where Omega is an n x l Gaussian matrix, with
+//      l = k + oversample, and orthonormalize it, Q := orth(Y),
+//   2) Perform 'powerIters' subspace iterations, Q := orth(A orth(A^H Q)),
+//      which sharpen the decay of the spectrum of the sketch,
+//   3) Factor A^H Q = Q2 R2, so that A ~= Q Q^H A = Q R2^H Q2^H, and compute
+//      the SVD of the small l x l matrix R2^H = W S X^H redundantly, which
+//      yields A ~= (Q W) S (Q2 X)^H.
+//
+// Each orthonormalization is a TSQR of an [VC,* ] tall-skinny matrix, and so
+// the cost is O(mnl) flops for each product with A and O((m+n) l^2) flops
+// for the orthogonalizations, rather than the O(mn min(m,n)) flops of a full
+// SVD.
+
+namespace svd {
+
+template<typename F>
+inline void
+Orthonormalize( DistMatrix<F,VC,STAR>& Y )
+{
+    DistMatrix<F,STAR,STAR> R( Y.Grid() );
+    ExplicitTSQR( Y, R );
+}
+
+// Y := orth( orientation(A) Q )
+template<typename F>
+inline void
+ApplyAndOrthonormalize
+( Orientation orientation, const DistMatrix<F>& A,
+  const DistMatrix<F,VC,STAR>& Q, DistMatrix<F,VC,STAR>& Y )
+{
+    const Grid& g = A.Grid();
+    const int height = ( orientation==NORMAL ? A.Height() : A.Width() );
+    DistMatrix<F> Q_MC_MR( Q ), Y_MC_MR( g );
+    Zeros( height, Q.Width(), Y_MC_MR );
+    Gemm( orientation, NORMAL, F(1), A, Q_MC_MR, F(0), Y_MC_MR );
+    Y = Y_MC_MR;
+    Orthonormalize( Y );
+}
+
+} // namespace svd
+
+template<typename F>
+inline void
+RandomizedSVD
+( const DistMatrix<F>& A,
+  DistMatrix<typename Base<F>::type,VR,STAR>& s,
+  DistMatrix<F>& U, DistMatrix<F>& V,
+  int k, int oversample, int powerIters )
+{
+#ifndef RELEASE
+    PushCallStack("RandomizedSVD");
+    if( A.Grid() != s.Grid() || A.Grid() != U.Grid() ||
+        A.Grid() != V.Grid() )
+        throw std::logic_error("{A,s,U,V} must share the same grid");
+    if( k < 0 || k > std::min(A.Height(),A.Width()) )
+        throw std::logic_error("Invalid number of singular triplets");
+    if( oversample < 0 || powerIters < 0 )
+        throw std::logic_error("Invalid oversampling or number of iterations");
+#endif
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    const int m = A.Height();
+    const int n = A.Width();
+    const int l = std::min( k+oversample, std::min(m,n) );
+
+    // Q := orth( A Omega )
+    DistMatrix<F> Omega( g );
+    Gaussian( n, l, Omega );
+    DistMatrix<F,VC,STAR> Q( Omega ), Q2( g );
+    Omega.Empty();
+    svd::ApplyAndOrthonormalize( NORMAL, A, Q, Q );
+
+    // Q := orth( A orth( A^H Q ) )
+    for( int it=0; it<powerIters; ++it )
+    {
+        svd::ApplyAndOrthonormalize( ADJOINT, A, Q, Q2 );
+        svd::ApplyAndOrthonormalize( NORMAL, A, Q2, Q );
+    }
+
+    // A^H Q = Q2 R2
+    {
+        DistMatrix<F> Q_MC_MR( Q ), Z( g );
+        Zeros( n, l, Z );
+        Gemm( ADJOINT, NORMAL, F(1), A, Q_MC_MR, F(0), Z );
+        Q2 = Z;
+    }
+    DistMatrix<F,STAR,STAR> R2( g );
+    ExplicitTSQR( Q2, R2 );
+
+    // R2 = X S W^H, so that A ~= Q R2^H Q2^H = (Q W) S (Q2 X)^H. Every process
+    // redundantly computes the SVD of R2.
+    Matrix<F> W, X, WL, XL;
+    Matrix<R> sSmall;
+    X = R2.LockedLocalMatrix();
+    SVD( X, sSmall, W );
+    LockedView( WL, W, 0, 0, l, k );
+    LockedView( XL, X, 0, 0, l, k );
+
+    DistMatrix<F,VC,STAR> U_VC_STAR( g ), V_VC_STAR( g );
+    U_VC_STAR.AlignWith( Q );
+    V_VC_STAR.AlignWith( Q2 );
+    Zeros( m, k, U_VC_STAR );
+    Zeros( n, k, V_VC_STAR );
+    Gemm
+    ( NORMAL, NORMAL, 
+      F(1), Q.LockedLocalMatrix(), WL, F(0), U_VC_STAR.LocalMatrix() );
+    Gemm
+    ( NORMAL, NORMAL, 
+      F(1), Q2.LockedLocalMatrix(), XL, F(0), V_VC_STAR.LocalMatrix() );
+    U = U_VC_STAR;
+    V = V_VC_STAR;
+
+    DistMatrix<R,STAR,STAR> s_STAR_STAR( k, 1, g );
+    for( int i=0; i<k; ++i )
+        s_STAR_STAR.SetLocal( i, 0, sSmall.Get(i,0) );
+    s = s_STAR_STAR;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
@@ -11,6 +11,148 @@ namespace elem {
 
 namespace svd {
 
+// Attempt to compute the SVD of the k x k upper bidiagonal matrix with 
+// diagonal d and superdiagonal e, B = U diag(s) V^T, with the singular 
+// vectors distributed over the entire grid. Returns false if no distributed 
+// algorithm is available, in which case the replicated QR algorithm is used.
+template<typename Real>
+inline bool
+DistBidiagSVD
+( int k, const Real* d, const Real* e, 
+  DistMatrix<Real,VR,STAR>& s, DistMatrix<Real>& U, DistMatrix<Real>& V )
+{ return false; }
+
+#ifndef WITHOUT_PMRRR
+// The eigenvalues of the 2k x 2k Golub-Kahan tridiagonal matrix, which has a 
+// zero diagonal and off-diagonal (d_0,e_0,d_1,e_1,...,d_{k-1}), are the 
+// +-s_j, and the eigenvector corresponding to -s_j is 
+// (v_0,-u_0,v_1,-u_1,...)/sqrt(2). We thus compute the k smallest eigenpairs 
+// with PMRRR, which leaves each process with entire eigenvectors, and then 
+// deinterleave and redistribute the singular vectors.
+//
+// Since the above relationship breaks down for (numerically) zero singular 
+// values, we give up in that case.
+inline bool
+DistBidiagSVD
+( int k, const double* d, const double* e, 
+  DistMatrix<double,VR,STAR>& s, DistMatrix<double>& U, DistMatrix<double>& V )
+{
+#ifndef RELEASE
+    PushCallStack("svd::DistBidiagSVD");
+#endif
+    typedef double R;
+    const Grid& g = U.Grid();
+    if( k == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return false;
+    }
+
+    // Form the Golub-Kahan tridiagonal matrix (PMRRR overwrites it and 
+    // expects the off-diagonal to be of length 2k)
+    std::vector<R> tgkDiag( 2*k, 0 ), tgkOffDiag( 2*k, 0 );
+    R gershgorinBound = 0;
+    for( int j=0; j<k; ++j )
+    {
+        tgkOffDiag[2*j] = d[j];
+        if( j < k-1 )
+            tgkOffDiag[2*j+1] = e[j];
+        gershgorinBound = 
+            std::max( gershgorinBound, Abs(tgkOffDiag[2*j]) );
+        gershgorinBound = 
+            std::max( gershgorinBound, Abs(tgkOffDiag[2*j+1]) );
+    }
+
+    DistMatrix<R,STAR,VR> Z_STAR_VR( 2*k, k, g );
+    std::vector<R> wVector( 2*k );
+    pmrrr::Eig
+    ( 2*k, &tgkDiag[0], &tgkOffDiag[0], &wVector[0], 
+      Z_STAR_VR.LocalBuffer(), Z_STAR_VR.LocalLDim(), g.VRComm(), 0, k-1 );
+
+    // Ensure that the smallest singular value is safely nonzero
+    const int localWidth = Z_STAR_VR.LocalWidth();
+    R localMaxSigma = 0, localMinSigma = 2*gershgorinBound;
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        const R sigma = -wVector[jLocal];
+        localMaxSigma = std::max( localMaxSigma, sigma );
+        localMinSigma = std::min( localMinSigma, sigma );
+    }
+    R maxSigma, minSigma;
+    mpi::AllReduce( &localMaxSigma, &maxSigma, 1, mpi::MAX, g.VRComm() );
+    mpi::AllReduce( &localMinSigma, &minSigma, 1, mpi::MIN, g.VRComm() );
+    const R eps = lapack::MachineEpsilon<R>();
+    if( minSigma <= k*eps*maxSigma )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return false;
+    }
+
+    // Deinterleave each eigenvector into the corresponding column of 
+    // [U; V], renormalizing each half to counteract rounding errors
+    DistMatrix<R,VR,STAR> w( k, 1, g );
+    DistMatrix<R,STAR,VR> Y_STAR_VR( 2*k, k, g );
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        w.SetLocal( jLocal, 0, wVector[jLocal] );
+        R uNorm = 0, vNorm = 0;
+        for( int i=0; i<k; ++i )
+        {
+            const R nu = -Z_STAR_VR.GetLocal( 2*i+1, jLocal );
+            const R upsilon = Z_STAR_VR.GetLocal( 2*i, jLocal );
+            Y_STAR_VR.SetLocal( i,   jLocal, nu );
+            Y_STAR_VR.SetLocal( i+k, jLocal, upsilon );
+            uNorm += nu*nu;
+            vNorm += upsilon*upsilon;
+        }
+        uNorm = Sqrt( uNorm );
+        vNorm = Sqrt( vNorm );
+        for( int i=0; i<k; ++i )
+        {
+            Y_STAR_VR.SetLocal( i, jLocal, Y_STAR_VR.GetLocal(i,jLocal)/uNorm );
+            Y_STAR_VR.SetLocal
+            ( i+k, jLocal, Y_STAR_VR.GetLocal(i+k,jLocal)/vNorm );
+        }
+    }
+
+    // PMRRR assigns each process a contiguous set of eigenpairs, so we must 
+    // sort after redistributing (the eigenvalues are -s_j, so increasing 
+    // order corresponds to decreasing singular values)
+    DistMatrix<R> Y( g );
+    Y = Y_STAR_VR;
+    SortEig( w, Y );
+    Scale( R(-1), w );
+    s = w;
+    DistMatrix<R> YT(g), 
+                  YB(g);
+    PartitionDown( Y, YT,
+                      YB, k );
+    U = YT;
+    V = YB;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return true;
+}
+#endif // WITHOUT_PMRRR
+
+// Copy the real matrix A into the complex matrix B, which must be of the 
+// same size and have the same alignments
+template<typename Real>
+inline void
+CopyRealToComplex( const DistMatrix<Real>& A, DistMatrix<Complex<Real> >& B )
+{
+    const int localHeight = A.LocalHeight();
+    const int localWidth = A.LocalWidth();
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+            B.SetLocal( iLocal, jLocal, A.GetLocal(iLocal,jLocal) );
+}
+
 template<typename Real>
 inline void
 SimpleSVDUpper
@@ -47,6 +189,35 @@ SimpleSVDUpper
     View( e_STAR_STAR, eHat_STAR_STAR, 0, 0, k-1, 1 );
     e_STAR_STAR = e_MD_STAR;
 
+    // Try to compute the SVD of the (upper) bidiagonal matrix with the 
+    // singular vectors distributed over the entire grid
+    if( m >= n )
+    {
+        DistMatrix<Real> UHat( g ), VHat( g );
+        UHat.AlignWith( A );
+        VHat.AlignWith( V );
+        if( DistBidiagSVD
+            ( k, d_STAR_STAR.LockedLocalBuffer(), 
+              e_STAR_STAR.LockedLocalBuffer(), s, UHat, VHat ) )
+        {
+            DistMatrix<Real> B( A );
+            DistMatrix<Real> AT( g ),
+                             AB( g );
+            PartitionDown( A, AT,
+                              AB, n );
+            AT = UHat;
+            MakeZeros( AB );
+            V = VHat;
+            ApplyPackedReflectors( LEFT, LOWER, VERTICAL, BACKWARD, 0, B, A );
+            ApplyPackedReflectors
+            ( LEFT, UPPER, HORIZONTAL, BACKWARD, 1, B, V );
+#ifndef RELEASE
+            PopCallStack();
+#endif
+            return;
+        }
+    }
+
     // Initialize U and VTrans to the appropriate identity matrices.
     DistMatrix<Real,VC,STAR> U_VC_STAR( g );
     DistMatrix<Real,STAR,VC> VTrans_STAR_VC( g );
@@ -148,6 +319,37 @@ SimpleSVDUpper
     View( e_STAR_STAR, eHat_STAR_STAR, 0, 0, k-1, 1 );
     e_STAR_STAR = e_MD_STAR;
 
+    // Try to compute the SVD of the (upper) bidiagonal matrix with the 
+    // singular vectors distributed over the entire grid
+    if( m >= n )
+    {
+        DistMatrix<Real> UHat( g ), VHat( g );
+        UHat.AlignWith( A );
+        VHat.AlignWith( V );
+        if( DistBidiagSVD
+            ( k, d_STAR_STAR.LockedLocalBuffer(), 
+              e_STAR_STAR.LockedLocalBuffer(), s, UHat, VHat ) )
+        {
+            DistMatrix<C> B( A );
+            DistMatrix<C> AT( g ),
+                          AB( g );
+            PartitionDown( A, AT,
+                              AB, n );
+            MakeZeros( AB );
+            CopyRealToComplex( UHat, AT );
+            V.ResizeTo( n, n );
+            CopyRealToComplex( VHat, V );
+            ApplyPackedReflectors
+            ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED, 0, B, tQ, A );
+            ApplyPackedReflectors
+            ( LEFT, UPPER, HORIZONTAL, BACKWARD, UNCONJUGATED, 1, B, tP, V );
+#ifndef RELEASE
+            PopCallStack();
+#endif
+            return;
+        }
+    }
+
     // Initialize U and VAdj to the appropriate identity matrices
     DistMatrix<C,VC,STAR> U_VC_STAR( g );
     DistMatrix<C,STAR,VC> VAdj_STAR_VC( g );
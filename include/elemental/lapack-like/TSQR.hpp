@@ -0,0 +1,253 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+namespace internal {
+
+// The reduction tree pairs rank q with rank q+stride whenever q is a multiple
+// of 2*stride, so that the triangular factors are combined in log2(p) levels
+// and rank 0 holds the final factor. 'strides' lists the levels at which this
+// process combined its factor with that of a partner, and 'parentStride' is
+// the level at which it sent its factor away (zero for the root).
+inline void
+TSQRSchedule
+( int rank, int p, std::vector<int>& strides, int& parentStride )
+{
+    strides.clear();
+    parentStride = 0;
+    for( int stride=1; stride<p; stride*=2 )
+    {
+        if( rank % (2*stride) != 0 )
+        {
+            parentStride = stride;
+            return;
+        }
+        if( rank+stride < p )
+            strides.push_back( stride );
+    }
+}
+
+// The height of the triangular factor produced by the subtree of ranks
+// [firstRank,firstRank+stride)
+template<typename F>
+inline int
+TSQRSubtreeHeight
+( const DistMatrix<F,VC,STAR>& A, int firstRank, int stride )
+{
+    const int p = A.Grid().Size();
+    const int lastRank = std::min(firstRank+stride,p);
+    int height = 0;
+    for( int rank=firstRank; rank<lastRank; ++rank )
+        height += LocalLength( A.Height(), rank, A.ColAlignment(), p );
+    return std::min(height,A.Width());
+}
+
+// Copy the upper trapezoid of the top min(m,n) rows of A into a contiguous R
+template<typename F>
+inline void
+TSQRTriangle( const Matrix<F>& A, Matrix<F>& R )
+{
+    Matrix<F> AT;
+    LockedView( AT, A, 0, 0, std::min(A.Height(),A.Width()), A.Width() );
+    R.Empty();
+    R = AT;
+    MakeTrapezoidal( LEFT, UPPER, 0, R );
+}
+
+template<typename Real>
+inline void
+TSQRFactor( Matrix<Real>& A, Matrix<Real>& t )
+{ QR( A ); }
+
+template<typename Real>
+inline void
+TSQRFactor( Matrix<Complex<Real> >& A, Matrix<Complex<Real> >& t )
+{ QR( A, t ); }
+
+template<typename Real>
+inline void
+TSQRApplyQ( const Matrix<Real>& H, const Matrix<Real>& t, Matrix<Real>& B )
+{ ApplyPackedReflectors( LEFT, LOWER, VERTICAL, BACKWARD, 0, H, B ); }
+
+template<typename Real>
+inline void
+TSQRApplyQ
+( const Matrix<Complex<Real> >& H, const Matrix<Complex<Real> >& t,
+        Matrix<Complex<Real> >& B )
+{
+    ApplyPackedReflectors
+    ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED, 0, H, t, B );
+}
+
+} // namespace internal
+
+template<typename F>
+inline void
+TSQR
+( DistMatrix<F,VC,STAR>& A, DistMatrix<F,STAR,STAR>& R, TSQRTree<F>& tree )
+{
+#ifndef RELEASE
+    PushCallStack("TSQR");
+    if( A.Grid() != R.Grid() )
+        throw std::logic_error("{A,R} must be distributed over the same grid");
+    if( A.Height() < A.Width() )
+        throw std::logic_error("A must be at least as tall as it is wide");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Width();
+    const int p = g.Size();
+    const int rank = g.VCRank();
+    const mpi::Comm comm = g.VCComm();
+
+    std::vector<int> strides;
+    int parentStride;
+    internal::TSQRSchedule( rank, p, strides, parentStride );
+
+    // Factor the local rows
+    Matrix<F>& ALocal = A.LocalMatrix();
+    internal::TSQRFactor( ALocal, tree.t0 );
+    Matrix<F> RLocal;
+    internal::TSQRTriangle( ALocal, RLocal );
+
+    // Combine pairs of triangular factors up the tree
+    tree.QRList.resize( strides.size() );
+    tree.tList.resize( strides.size() );
+    Matrix<F> QRT, QRB;
+    for( unsigned level=0; level<strides.size(); ++level )
+    {
+        const int stride = strides[level];
+        const int partnerHeight =
+            internal::TSQRSubtreeHeight( A, rank+stride, stride );
+        Matrix<F> RPartner( partnerHeight, n );
+        mpi::Recv
+        ( RPartner.Buffer(), partnerHeight*n, rank+stride, 0, comm );
+
+        Matrix<F>& QR = tree.QRList[level];
+        QR.Empty();
+        QR.ResizeTo( RLocal.Height()+partnerHeight, n );
+        PartitionDown
+        ( QR, QRT,
+              QRB, RLocal.Height() );
+        QRT = RLocal;
+        QRB = RPartner;
+        internal::TSQRFactor( QR, tree.tList[level] );
+        internal::TSQRTriangle( QR, RLocal );
+    }
+    if( parentStride != 0 )
+        mpi::Send
+        ( RLocal.LockedBuffer(), RLocal.Height()*n,
+          rank-parentStride, 0, comm );
+
+    // Broadcast the final triangular factor from the root
+    Matrix<F> RRoot( n, n );
+    if( rank == 0 )
+        RRoot = RLocal;
+    mpi::Broadcast( RRoot.Buffer(), n*n, 0, comm );
+    R.ResizeTo( n, n );
+    R.LocalMatrix() = RRoot;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+ExpandTSQR( DistMatrix<F,VC,STAR>& A, const TSQRTree<F>& tree )
+{
+#ifndef RELEASE
+    PushCallStack("ExpandTSQR");
+    if( A.Height() < A.Width() )
+        throw std::logic_error("A must be at least as tall as it is wide");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Width();
+    const int p = g.Size();
+    const int rank = g.VCRank();
+    const mpi::Comm comm = g.VCComm();
+
+    std::vector<int> strides;
+    int parentStride;
+    internal::TSQRSchedule( rank, p, strides, parentStride );
+#ifndef RELEASE
+    if( tree.QRList.size() != strides.size() ||
+        tree.tList.size() != strides.size() )
+        throw std::logic_error("Tree does not match the distribution of A");
+#endif
+
+    // Start from the top n x n block of the identity at the root, or from the
+    // rows of the parent's product which correspond to this subtree
+    Matrix<F> Z;
+    if( parentStride == 0 )
+        Identity( n, n, Z );
+    else
+    {
+        const int height =
+            internal::TSQRSubtreeHeight( A, rank, parentStride );
+        Matrix<F> ZParent( height, n );
+        mpi::Recv( ZParent.Buffer(), height*n, rank-parentStride, 0, comm );
+        Z = ZParent;
+    }
+
+    // Apply the Householder transforms from each level down the tree
+    Matrix<F> Y, YT, YB;
+    for( int level=strides.size()-1; level>=0; --level )
+    {
+        const int stride = strides[level];
+        const Matrix<F>& QR = tree.QRList[level];
+        const int topHeight = internal::TSQRSubtreeHeight( A, rank, stride );
+        const int bottomHeight = QR.Height() - topHeight;
+
+        Zeros( QR.Height(), n, Y );
+        PartitionDown
+        ( Y, YT,
+             YB, Z.Height() );
+        YT = Z;
+        internal::TSQRApplyQ( QR, tree.tList[level], Y );
+
+        PartitionDown
+        ( Y, YT,
+             YB, topHeight );
+        Matrix<F> ZPartner;
+        ZPartner = YB;
+        mpi::Send
+        ( ZPartner.LockedBuffer(), bottomHeight*n, rank+stride, 0, comm );
+        Z.Empty();
+        Z = YT;
+    }
+
+    // Apply the local Householder transforms
+    Matrix<F>& ALocal = A.LocalMatrix();
+    Matrix<F> H( ALocal );
+    MakeZeros( ALocal );
+    Matrix<F> ALocalT;
+    View( ALocalT, ALocal, 0, 0, Z.Height(), n );
+    ALocalT = Z;
+    internal::TSQRApplyQ( H, tree.t0, ALocal );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+ExplicitTSQR( DistMatrix<F,VC,STAR>& A, DistMatrix<F,STAR,STAR>& R )
+{
+#ifndef RELEASE
+    PushCallStack("ExplicitTSQR");
+#endif
+    TSQRTree<F> tree;
+    TSQR( A, R, tree );
+    ExpandTSQR( A, tree );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
@@ -0,0 +1,165 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+// Golub-Kahan-Lanczos bidiagonalization of A starting from a random vector,
+// without reorthogonalization. The largest singular value of the k x k upper
+// bidiagonal matrix B_k (which is cheaply computed) is a lower bound for
+// || A ||_2 which converges much faster than power iteration on A^H A, and
+// the iteration stops once its relative change is at most tol. Since the loss
+// of orthogonality only manifests as spurious copies of converged singular
+// values, it does not affect the estimate.
+
+namespace internal {
+
+template<typename R>
+inline R
+BidiagonalTwoNorm( const std::vector<R>& d, const std::vector<R>& e )
+{
+    const int k = d.size();
+    std::vector<R> dCopy( d ), eCopy( std::max(k-1,1), 0 );
+    for( int i=0; i<k-1; ++i )
+        eCopy[i] = e[i];
+    R *VTrans=0, *U=0;
+    lapack::BidiagQRAlg( 'U', k, 0, 0, &dCopy[0], &eCopy[0], VTrans, 1, U, 1 );
+    return dCopy[0];
+}
+
+} // namespace internal
+
+template<typename F>
+inline typename Base<F>::type
+TwoNormEstimate( const Matrix<F>& A, typename Base<F>::type tol, int maxIts )
+{
+#ifndef RELEASE
+    PushCallStack("TwoNormEstimate");
+#endif
+    typedef typename Base<F>::type R;
+    const int m = A.Height();
+    const int n = A.Width();
+
+    Matrix<F> u, v;
+    Zeros( m, 1, u );
+    Uniform( n, 1, v );
+    R estimate = 0;
+    R beta = Nrm2( v );
+    if( m == 0 || n == 0 || beta == R(0) )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return estimate;
+    }
+    Scale( R(1)/beta, v );
+    beta = 0;
+
+    std::vector<R> d, e;
+    for( int k=0; k<maxIts; ++k )
+    {
+        // u := (A v - beta u) / alpha
+        Gemv( NORMAL, F(1), A, v, F(-beta), u );
+        const R alpha = Nrm2( u );
+        if( k > 0 )
+            e.push_back( beta );
+        d.push_back( alpha );
+        const R lastEstimate = estimate;
+        estimate = internal::BidiagonalTwoNorm( d, e );
+        if( alpha == R(0) || Abs(estimate-lastEstimate) <= tol*estimate )
+            break;
+        Scale( R(1)/alpha, u );
+
+        // v := (A^H u - alpha v) / beta
+        Gemv( ADJOINT, F(1), A, u, F(-alpha), v );
+        beta = Nrm2( v );
+        if( beta == R(0) )
+            break;
+        Scale( R(1)/beta, v );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return estimate;
+}
+
+template<typename F>
+inline typename Base<F>::type
+TwoNormEstimate
+( const DistMatrix<F>& A, typename Base<F>::type tol, int maxIts )
+{
+#ifndef RELEASE
+    PushCallStack("TwoNormEstimate");
+#endif
+    typedef typename Base<F>::type R;
+    const int m = A.Height();
+    const int n = A.Width();
+
+    const Grid& g = A.Grid();
+    DistMatrix<F,VC,STAR> u(g), v(g);
+    Zeros( m, 1, u );
+    Uniform( n, 1, v );
+    R estimate = 0;
+    R beta = Norm( v );
+    if( m == 0 || n == 0 || beta == R(0) )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return estimate;
+    }
+    Scale( R(1)/beta, v );
+    beta = 0;
+
+    // Every process redundantly computes the singular values of B_k
+    std::vector<R> d, e;
+    for( int k=0; k<maxIts; ++k )
+    {
+        // u := (A v - beta u) / alpha
+        Gemv( NORMAL, F(1), A, v, F(-beta), u );
+        const R alpha = Norm( u );
+        if( k > 0 )
+            e.push_back( beta );
+        d.push_back( alpha );
+        const R lastEstimate = estimate;
+        estimate = internal::BidiagonalTwoNorm( d, e );
+        if( alpha == R(0) || Abs(estimate-lastEstimate) <= tol*estimate )
+            break;
+        Scale( R(1)/alpha, u );
+
+        // v := (A^H u - alpha v) / beta
+        Gemv( ADJOINT, F(1), A, u, F(-alpha), v );
+        beta = Norm( v );
+        if( beta == R(0) )
+            break;
+        Scale( R(1)/beta, v );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return estimate;
+}
+
+template<typename F,Distribution U,Distribution V>
+inline typename Base<F>::type
+TwoNormEstimate
+( const DistMatrix<F,U,V>& A, typename Base<F>::type tol, int maxIts )
+{
+#ifndef RELEASE
+    PushCallStack("TwoNormEstimate");
+#endif
+    // The matrix-vector products require an [MC,MR] distribution
+    DistMatrix<F> B( A );
+    const typename Base<F>::type estimate = TwoNormEstimate( B, tol, maxIts );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return estimate;
+}
+
+} // namespace elem
@@ -119,6 +119,12 @@ template<typename F>
 void PanelLU( Matrix<F>& A, Matrix<int>& p, int pivotOffset=0 );
 template<typename F>
 void PanelLU
+( DistMatrix<F,STAR,STAR>& A, 
+  DistMatrix<F,MC,  STAR>& B, 
+  DistMatrix<int,STAR,STAR>& p, 
+  int pivotOffset=0 );
+template<typename F>
+void TournamentPanelLU
 ( DistMatrix<F,STAR,STAR>& A, 
   DistMatrix<F,MC,  STAR>& B, 
   DistMatrix<int,STAR,STAR>& p, 
@@ -164,6 +170,28 @@ template<typename R>
 void PanelQR
 ( DistMatrix<Complex<R> >& A, DistMatrix<Complex<R>,MD,STAR>& t );
 
+template<typename R>
+void TSQRPanelQR( DistMatrix<R>& A );
+template<typename R>
+void TSQRPanelQR
+( DistMatrix<Complex<R> >& A, DistMatrix<Complex<R>,MD,STAR>& t );
+
+//----------------------------------------------------------------------------//
+// QDWH                                                                       //
+//----------------------------------------------------------------------------//
+
+// Explicit QR of [X; I] which exploits the sparsity of the identity block
+template<typename R>
+void StructuredExplicitQR( Matrix<R>& W, int m, Matrix<R>& Q );
+template<typename R>
+void StructuredExplicitQR
+( Matrix<Complex<R> >& W, int m, Matrix<Complex<R> >& Q );
+template<typename R>
+void StructuredExplicitQR( DistMatrix<R>& W, int m, DistMatrix<R>& Q );
+template<typename R>
+void StructuredExplicitQR
+( DistMatrix<Complex<R> >& W, int m, DistMatrix<Complex<R> >& Q );
+
 //----------------------------------------------------------------------------//
 // Reflector                                                                  //
 //----------------------------------------------------------------------------//
@@ -349,6 +377,39 @@ void HPDInverseLVar2( DistMatrix<F>& A );
 template<typename F>
 void HPDInverseUVar2( DistMatrix<F>& A );
 
+//----------------------------------------------------------------------------//
+// Krylov solvers                                                             //
+//----------------------------------------------------------------------------//
+
+// Z := X^H Y, which is formed on every process
+template<typename F>
+void InnerProducts
+( const DistMatrix<F,VC,STAR>& X, const DistMatrix<F,VC,STAR>& Y, 
+  Matrix<F>& Z );
+
+// products[j] := x_j^H y_j for each pair of columns
+template<typename F>
+void ColumnInnerProducts
+( const DistMatrix<F,VC,STAR>& X, const DistMatrix<F,VC,STAR>& Y, 
+  std::vector<F>& products );
+
+template<typename F>
+void ColumnNorms
+( const DistMatrix<F,VC,STAR>& X, std::vector<typename Base<F>::type>& norms );
+
+//----------------------------------------------------------------------------//
+// Out-of-core factorizations                                                 //
+//----------------------------------------------------------------------------//
+
+// Sweep over the column panels of A, updating each panel with all of the 
+// previous panels (which are streamed in from disk) before factoring it and 
+// writing it back. The updater must provide
+//   void Update( int k, DistMatrix<F>& Pk, int j, const DistMatrix<F>& Pj );
+//   void Factor( int k, DistMatrix<F>& Pk );
+// where k and j are the first columns of the panels Pk and Pj.
+template<typename F,class PanelUpdater>
+void LeftLookingOutOfCore( OutOfCoreMatrix<F>& A, PanelUpdater& updater );
+
 //----------------------------------------------------------------------------//
 // Triangular Inverse                                                         //
 //----------------------------------------------------------------------------//
@@ -25,6 +25,27 @@ typename Base<F>::type ConditionNumber( const DistMatrix<F,U,V>& A );
 //
 // TODO: Generalize to condition number with respect to various norms
 
+//
+// Condition number estimates:
+//
+// Return a lower bound on (and usually the exact value of) the one-norm 
+// condition number, || A ||_1 || inv(A) ||_1, given || A ||_1 and an existing
+// factorization of A. Only a handful of O(n^2) triangular solves are required.
+//
+template<typename F>
+typename Base<F>::type ConditionEstimateAfterLU
+( const Matrix<F>& A, const Matrix<int>& p, typename Base<F>::type oneNorm );
+template<typename F>
+typename Base<F>::type ConditionEstimateAfterLU
+( const DistMatrix<F>& A, const DistMatrix<int,VC,STAR>& p, 
+  typename Base<F>::type oneNorm );
+template<typename F>
+typename Base<F>::type ConditionEstimateAfterCholesky
+( UpperOrLower uplo, const Matrix<F>& A, typename Base<F>::type oneNorm );
+template<typename F>
+typename Base<F>::type ConditionEstimateAfterCholesky
+( UpperOrLower uplo, const DistMatrix<F>& A, typename Base<F>::type oneNorm );
+
 //
 // Determinant: 
 //
@@ -160,6 +181,18 @@ template<typename F>
 typename Base<F>::type TwoNormLowerBound( const Matrix<F>& A );
 template<typename F>
 typename Base<F>::type TwoNormUpperBound( const Matrix<F>& A );
+// Estimate || A ||_2 from below with Golub-Kahan-Lanczos bidiagonalization,
+// stopping once the relative change in the estimate is at most tol
+template<typename F>
+typename Base<F>::type TwoNormEstimate
+( const Matrix<F>& A, typename Base<F>::type tol=1e-6, int maxIts=100 );
+template<typename F>
+typename Base<F>::type TwoNormEstimate
+( const DistMatrix<F>& A, typename Base<F>::type tol=1e-6, int maxIts=100 );
+template<typename F,Distribution U,Distribution V>
+typename Base<F>::type TwoNormEstimate
+( const DistMatrix<F,U,V>& A, typename Base<F>::type tol=1e-6, 
+  int maxIts=100 );
 
 //
 // HermitianNorm
@@ -210,6 +243,14 @@ template<typename F>
 void Cholesky( UpperOrLower uplo, Matrix<F>& A );
 template<typename F>
 void Cholesky( UpperOrLower uplo, DistMatrix<F>& A );
+// Batched versions (a NonHPDMatrixException reports the first failure)
+template<typename F>
+void Cholesky( UpperOrLower uplo, MatrixBatch<F>& A );
+template<typename F>
+void Cholesky( UpperOrLower uplo, DistMatrixBatch<F>& A );
+// Out-of-core version, which streams column panels of A to and from disk
+template<typename F>
+void Cholesky( UpperOrLower uplo, OutOfCoreMatrix<F>& A );
 
 //
 // GaussianElimination: 
@@ -285,6 +326,14 @@ template<typename F>
 void LU( Matrix<F>& A, Matrix<int>& p );
 template<typename F>
 void LU( DistMatrix<F>& A, DistMatrix<int,VC,STAR>& p );
+// Batched versions (each matrix must be square)
+template<typename F>
+void LU( MatrixBatch<F>& A, MatrixBatch<int>& p );
+template<typename F>
+void LU( DistMatrixBatch<F>& A, DistMatrixBatch<int>& p );
+// Out-of-core version (A must be square)
+template<typename F>
+void LU( OutOfCoreMatrix<F>& A, DistMatrix<int,VC,STAR>& p );
 
 //
 // LQ (LQ factorization): 
@@ -375,6 +424,41 @@ void ExplicitQR( Matrix<F>& A, Matrix<F>& R );
 template<typename F>
 void ExplicitQR( DistMatrix<F>& A, DistMatrix<F>& R );
 
+//
+// TSQR (Tall-skinny QR factorization):
+//
+// Each process computes a QR factorization of its rows of A, and the
+// resulting triangular factors are then combined pairwise along a binary
+// tree over the processes, so that R is computed with only log2(p) messages
+// rather than with one reduction per column.
+//
+// Q is represented implicitly: on exit, the local portion of A holds the
+// Householder transforms from the factorization of the process's rows, and
+// 'tree' holds those from each level of the tree at which the process
+// combined its triangular factor with that of a partner (along with the
+// scalars 't' in the complex case). R is returned on every process.
+//
+
+template<typename F>
+struct TSQRTree
+{
+    Matrix<F> t0;
+    std::vector<Matrix<F> > QRList, tList;
+};
+
+template<typename F>
+void TSQR
+( DistMatrix<F,VC,STAR>& A, DistMatrix<F,STAR,STAR>& R, TSQRTree<F>& tree );
+
+// Overwrite the Householder transforms stored in A with the first n columns
+// of the Q from a TSQR factorization
+template<typename F>
+void ExpandTSQR( DistMatrix<F,VC,STAR>& A, const TSQRTree<F>& tree );
+
+// Overwrite A with the first n columns of Q from its TSQR factorization
+template<typename F>
+void ExplicitTSQR( DistMatrix<F,VC,STAR>& A, DistMatrix<F,STAR,STAR>& R );
+
 //----------------------------------------------------------------------------//
 // Linear solvers                                                             //
 //----------------------------------------------------------------------------//
@@ -389,6 +473,11 @@ template<typename F>
 void CholeskySolve( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& B );
 template<typename F>
 void CholeskySolve( UpperOrLower uplo, DistMatrix<F>& A, DistMatrix<F>& B );
+template<typename F>
+void CholeskySolve( UpperOrLower uplo, MatrixBatch<F>& A, MatrixBatch<F>& B );
+template<typename F>
+void CholeskySolve
+( UpperOrLower uplo, DistMatrixBatch<F>& A, DistMatrixBatch<F>& B );
 
 //
 // HouseholderSolve:
@@ -421,6 +510,21 @@ void HouseholderSolve
   const DistMatrix<Complex<R> >& B, 
         DistMatrix<Complex<R> >& X );
 
+//
+// Mixed-precision solves:
+//
+// Overwrite B := inv(A) B by factoring a single-precision copy of A and then
+// refining the solution in double precision with residuals formed from A.
+// A is only overwritten (with its double-precision factorization) if the 
+// refinement stagnates, in which case -1 is returned; otherwise the number
+// of refinement steps is returned.
+//
+template<typename F>
+int LinearSolveMixed( DistMatrix<F>& A, DistMatrix<F>& B, int maxIts=30 );
+template<typename F>
+int CholeskySolveMixed
+( UpperOrLower uplo, DistMatrix<F>& A, DistMatrix<F>& B, int maxIts=30 );
+
 //
 // SolveAfterCholesky (solve after having perfored a Cholesky fact. of A):
 //
@@ -458,6 +562,110 @@ void SolveAfterLU
 ( Orientation orientation,
   const DistMatrix<F>& A, const DistMatrix<int,VC,STAR>& p, DistMatrix<F>& B );
 
+//
+// Preconditioners for the Krylov solvers below: each represents some M which
+// approximates A and provides Apply( Z ), which overwrites Z := inv(M) Z.
+//
+
+template<typename F>
+class IdentityPreconditioner
+{
+public:
+    void Apply( DistMatrix<F,VC,STAR>& Z ) const;
+};
+
+// Applies an existing Cholesky factorization of a dense HPD approximation M,
+// which is stored in the 'uplo' triangle of the given matrix
+template<typename F>
+class CholeskyPreconditioner
+{
+public:
+    CholeskyPreconditioner( UpperOrLower uplo, const DistMatrix<F>& M );
+    void Apply( DistMatrix<F,VC,STAR>& Z ) const;
+
+private:
+    UpperOrLower uplo_;
+    const DistMatrix<F>* M_;
+};
+
+// Applies an existing LU factorization with partial pivoting of a dense 
+// approximation M
+template<typename F>
+class LUPreconditioner
+{
+public:
+    LUPreconditioner
+    ( const DistMatrix<F>& M, const DistMatrix<int,VC,STAR>& p );
+    void Apply( DistMatrix<F,VC,STAR>& Z ) const;
+
+private:
+    const DistMatrix<F>* M_;
+    const DistMatrix<int,VC,STAR>* p_;
+};
+
+//
+// CG (preconditioned Conjugate Gradients):
+//
+// Solves A X = B for the Hermitian positive-definite sparse matrix A by 
+// running PCG on each column of B simultaneously, so that every iteration 
+// requires a single (multiple right-hand side) product with A. X holds the 
+// initial guess on entry, and a column has converged once its residual 
+// satisfies || b - A x ||_2 <= relTol || b ||_2. The number of iterations is
+// returned, and a std::runtime_error is thrown if any column has not 
+// converged within maxIts iterations.
+//
+
+template<typename F,class Preconditioner>
+int CG
+( const DistSparseMatrix<F>& A, const DistMatrix<F,VC,STAR>& B,
+  DistMatrix<F,VC,STAR>& X, const Preconditioner& M,
+  typename Base<F>::type relTol, int maxIts );
+template<typename F>
+int CG
+( const DistSparseMatrix<F>& A, const DistMatrix<F,VC,STAR>& B,
+  DistMatrix<F,VC,STAR>& X, typename Base<F>::type relTol, int maxIts );
+
+//
+// BlockCG (preconditioned block Conjugate Gradients):
+//
+// Same as CG, but the search directions of all of the columns are combined
+// (O'Leary's block method), which typically reduces the number of iterations
+// when there are several right-hand sides. The search directions must remain
+// linearly independent, so a NonHPDMatrixException is thrown upon breakdown,
+// e.g., if a column of B is a linear combination of the others.
+//
+
+template<typename F,class Preconditioner>
+int BlockCG
+( const DistSparseMatrix<F>& A, const DistMatrix<F,VC,STAR>& B,
+  DistMatrix<F,VC,STAR>& X, const Preconditioner& M,
+  typename Base<F>::type relTol, int maxIts );
+template<typename F>
+int BlockCG
+( const DistSparseMatrix<F>& A, const DistMatrix<F,VC,STAR>& B,
+  DistMatrix<F,VC,STAR>& X, typename Base<F>::type relTol, int maxIts );
+
+//
+// GMRES (right-preconditioned, restarted GMRES):
+//
+// Solves A X = B for a general square sparse matrix A, one column at a time,
+// restarting after every 'restart' iterations. The convergence criterion is 
+// the same as that of CG (and is checked against the true residual before
+// returning), and the largest number of iterations required by any column is
+// returned.
+//
+
+template<typename F,class Preconditioner>
+int GMRES
+( const DistSparseMatrix<F>& A, const DistMatrix<F,VC,STAR>& B,
+  DistMatrix<F,VC,STAR>& X, const Preconditioner& M,
+  typename Base<F>::type relTol, int restart, int maxIts );
+template<typename F>
+int GMRES
+( const DistSparseMatrix<F>& A, const DistMatrix<F,VC,STAR>& B,
+  DistMatrix<F,VC,STAR>& X, 
+  typename Base<F>::type relTol, int restart, int maxIts );
+
 //----------------------------------------------------------------------------//
 // Factorization-based inversion                                              //
 //----------------------------------------------------------------------------//
@@ -553,6 +761,27 @@ void HermitianTridiag
   DistMatrix<Complex<R> >& A,
   DistMatrix<Complex<R>,STAR,STAR>& t );
 
+//
+// HermitianTridiagTwoStage:
+//
+// Reduces A to a band of the given width using BLAS-3 updates and then
+// chases bulges down the band to reach real symmetric tridiagonal form.
+//
+// On exit, the diagonal and sub/super-diagonal of A hold the tridiagonal 
+// matrix, the transforms from the first stage are stored below the band of A
+// (and are implicitly one on its last subdiagonal), with their scalars in 't'
+// in the complex case, and those from the second stage are stored in V and 
+// 'tau', with column s holding the transforms of the s'th sweep. The 
+// transforms are always stored in the lower triangle of A, even if 'uplo' 
+// is set to 'UPPER'.
+//
+
+template<typename F>
+void HermitianTridiagTwoStage
+( UpperOrLower uplo, int bandwidth, DistMatrix<F>& A, 
+  DistMatrix<F,STAR,STAR>& t, 
+  DistMatrix<F,STAR,VR>& V, DistMatrix<F,STAR,VR>& tau );
+
 //----------------------------------------------------------------------------//
 // Eigensolvers and SVD                                                       //
 //----------------------------------------------------------------------------//
@@ -561,7 +790,41 @@ void HermitianTridiag
 // HermitianEig (Hermitian Eigensolver)
 //
 
-// TODO: Serial version
+// Sequential versions, which are templated over the datatype and call LAPACK
+template<typename F>
+void HermitianEig
+( UpperOrLower uplo, Matrix<F>& A, 
+  Matrix<typename Base<F>::type>& w, Matrix<F>& Z );
+template<typename F>
+void HermitianEig
+( UpperOrLower uplo, Matrix<F>& A, 
+  Matrix<typename Base<F>::type>& w, Matrix<F>& Z, int a, int b );
+template<typename F>
+void HermitianEig
+( UpperOrLower uplo, Matrix<F>& A, 
+  Matrix<typename Base<F>::type>& w, Matrix<F>& Z, 
+  typename Base<F>::type a, typename Base<F>::type b );
+template<typename F>
+void HermitianEig
+( UpperOrLower uplo, Matrix<F>& A, Matrix<typename Base<F>::type>& w );
+template<typename F>
+void HermitianEig
+( UpperOrLower uplo, Matrix<F>& A, Matrix<typename Base<F>::type>& w,
+  int a, int b );
+template<typename F>
+void HermitianEig
+( UpperOrLower uplo, Matrix<F>& A, Matrix<typename Base<F>::type>& w,
+  typename Base<F>::type a, typename Base<F>::type b );
+
+// Grab the full set of eigenpairs of each matrix of a batch
+template<typename F>
+void HermitianEig
+( UpperOrLower uplo, MatrixBatch<F>& A, 
+  MatrixBatch<typename Base<F>::type>& w, MatrixBatch<F>& Z );
+template<typename F>
+void HermitianEig
+( UpperOrLower uplo, DistMatrixBatch<F>& A, 
+  DistMatrixBatch<typename Base<F>::type>& w, DistMatrixBatch<F>& Z );
 
 #ifndef WITHOUT_PMRRR
 // Grab the full set of eigenpairs of the real, symmetric matrix A
@@ -635,6 +898,41 @@ void HermitianEig
   double a, double b );
 #endif // WITHOUT_PMRRR
 
+//
+// HermitianInertia:
+//
+// Returns the number of eigenvalues of the Hermitian matrix A which are 
+// greater than and less than 'shift' via the signs of the diagonal of the 
+// (unpivoted) LDL^H factorization of A - shift I. A SingularMatrixException
+// is thrown if a zero pivot is encountered.
+//
+
+template<typename F>
+InertiaType HermitianInertia
+( UpperOrLower uplo, const Matrix<F>& A, typename Base<F>::type shift );
+template<typename F>
+InertiaType HermitianInertia
+( UpperOrLower uplo, const DistMatrix<F>& A, typename Base<F>::type shift );
+
+//
+// HermitianSlicedEig (spectrum slicing Hermitian eigensolver):
+//
+// Computes the eigenpairs of the Hermitian matrix A with eigenvalues in the
+// half-open interval (a,b] by splitting it into 
+// numSubgrids*slicesPerSubgrid slices, counting the eigenvalues within each
+// slice with HermitianInertia, and assigning the slices to disjoint 
+// subgrids, which run shift-and-invert subspace iteration independently. 
+// A is overwritten with its explicitly Hermitian form, and the eigenpairs 
+// are returned in non-decreasing order.
+//
+
+template<typename F>
+void HermitianSlicedEig
+( UpperOrLower uplo, DistMatrix<F>& A,
+  DistMatrix<typename Base<F>::type,VR,STAR>& w, DistMatrix<F>& Z,
+  typename Base<F>::type a, typename Base<F>::type b,
+  int numSubgrids, int slicesPerSubgrid );
+
 //
 // SortEig
 //
@@ -936,12 +1234,23 @@ int HermitianHalley
 // Dynamically-weighted QR-based Halley iteration
 template<typename F>
 int QDWH
-( Matrix<F>& A, 
+( Matrix<F>& A,
   typename Base<F>::type lowerBound, typename Base<F>::type upperBound );
 template<typename F>
 int QDWH
-( DistMatrix<F>& A, 
+( DistMatrix<F>& A,
   typename Base<F>::type lowerBound, typename Base<F>::type upperBound );
+// Versions which estimate the bounds from an initial QR factorization and
+// report the iteration counts and timings (in seconds, on this process)
+struct QDWHInfo
+{
+    int numIts, numQRIts, numCholIts;
+    double estimateTime, qrTime, cholTime, totalTime;
+};
+template<typename F>
+QDWHInfo QDWH( Matrix<F>& A );
+template<typename F>
+QDWHInfo QDWH( DistMatrix<F>& A );
 template<typename F>
 int HermitianQDWH
 ( UpperOrLower uplo, Matrix<F>& A,
@@ -978,6 +1287,32 @@ void SingularValues
   DistMatrix<typename Base<F>::type,VR,STAR>& s,
   double heightRatio=1.2 );
 
+//
+// RandomizedSVD: Approximate the k largest singular triplets of A using a 
+//                Gaussian sketch with 'oversample' extra columns and
+//                'powerIters' subspace iterations.
+//
+template<typename F>
+void RandomizedSVD
+( const DistMatrix<F>& A,
+  DistMatrix<typename Base<F>::type,VR,STAR>& s,
+  DistMatrix<F>& U, DistMatrix<F>& V,
+  int k, int oversample=10, int powerIters=2 );
+
+//
+// PartialSVD: Approximate the k largest singular triplets of A using 
+//             Golub-Kahan-Lanczos bidiagonalization with full 
+//             reorthogonalization. If tol is zero, it is set to sqrt(eps), 
+//             and if maxBasisSize is zero, it is set to min(m,n). The number
+//             of Lanczos steps is returned.
+//
+template<typename F>
+int PartialSVD
+( const DistMatrix<F>& A,
+  DistMatrix<typename Base<F>::type,VR,STAR>& s,
+  DistMatrix<F>& U, DistMatrix<F>& V,
+  int k, typename Base<F>::type tol=0, int maxBasisSize=0 );
+
 //
 // Pseudoinverse:
 //
@@ -1046,6 +1381,11 @@ void ApplyColumnPivots
   const std::vector<int>& preimage );
 template<typename F>
 void ApplyRowPivots
+( Matrix<F>& A,
+  const std::vector<int>& image,
+  const std::vector<int>& preimage );
+template<typename F>
+void ApplyRowPivots
 ( DistMatrix<F>& A,
   const std::vector<int>& image,
   const std::vector<int>& preimage );
@@ -1159,6 +1499,109 @@ void ApplyPackedReflectors
   const DistMatrix<Complex<R>,STAR,STAR>& t,
         DistMatrix<Complex<R> >& A );
 
+// A set of packed reflectors, e.g., from a QR, LQ, or bidiagonal
+// factorization, which caches the inverses of the triangular factors formed
+// for each panel of the UT transform so that repeated applications of the
+// same transforms (to different matrices) avoid recomputing them.
+//
+// NOTE: H is referenced rather than copied and must not be modified while
+//       attached; re-attaching clears the cache.
+template<typename F>
+class PackedReflectors
+{
+public:
+    PackedReflectors( const Grid& g );
+
+    void Attach
+    ( UpperOrLower uplo, VerticalOrHorizontal dir, int offset,
+      const DistMatrix<F>& H );
+    void Attach
+    ( UpperOrLower uplo, VerticalOrHorizontal dir, int offset,
+      const DistMatrix<F>& H, const DistMatrix<F,MD,STAR>& t );
+    void Attach
+    ( UpperOrLower uplo, VerticalOrHorizontal dir, int offset,
+      const DistMatrix<F>& H, const DistMatrix<F,STAR,STAR>& t );
+
+    UpperOrLower Uplo() const;
+    VerticalOrHorizontal Dir() const;
+    int Offset() const;
+    const DistMatrix<F>& H() const;
+    const DistMatrix<F,MD,STAR>& t() const;
+
+    int NumCachedPanels() const;
+    void ClearCache();
+
+    // Used by the parallel ApplyPackedReflectors routines
+    bool FindPanel
+    ( int i, int j, int height, int width, UpperOrLower uplo,
+      Conjugation conjugation, DistMatrix<F,STAR,STAR>& SInv ) const;
+    void StorePanel
+    ( int i, int j, int height, int width, UpperOrLower uplo,
+      Conjugation conjugation, const DistMatrix<F,STAR,STAR>& SInv ) const;
+
+private:
+    struct PanelKey
+    {
+        int i, j, height, width;
+        UpperOrLower uplo;
+        Conjugation conjugation;
+
+        bool operator<( const PanelKey& key ) const;
+    };
+
+    UpperOrLower uplo_;
+    VerticalOrHorizontal dir_;
+    int offset_;
+    const DistMatrix<F>* H_;
+    DistMatrix<F,MD,STAR> t_;
+    mutable std::map<PanelKey,Matrix<F> > cache_;
+};
+
+// Apply the transforms from a PackedReflectors object, reusing the cached
+// panel factors when possible
+template<typename R>
+void ApplyPackedReflectors
+( LeftOrRight side, ForwardOrBackward order,
+  const PackedReflectors<R>& Q, DistMatrix<R>& A );
+template<typename R>
+void ApplyPackedReflectors
+( LeftOrRight side, ForwardOrBackward order, Conjugation conjugation,
+  const PackedReflectors<Complex<R> >& Q, DistMatrix<Complex<R> >& A );
+
+// Factorizations which return their Householder transforms as a
+// PackedReflectors object
+template<typename R>
+void QR( DistMatrix<R>& A, PackedReflectors<R>& Q );
+template<typename R>
+void QR( DistMatrix<Complex<R> >& A, PackedReflectors<Complex<R> >& Q );
+template<typename R>
+void LQ( DistMatrix<R>& A, PackedReflectors<R>& Q );
+template<typename R>
+void LQ( DistMatrix<Complex<R> >& A, PackedReflectors<Complex<R> >& Q );
+template<typename R>
+void Bidiag
+( DistMatrix<R>& A, PackedReflectors<R>& P, PackedReflectors<R>& Q );
+template<typename R>
+void Bidiag
+( DistMatrix<Complex<R> >& A,
+  PackedReflectors<Complex<R> >& P, PackedReflectors<Complex<R> >& Q );
+template<typename R>
+void HermitianTridiag
+( UpperOrLower uplo, DistMatrix<R>& A, PackedReflectors<R>& Q );
+template<typename R>
+void HermitianTridiag
+( UpperOrLower uplo, DistMatrix<Complex<R> >& A,
+  PackedReflectors<Complex<R> >& Q );
+
+// Applies the transforms from HermitianTridiagTwoStage, A := Q A, first
+// redistributing A so that each process owns entire columns for the 
+// application of the transforms from the bulge chasing
+template<typename F>
+void ApplyTwoStageReflectors
+( int bandwidth, const DistMatrix<F>& H, const DistMatrix<F,STAR,STAR>& t,
+  const DistMatrix<F,STAR,VR>& V, const DistMatrix<F,STAR,VR>& tau,
+  DistMatrix<F>& A );
+
 //
 // ExpandPackedReflectors:
 //
@@ -1201,18 +1644,65 @@ enum HermitianTridiagApproach
 {
     HERMITIAN_TRIDIAG_NORMAL, // Keep the current grid
     HERMITIAN_TRIDIAG_SQUARE, // Drop to a square process grid
+    HERMITIAN_TRIDIAG_TWO_STAGE, // Reduce to a band, then chase bulges
     HERMITIAN_TRIDIAG_DEFAULT // Square grid algorithm only if already square
 };
 }
 using namespace hermitian_tridiag_approach_wrapper;
 
+// The two-stage approach is only used by the eigensolvers, as the output of
+// HermitianTridiag must be representable with a single set of transforms
 void SetHermitianTridiagApproach( HermitianTridiagApproach approach );
 HermitianTridiagApproach GetHermitianTridiagApproach();
 
+// The width of the intermediate band in the two-stage approach
+void SetHermitianTridiagBandwidth( int bandwidth );
+int GetHermitianTridiagBandwidth();
+
 // If dropping down to a square grid, the two simplest approaches are to take 
 // the first r^2 processes from the original grid (for an r x r grid) and to
 // either order them column-major or row-major to form the square grid.
 void SetHermitianTridiagGridOrder( GridOrder order );
 GridOrder GetHermitianTridiagGridOrder();
 
+namespace lu_approach_wrapper {
+enum LUApproach
+{
+    LU_BULK_SYNCHRONOUS, // Factor each panel after the full trailing update
+    LU_LOOK_AHEAD        // Factor the next panel before the trailing update
+};
+}
+using namespace lu_approach_wrapper;
+
+// Only affects distributed LU factorizations with partial pivoting
+void SetLUApproach( LUApproach approach );
+LUApproach GetLUApproach();
+
+namespace lu_panel_pivoting_wrapper {
+enum LUPanelPivoting
+{
+    LU_PANEL_PARTIAL,    // One reduction over the process column per column
+    LU_PANEL_TOURNAMENT  // A single tournament over the process column (CALU)
+};
+}
+using namespace lu_panel_pivoting_wrapper;
+
+// Affects the distributed panel factorizations used by LU with partial 
+// pivoting, GaussianElimination, and Determinant
+void SetLUPanelPivoting( LUPanelPivoting pivoting );
+LUPanelPivoting GetLUPanelPivoting();
+
+namespace qr_panel_approach_wrapper {
+enum QRPanelApproach
+{
+    QR_PANEL_HOUSEHOLDER, // One reduction over the process column per column
+    QR_PANEL_TSQR         // TSQR followed by Householder reconstruction (CAQR)
+};
+}
+using namespace qr_panel_approach_wrapper;
+
+// Affects the distributed panel factorizations used by QR
+void SetQRPanelApproach( QRPanelApproach approach );
+QRPanelApproach GetQRPanelApproach();
+
 } // namespace elem
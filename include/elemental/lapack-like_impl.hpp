@@ -12,23 +12,29 @@
 #include "./lapack-like/ApplyColumnPivots.hpp"
 #include "./lapack-like/ApplyRowPivots.hpp"
 #include "./lapack-like/Bidiag.hpp"
+#include "./lapack-like/BlockCG.hpp"
+#include "./lapack-like/CG.hpp"
 #include "./lapack-like/Cholesky.hpp"
 #include "./lapack-like/CholeskySolve.hpp"
 #include "./lapack-like/ComposePivots.hpp"
+#include "./lapack-like/ConditionEstimate.hpp"
 #include "./lapack-like/ConditionNumber.hpp"
 #include "./lapack-like/Determinant.hpp"
 #include "./lapack-like/ExpandPackedReflectors.hpp"
 #include "./lapack-like/ExplicitLQ.hpp"
 #include "./lapack-like/ExplicitQR.hpp"
 #include "./lapack-like/GaussianElimination.hpp"
+#include "./lapack-like/GMRES.hpp"
 #include "./lapack-like/Halley.hpp"
 #include "./lapack-like/HermitianEig.hpp"
 #include "./lapack-like/HermitianFunction.hpp"
 #include "./lapack-like/HermitianGenDefiniteEig.hpp"
 #include "./lapack-like/HermitianHalley.hpp"
+#include "./lapack-like/HermitianInertia.hpp"
 #include "./lapack-like/HermitianNorm.hpp"
 #include "./lapack-like/HermitianPseudoinverse.hpp"
 #include "./lapack-like/HermitianQDWH.hpp"
+#include "./lapack-like/HermitianSlicedEig.hpp"
 #include "./lapack-like/HermitianSVD.hpp"
 #include "./lapack-like/HermitianTridiag.hpp"
 #include "./lapack-like/HilbertSchmidt.hpp"
@@ -39,16 +45,22 @@
 #include "./lapack-like/HPSDSquareRoot.hpp"
 #include "./lapack-like/Inverse.hpp"
 #include "./lapack-like/LDL.hpp"
+#include "./lapack-like/LeftLookingOutOfCore.hpp"
 #include "./lapack-like/LogBarrier.hpp"
 #include "./lapack-like/LogDetDivergence.hpp"
 #include "./lapack-like/LQ.hpp"
 #include "./lapack-like/LU.hpp"
+#include "./lapack-like/MixedPrecisionSolve.hpp"
 #include "./lapack-like/Norm.hpp"
+#include "./lapack-like/PackedReflectors.hpp"
+#include "./lapack-like/PartialSVD.hpp"
 #include "./lapack-like/PivotParity.hpp"
+#include "./lapack-like/Preconditioners.hpp"
 #include "./lapack-like/Polar.hpp"
 #include "./lapack-like/Pseudoinverse.hpp"
 #include "./lapack-like/QDWH.hpp"
 #include "./lapack-like/QR.hpp"
+#include "./lapack-like/RandomizedSVD.hpp"
 #include "./lapack-like/Reflector.hpp"
 #include "./lapack-like/SkewHermitianEig.hpp"
 #include "./lapack-like/SolveAfterCholesky.hpp"
@@ -58,5 +70,7 @@
 #include "./lapack-like/SVD.hpp"
 #include "./lapack-like/Trace.hpp"
 #include "./lapack-like/TriangularInverse.hpp"
+#include "./lapack-like/TSQR.hpp"
+#include "./lapack-like/TwoNormEstimate.hpp"
 #include "./lapack-like/TwoNormLowerBound.hpp"
 #include "./lapack-like/TwoNormUpperBound.hpp"
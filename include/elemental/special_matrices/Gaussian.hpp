@@ -0,0 +1,100 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+// Draw each entry from a normal PDF with the specified mean and standard 
+// deviation.
+template<typename F>
+inline void
+MakeGaussian( Matrix<F>& A, F mean, typename Base<F>::type stddev )
+{
+#ifndef RELEASE
+    PushCallStack("MakeGaussian");
+#endif
+    const int m = A.Height();
+    const int n = A.Width();
+    for( int j=0; j<n; ++j )
+        for( int i=0; i<m; ++i )
+            A.Set( i, j, mean+stddev*SampleNormal<F>() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+Gaussian( int m, int n, Matrix<F>& A, F mean, typename Base<F>::type stddev )
+{
+#ifndef RELEASE
+    PushCallStack("Gaussian");
+#endif
+    A.ResizeTo( m, n );
+    MakeGaussian( A, mean, stddev );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// As with MakeUniform, the entries are drawn with the counter-based generator
+// so that no communication is required.
+template<typename F,Distribution U,Distribution V>
+inline void
+MakeGaussian
+( DistMatrix<F,U,V>& A, F mean, typename Base<F>::type stddev )
+{
+#ifndef RELEASE
+    PushCallStack("MakeGaussian");
+#endif
+    // Every process must draw the stream, even if it does not own any entries
+    const unsigned stream = NewRandomStream();
+    const philox::Key key = RandomKey();
+
+    const int colShift = A.ColShift();
+    const int rowShift = A.RowShift();
+    const int colStride = A.ColStride();
+    const int rowStride = A.RowStride();
+    const int localHeight = A.LocalHeight();
+    const int localWidth = A.LocalWidth();
+    F* localBuffer = A.LocalBuffer();
+    const int ldim = A.LocalLDim();
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for
+#endif
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        const int j = rowShift + jLocal*rowStride;
+        F* col = &localBuffer[jLocal*ldim];
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+        {
+            const int i = colShift + iLocal*colStride;
+            col[iLocal] = mean + stddev*SampleNormal<F>( key, stream, i, j );
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F,Distribution U,Distribution V>
+inline void
+Gaussian
+( int m, int n, DistMatrix<F,U,V>& A, F mean, typename Base<F>::type stddev )
+{
+#ifndef RELEASE
+    PushCallStack("Gaussian");
+#endif
+    A.ResizeTo( m, n );
+    MakeGaussian( A, mean, stddev );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
@@ -119,11 +119,13 @@ MakeNormalUniformSpectrum
     //                                (4 u^H D u) u u^H
     //
 
-    // Form d and D
+    // Form d and D (every process must generate the same d)
     const int n = A.Height();
+    const unsigned stream = NewRandomStream();
+    const philox::Key key = RandomKey();
     std::vector<C> d( n );
     for( int j=0; j<n; ++j )
-        d[j] = center + radius*SampleUnitBall<C>();
+        d[j] = center + radius*SampleUnitBall<C>( key, stream, j, 0 );
     DistMatrix<C> ABackup( grid );
     if( standardDist )
         Diagonal( d, A );
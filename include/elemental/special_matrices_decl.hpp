@@ -246,6 +246,22 @@ template<typename R,Distribution U,Distribution V>
 void MakeNormalUniformSpectrum
 ( DistMatrix<Complex<R>,U,V>& A, Complex<R> center=0, R radius=1 );
 
-// TODO: Gaussian random matrices
+// Generate an m x n matrix of samples from the normal PDF with the specified
+// mean and standard deviation
+template<typename F>
+void Gaussian
+( int m, int n, Matrix<F>& A, 
+  F mean=0, typename Base<F>::type stddev=1 );
+template<typename F,Distribution U,Distribution V>
+void Gaussian
+( int m, int n, DistMatrix<F,U,V>& A, 
+  F mean=0, typename Base<F>::type stddev=1 );
+// Turn the existing matrix into a Gaussian random matrix
+template<typename F>
+void MakeGaussian
+( Matrix<F>& A, F mean=0, typename Base<F>::type stddev=1 );
+template<typename F,Distribution U,Distribution V>
+void MakeGaussian
+( DistMatrix<F,U,V>& A, F mean=0, typename Base<F>::type stddev=1 );
 
 } // namespace elem
@@ -34,5 +34,4 @@
 #include "./special_matrices/Uniform.hpp"
 #include "./special_matrices/HermitianUniformSpectrum.hpp"
 #include "./special_matrices/NormalUniformSpectrum.hpp"
-
-// TODO: Gaussian
+#include "./special_matrices/Gaussian.hpp"
@@ -0,0 +1,153 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "elemental.hpp"
+
+namespace elem {
+
+// Rough defaults for a commodity cluster: 10 microseconds of latency, 
+// 1 GB/s of bandwidth, and 10 GFlops per process
+CostModel::CostModel()
+: latency(1e-5), inverseBandwidth(1e-9), flopTime(1e-10)
+{ }
+
+CostModel::CostModel
+( double latency_, double inverseBandwidth_, double flopTime_ )
+: latency(latency_), inverseBandwidth(inverseBandwidth_), flopTime(flopTime_)
+{ }
+
+CostModel CalibrateCostModel( const Grid& g )
+{
+#ifndef RELEASE
+    PushCallStack("CalibrateCostModel");
+#endif
+    const int p = g.Size();
+    const int rank = g.VCRank();
+    mpi::Comm comm = g.VCComm();
+    CostModel model;
+
+    // Time ping-pongs of small and large messages between pairs of processes
+    if( p > 1 )
+    {
+        const int partner = rank ^ 1;
+        const int numSmallTrials = 100;
+        const int numLargeTrials = 10;
+        const int largeSize = 1<<17;
+        std::vector<double> buffer( largeSize, 0 );
+        double latency = 0, inverseBandwidth = 0;
+        mpi::Barrier( comm );
+        if( partner < p )
+        {
+            double startTime = mpi::Time();
+            for( int trial=0; trial<numSmallTrials; ++trial )
+            {
+                if( rank < partner )
+                {
+                    mpi::Send( &buffer[0], 1, partner, 0, comm );
+                    mpi::Recv( &buffer[0], 1, partner, 0, comm );
+                }
+                else
+                {
+                    mpi::Recv( &buffer[0], 1, partner, 0, comm );
+                    mpi::Send( &buffer[0], 1, partner, 0, comm );
+                }
+            }
+            latency = (mpi::Time()-startTime)/(2*numSmallTrials);
+
+            startTime = mpi::Time();
+            for( int trial=0; trial<numLargeTrials; ++trial )
+            {
+                if( rank < partner )
+                {
+                    mpi::Send( &buffer[0], largeSize, partner, 0, comm );
+                    mpi::Recv( &buffer[0], largeSize, partner, 0, comm );
+                }
+                else
+                {
+                    mpi::Recv( &buffer[0], largeSize, partner, 0, comm );
+                    mpi::Send( &buffer[0], largeSize, partner, 0, comm );
+                }
+            }
+            const double messageTime = 
+                (mpi::Time()-startTime)/(2*numLargeTrials);
+            inverseBandwidth = 
+                std::max(messageTime-latency,0.)/(largeSize*sizeof(double));
+        }
+
+        // Every process must make the same decisions, so use the slowest pair
+        double values[2] = { latency, inverseBandwidth };
+        mpi::AllReduce( values, 2, mpi::MAX, comm );
+        model.latency = values[0];
+        model.inverseBandwidth = values[1];
+    }
+
+    // Time a local matrix-matrix multiplication
+    const int n = 256;
+    Matrix<double> A, B, C;
+    Uniform( n, n, A );
+    Uniform( n, n, B );
+    Zeros( n, n, C );
+    Gemm( NORMAL, NORMAL, 1., A, B, 0., C );
+    const double startTime = mpi::Time();
+    Gemm( NORMAL, NORMAL, 1., A, B, 0., C );
+    double flopTime = (mpi::Time()-startTime)/(2.*n*n*n);
+    mpi::AllReduce( &flopTime, 1, mpi::MAX, comm );
+    model.flopTime = flopTime;
+
+    SetCostModel( model );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return model;
+}
+
+CostModel CalibrateCostModel( const Grid& g, const std::string& cacheFile )
+{
+#ifndef RELEASE
+    PushCallStack("CalibrateCostModel");
+#endif
+    const int rank = g.VCRank();
+    mpi::Comm comm = g.VCComm();
+
+    // The first process attempts to read the cached parameters
+    double values[4] = { 0, 0, 0, 0 };
+    if( rank == 0 )
+    {
+        std::ifstream file( cacheFile.c_str() );
+        if( file >> values[0] >> values[1] >> values[2] )
+            values[3] = 1;
+    }
+    mpi::Broadcast( values, 4, 0, comm );
+
+    CostModel model;
+    if( values[3] != 0 )
+    {
+        model = CostModel( values[0], values[1], values[2] );
+        SetCostModel( model );
+    }
+    else
+    {
+        model = CalibrateCostModel( g );
+        if( rank == 0 )
+        {
+            std::ofstream file( cacheFile.c_str() );
+            file.precision( 16 );
+            file << model.latency << " " << model.inverseBandwidth << " " 
+                 << model.flopTime << std::endl;
+            if( !file )
+                throw std::runtime_error
+                ("Could not write cost model to " + cacheFile);
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return model;
+}
+
+} // namespace elem
@@ -16,21 +16,28 @@ std::stack<int> blocksizeStack;
 elem::Grid* defaultGrid = 0;
 elem::MpiArgs* args = 0;
 
+// State of the counter-based generator for distributed random matrices
+philox::Key randomKey = {{0U,0U}};
+unsigned randomStream = 0;
+
 // Debugging
 #ifndef RELEASE
 std::stack<std::string> callStack;
 #endif
 
 // Tuning parameters for basic routines
-int localHemvFloatBlocksize = 64;
-int localHemvDoubleBlocksize = 64;
-int localHemvComplexFloatBlocksize = 64;
-int localHemvComplexDoubleBlocksize = 64;
-
-int localSymvFloatBlocksize = 64;
-int localSymvDoubleBlocksize = 64;
-int localSymvComplexFloatBlocksize = 64;
-int localSymvComplexDoubleBlocksize = 64;
+// (the local Hemv/Symv blocksizes are the number of local rows processed at
+//  once by the fused kernel, and are chosen so that the corresponding pieces
+//  of x and z, 256 KB in all, fit within a typical L2 cache)
+int localHemvFloatBlocksize = 32768;
+int localHemvDoubleBlocksize = 16384;
+int localHemvComplexFloatBlocksize = 16384;
+int localHemvComplexDoubleBlocksize = 8192;
+
+int localSymvFloatBlocksize = 32768;
+int localSymvDoubleBlocksize = 16384;
+int localSymvComplexFloatBlocksize = 16384;
+int localSymvComplexDoubleBlocksize = 8192;
 
 int localTrr2kFloatBlocksize = 64;
 int localTrr2kDoubleBlocksize = 64;
@@ -42,10 +49,18 @@ int localTrrkDoubleBlocksize = 64;
 int localTrrkComplexFloatBlocksize = 64;
 int localTrrkComplexDoubleBlocksize = 64;
 
+// Selection between the variants of the distributed level 3 routines
+elem::CostModel costModel;
+elem::Level3Selection level3Selection = elem::LEVEL3_COST_MODEL;
+
 // Tuning parameters for advanced routines
 using namespace elem;
 HermitianTridiagApproach tridiagApproach = HERMITIAN_TRIDIAG_DEFAULT;
 GridOrder gridOrder = ROW_MAJOR;
+int tridiagBandwidth = 32;
+LUApproach luApproach = LU_BULK_SYNCHRONOUS;
+LUPanelPivoting luPanelPivoting = LU_PANEL_PARTIAL;
+QRPanelApproach qrPanelApproach = QR_PANEL_HOUSEHOLDER;
 }
 
 namespace elem {
@@ -114,6 +129,7 @@ void Initialize( int& argc, char**& argv )
     mpi::Broadcast
     ( (byte*)seed.d, 2*sizeof(unsigned), 0, mpi::COMM_WORLD );
     plcg::SeedParallelLcg( rank, size, seed );
+    SetRandomSeed( seed.d[0] );
 }
 
 void Finalize()
@@ -154,6 +170,9 @@ void Finalize()
         ::defaultGrid = 0;
         while( ! ::blocksizeStack.empty() )
             ::blocksizeStack.pop();
+
+        // Return any cached buffers to the system
+        TrimMemoryPool();
     }
 #ifndef RELEASE
     PopCallStack();
@@ -179,6 +198,19 @@ void PushBlocksizeStack( int blocksize )
 void PopBlocksizeStack()
 { ::blocksizeStack.pop(); }
 
+void SetRandomSeed( unsigned seed )
+{
+    ::randomKey[0] = seed;
+    ::randomKey[1] = 0U;
+    ::randomStream = 0;
+}
+
+philox::Key RandomKey()
+{ return ::randomKey; }
+
+unsigned NewRandomStream()
+{ return ::randomStream++; }
+
 const Grid& DefaultGrid()
 {
 #ifndef RELEASE
@@ -352,6 +384,18 @@ template<>
 int LocalTrrkBlocksize<Complex<double> >()
 { return ::localTrrkComplexDoubleBlocksize; }
 
+void SetCostModel( const CostModel& model )
+{ ::costModel = model; }
+
+const CostModel& GetCostModel()
+{ return ::costModel; }
+
+void SetLevel3Selection( Level3Selection selection )
+{ ::level3Selection = selection; }
+
+Level3Selection GetLevel3Selection()
+{ return ::level3Selection; }
+
 void SetHermitianTridiagApproach( HermitianTridiagApproach approach )
 { ::tridiagApproach = approach; }
 
@@ -364,4 +408,32 @@ void SetHermitianTridiagGridOrder( GridOrder order )
 GridOrder GetHermitianTridiagGridOrder()
 { return ::gridOrder; }
 
+void SetHermitianTridiagBandwidth( int bandwidth )
+{
+    if( bandwidth < 1 )
+        throw std::logic_error("Bandwidth must be positive");
+    ::tridiagBandwidth = bandwidth;
+}
+
+int GetHermitianTridiagBandwidth()
+{ return ::tridiagBandwidth; }
+
+void SetLUApproach( LUApproach approach )
+{ ::luApproach = approach; }
+
+LUApproach GetLUApproach()
+{ return ::luApproach; }
+
+void SetLUPanelPivoting( LUPanelPivoting pivoting )
+{ ::luPanelPivoting = pivoting; }
+
+LUPanelPivoting GetLUPanelPivoting()
+{ return ::luPanelPivoting; }
+
+void SetQRPanelApproach( QRPanelApproach approach )
+{ ::qrPanelApproach = approach; }
+
+QRPanelApproach GetQRPanelApproach()
+{ return ::qrPanelApproach; }
+
 } // namespace elem
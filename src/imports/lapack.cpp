@@ -125,6 +125,58 @@ void LAPACK(zhseqr)
   elem::dcomplex* w, elem::dcomplex* Z, const int* ldz,
   elem::dcomplex* work, const int* lwork, int* info );
 
+// Hermitian eigensolver using MRRR
+void LAPACK(ssyevr)
+( const char* jobz, const char* range, const char* uplo, const int* n,
+  float* A, const int* lda, const float* vl, const float* vu, 
+  const int* il, const int* iu, const float* abstol, int* m, 
+  float* w, float* Z, const int* ldz, int* isuppz, 
+  float* work, const int* lwork, int* iwork, const int* liwork, int* info );
+void LAPACK(dsyevr)
+( const char* jobz, const char* range, const char* uplo, const int* n,
+  double* A, const int* lda, const double* vl, const double* vu, 
+  const int* il, const int* iu, const double* abstol, int* m, 
+  double* w, double* Z, const int* ldz, int* isuppz, 
+  double* work, const int* lwork, int* iwork, const int* liwork, int* info );
+void LAPACK(cheevr)
+( const char* jobz, const char* range, const char* uplo, const int* n,
+  elem::scomplex* A, const int* lda, const float* vl, const float* vu, 
+  const int* il, const int* iu, const float* abstol, int* m, 
+  float* w, elem::scomplex* Z, const int* ldz, int* isuppz, 
+  elem::scomplex* work, const int* lwork, float* rwork, const int* lrwork, 
+  int* iwork, const int* liwork, int* info );
+void LAPACK(zheevr)
+( const char* jobz, const char* range, const char* uplo, const int* n,
+  elem::dcomplex* A, const int* lda, const double* vl, const double* vu, 
+  const int* il, const int* iu, const double* abstol, int* m, 
+  double* w, elem::dcomplex* Z, const int* ldz, int* isuppz, 
+  elem::dcomplex* work, const int* lwork, double* rwork, const int* lrwork, 
+  int* iwork, const int* liwork, int* info );
+
+// Cholesky factorization
+void LAPACK(spotrf)
+( const char* uplo, const int* n, float* A, const int* lda, int* info );
+void LAPACK(dpotrf)
+( const char* uplo, const int* n, double* A, const int* lda, int* info );
+void LAPACK(cpotrf)
+( const char* uplo, const int* n, elem::scomplex* A, const int* lda, 
+  int* info );
+void LAPACK(zpotrf)
+( const char* uplo, const int* n, elem::dcomplex* A, const int* lda, 
+  int* info );
+
+// LU factorization with partial pivoting
+void LAPACK(sgetrf)
+( const int* m, const int* n, float* A, const int* lda, int* p, int* info );
+void LAPACK(dgetrf)
+( const int* m, const int* n, double* A, const int* lda, int* p, int* info );
+void LAPACK(cgetrf)
+( const int* m, const int* n, elem::scomplex* A, const int* lda, 
+  int* p, int* info );
+void LAPACK(zgetrf)
+( const int* m, const int* n, elem::dcomplex* A, const int* lda, 
+  int* p, int* info );
+
 } // extern "C"
 
 namespace elem {
@@ -1164,5 +1216,399 @@ void HessenbergEig( int n, dcomplex* H, int ldh, dcomplex* w )
 #endif
 }
 
+//
+// Hermitian eigensolver using MRRR
+//
+
+int HermitianEig
+( char jobz, char range, char uplo, int n, float* A, int lda, 
+  float vl, float vu, int il, int iu, float abstol, 
+  float* w, float* Z, int ldz )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::HermitianEig");
+#endif
+    if( n == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return 0;
+    }
+
+    int m, info;
+    std::vector<int> isuppz( 2*n );
+    int lwork=-1, liwork=-1, dummyIWork;
+    float dummyWork;
+    LAPACK(ssyevr)
+    ( &jobz, &range, &uplo, &n, A, &lda, &vl, &vu, &il, &iu, &abstol, &m,
+      w, Z, &ldz, &isuppz[0], &dummyWork, &lwork, &dummyIWork, &liwork, 
+      &info );
+
+    lwork = dummyWork;
+    liwork = dummyIWork;
+    std::vector<float> work( lwork );
+    std::vector<int> iwork( liwork );
+    LAPACK(ssyevr)
+    ( &jobz, &range, &uplo, &n, A, &lda, &vl, &vu, &il, &iu, &abstol, &m,
+      w, Z, &ldz, &isuppz[0], &work[0], &lwork, &iwork[0], &liwork, 
+      &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+    {
+        throw std::runtime_error("ssyevr failed");
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return m;
+}
+
+int HermitianEig
+( char jobz, char range, char uplo, int n, double* A, int lda, 
+  double vl, double vu, int il, int iu, double abstol, 
+  double* w, double* Z, int ldz )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::HermitianEig");
+#endif
+    if( n == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return 0;
+    }
+
+    int m, info;
+    std::vector<int> isuppz( 2*n );
+    int lwork=-1, liwork=-1, dummyIWork;
+    double dummyWork;
+    LAPACK(dsyevr)
+    ( &jobz, &range, &uplo, &n, A, &lda, &vl, &vu, &il, &iu, &abstol, &m,
+      w, Z, &ldz, &isuppz[0], &dummyWork, &lwork, &dummyIWork, &liwork, 
+      &info );
+
+    lwork = dummyWork;
+    liwork = dummyIWork;
+    std::vector<double> work( lwork );
+    std::vector<int> iwork( liwork );
+    LAPACK(dsyevr)
+    ( &jobz, &range, &uplo, &n, A, &lda, &vl, &vu, &il, &iu, &abstol, &m,
+      w, Z, &ldz, &isuppz[0], &work[0], &lwork, &iwork[0], &liwork, 
+      &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+    {
+        throw std::runtime_error("dsyevr failed");
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return m;
+}
+
+int HermitianEig
+( char jobz, char range, char uplo, int n, scomplex* A, int lda, 
+  float vl, float vu, int il, int iu, float abstol, 
+  float* w, scomplex* Z, int ldz )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::HermitianEig");
+#endif
+    if( n == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return 0;
+    }
+
+    int m, info;
+    std::vector<int> isuppz( 2*n );
+    int lwork=-1, lrwork=-1, liwork=-1, dummyIWork;
+    float dummyRWork;
+    scomplex dummyWork;
+    LAPACK(cheevr)
+    ( &jobz, &range, &uplo, &n, A, &lda, &vl, &vu, &il, &iu, &abstol, &m,
+      w, Z, &ldz, &isuppz[0], &dummyWork, &lwork, &dummyRWork, &lrwork,
+      &dummyIWork, &liwork, &info );
+
+    lwork = dummyWork.real;
+    lrwork = dummyRWork;
+    liwork = dummyIWork;
+    std::vector<scomplex> work( lwork );
+    std::vector<float> rwork( lrwork );
+    std::vector<int> iwork( liwork );
+    LAPACK(cheevr)
+    ( &jobz, &range, &uplo, &n, A, &lda, &vl, &vu, &il, &iu, &abstol, &m,
+      w, Z, &ldz, &isuppz[0], &work[0], &lwork, &rwork[0], &lrwork,
+      &iwork[0], &liwork, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+    {
+        throw std::runtime_error("cheevr failed");
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return m;
+}
+
+int HermitianEig
+( char jobz, char range, char uplo, int n, dcomplex* A, int lda, 
+  double vl, double vu, int il, int iu, double abstol, 
+  double* w, dcomplex* Z, int ldz )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::HermitianEig");
+#endif
+    if( n == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return 0;
+    }
+
+    int m, info;
+    std::vector<int> isuppz( 2*n );
+    int lwork=-1, lrwork=-1, liwork=-1, dummyIWork;
+    double dummyRWork;
+    dcomplex dummyWork;
+    LAPACK(zheevr)
+    ( &jobz, &range, &uplo, &n, A, &lda, &vl, &vu, &il, &iu, &abstol, &m,
+      w, Z, &ldz, &isuppz[0], &dummyWork, &lwork, &dummyRWork, &lrwork,
+      &dummyIWork, &liwork, &info );
+
+    lwork = dummyWork.real;
+    lrwork = dummyRWork;
+    liwork = dummyIWork;
+    std::vector<dcomplex> work( lwork );
+    std::vector<double> rwork( lrwork );
+    std::vector<int> iwork( liwork );
+    LAPACK(zheevr)
+    ( &jobz, &range, &uplo, &n, A, &lda, &vl, &vu, &il, &iu, &abstol, &m,
+      w, Z, &ldz, &isuppz[0], &work[0], &lwork, &rwork[0], &lrwork,
+      &iwork[0], &liwork, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+    {
+        throw std::runtime_error("zheevr failed");
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return m;
+}
+
+//
+// Cholesky factorization
+//
+
+void Cholesky( char uplo, int n, float* A, int lda )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::Cholesky");
+#endif
+    int info;
+    LAPACK(spotrf)( &uplo, &n, A, &lda, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+        throw NonHPDMatrixException();
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void Cholesky( char uplo, int n, double* A, int lda )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::Cholesky");
+#endif
+    int info;
+    LAPACK(dpotrf)( &uplo, &n, A, &lda, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+        throw NonHPDMatrixException();
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void Cholesky( char uplo, int n, scomplex* A, int lda )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::Cholesky");
+#endif
+    int info;
+    LAPACK(cpotrf)( &uplo, &n, A, &lda, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+        throw NonHPDMatrixException();
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void Cholesky( char uplo, int n, dcomplex* A, int lda )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::Cholesky");
+#endif
+    int info;
+    LAPACK(zpotrf)( &uplo, &n, A, &lda, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+        throw NonHPDMatrixException();
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+//
+// LU factorization with partial pivoting
+//
+
+void LU( int m, int n, float* A, int lda, int* p )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::LU");
+#endif
+    int info;
+    LAPACK(sgetrf)( &m, &n, A, &lda, p, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+        throw SingularMatrixException();
+
+    // Convert the pivots to zero-based indices
+    const int minDim = std::min(m,n);
+    for( int j=0; j<minDim; ++j )
+        --p[j];
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void LU( int m, int n, double* A, int lda, int* p )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::LU");
+#endif
+    int info;
+    LAPACK(dgetrf)( &m, &n, A, &lda, p, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+        throw SingularMatrixException();
+
+    // Convert the pivots to zero-based indices
+    const int minDim = std::min(m,n);
+    for( int j=0; j<minDim; ++j )
+        --p[j];
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void LU( int m, int n, scomplex* A, int lda, int* p )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::LU");
+#endif
+    int info;
+    LAPACK(cgetrf)( &m, &n, A, &lda, p, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+        throw SingularMatrixException();
+
+    // Convert the pivots to zero-based indices
+    const int minDim = std::min(m,n);
+    for( int j=0; j<minDim; ++j )
+        --p[j];
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void LU( int m, int n, dcomplex* A, int lda, int* p )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::LU");
+#endif
+    int info;
+    LAPACK(zgetrf)( &m, &n, A, &lda, p, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+        throw SingularMatrixException();
+
+    // Convert the pivots to zero-based indices
+    const int minDim = std::min(m,n);
+    for( int j=0; j<minDim; ++j )
+        --p[j];
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 } // namespace lapack
 } // namespace elem
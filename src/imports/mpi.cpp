@@ -1093,6 +1093,240 @@ void SendRecv
 #endif
 }
 
+void SendInit
+( const byte* buf, int count, int to, int tag, Comm comm, 
+  Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::SendInit");
+#endif
+    SafeMpi(
+        MPI_Send_init
+        ( const_cast<byte*>(buf), count, MPI_UNSIGNED_CHAR, to, tag, comm, &request )
+    );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void SendInit
+( const int* buf, int count, int to, int tag, Comm comm, 
+  Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::SendInit");
+#endif
+    SafeMpi(
+        MPI_Send_init
+        ( const_cast<int*>(buf), count, MPI_INT, to, tag, comm, &request )
+    );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void SendInit
+( const float* buf, int count, int to, int tag, Comm comm, 
+  Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::SendInit");
+#endif
+    SafeMpi(
+        MPI_Send_init
+        ( const_cast<float*>(buf), count, MPI_FLOAT, to, tag, comm, &request )
+    );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void SendInit
+( const double* buf, int count, int to, int tag, Comm comm, 
+  Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::SendInit");
+#endif
+    SafeMpi(
+        MPI_Send_init
+        ( const_cast<double*>(buf), count, MPI_DOUBLE, to, tag, comm, &request )
+    );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void SendInit
+( const scomplex* buf, int count, int to, int tag, Comm comm, 
+  Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::SendInit");
+#endif
+#ifdef AVOID_COMPLEX_MPI
+    SafeMpi(
+        MPI_Send_init
+        ( const_cast<scomplex*>(buf), 2*count, MPI_FLOAT, to, tag, comm, &request )
+    );
+#else
+    SafeMpi(
+        MPI_Send_init
+        ( const_cast<scomplex*>(buf), count, MPI_COMPLEX, to, tag, comm, &request )
+    );
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void SendInit
+( const dcomplex* buf, int count, int to, int tag, Comm comm, 
+  Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::SendInit");
+#endif
+#ifdef AVOID_COMPLEX_MPI
+    SafeMpi(
+        MPI_Send_init
+        ( const_cast<dcomplex*>(buf), 2*count, MPI_DOUBLE, to, tag, comm, &request )
+    );
+#else
+    SafeMpi(
+        MPI_Send_init
+        ( const_cast<dcomplex*>(buf), count, MPI_DOUBLE_COMPLEX, to, tag, comm, &request )
+    );
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void RecvInit
+( byte* buf, int count, int from, int tag, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::RecvInit");
+#endif
+    SafeMpi( MPI_Recv_init( buf, count, MPI_UNSIGNED_CHAR, from, tag, comm, &request ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void RecvInit
+( int* buf, int count, int from, int tag, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::RecvInit");
+#endif
+    SafeMpi( MPI_Recv_init( buf, count, MPI_INT, from, tag, comm, &request ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void RecvInit
+( float* buf, int count, int from, int tag, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::RecvInit");
+#endif
+    SafeMpi( MPI_Recv_init( buf, count, MPI_FLOAT, from, tag, comm, &request ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void RecvInit
+( double* buf, int count, int from, int tag, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::RecvInit");
+#endif
+    SafeMpi( MPI_Recv_init( buf, count, MPI_DOUBLE, from, tag, comm, &request ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void RecvInit
+( scomplex* buf, int count, int from, int tag, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::RecvInit");
+#endif
+#ifdef AVOID_COMPLEX_MPI
+    SafeMpi(
+        MPI_Recv_init( buf, 2*count, MPI_FLOAT, from, tag, comm, &request )
+    );
+#else
+    SafeMpi(
+        MPI_Recv_init( buf, count, MPI_COMPLEX, from, tag, comm, &request )
+    );
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void RecvInit
+( dcomplex* buf, int count, int from, int tag, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::RecvInit");
+#endif
+#ifdef AVOID_COMPLEX_MPI
+    SafeMpi(
+        MPI_Recv_init( buf, 2*count, MPI_DOUBLE, from, tag, comm, &request )
+    );
+#else
+    SafeMpi(
+        MPI_Recv_init( buf, count, MPI_DOUBLE_COMPLEX, from, tag, comm, &request )
+    );
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// Activate a persistent request
+void Start( Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::Start");
+#endif
+    SafeMpi( MPI_Start( &request ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// Activate several persistent requests
+void StartAll( int numRequests, Request* requests )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::StartAll");
+#endif
+    SafeMpi( MPI_Startall( numRequests, requests ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// Deallocate a (typically persistent) request
+void RequestFree( Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::RequestFree");
+#endif
+    SafeMpi( MPI_Request_free( &request ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 void Broadcast( byte* buf, int count, int root, Comm comm )
 {
 #ifndef RELEASE
@@ -1404,7 +1638,7 @@ void IGather
 #endif
 }
 
-void Igather
+void IGather
 ( const float* sbuf, int sc,
         float* rbuf, int rc, int root, Comm comm, Request& request )
 {
@@ -1844,6 +2078,126 @@ void AllGather
 #endif
 }
 
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+void IAllGather
+( const byte* sbuf, int sc,
+        byte* rbuf, int rc, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IAllGather");
+#endif
+    SafeMpi(
+        MPI_Iallgather
+        ( const_cast<byte*>(sbuf), sc, MPI_UNSIGNED_CHAR,
+          rbuf,                    rc, MPI_UNSIGNED_CHAR, comm, &request )
+    );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void IAllGather
+( const int* sbuf, int sc,
+        int* rbuf, int rc, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IAllGather");
+#endif
+    SafeMpi(
+        MPI_Iallgather
+        ( const_cast<int*>(sbuf), sc, MPI_INT,
+          rbuf,                   rc, MPI_INT, comm, &request )
+    );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void IAllGather
+( const float* sbuf, int sc,
+        float* rbuf, int rc, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IAllGather");
+#endif
+    SafeMpi(
+        MPI_Iallgather
+        ( const_cast<float*>(sbuf), sc, MPI_FLOAT,
+          rbuf,                     rc, MPI_FLOAT, comm, &request )
+    );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void IAllGather
+( const double* sbuf, int sc,
+        double* rbuf, int rc, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IAllGather");
+#endif
+    SafeMpi(
+        MPI_Iallgather
+        ( const_cast<double*>(sbuf), sc, MPI_DOUBLE,
+          rbuf,                      rc, MPI_DOUBLE, comm, &request )
+    );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void IAllGather
+( const scomplex* sbuf, int sc,
+        scomplex* rbuf, int rc, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IAllGather");
+#endif
+#ifdef AVOID_COMPLEX_MPI
+    SafeMpi(
+        MPI_Iallgather
+        ( const_cast<scomplex*>(sbuf), 2*sc, MPI_FLOAT,
+          rbuf,                        2*rc, MPI_FLOAT, comm, &request )
+    );
+#else
+    SafeMpi(
+        MPI_Iallgather
+        ( const_cast<scomplex*>(sbuf), sc, MPI_COMPLEX,
+          rbuf,                        rc, MPI_COMPLEX, comm, &request )
+    );
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void IAllGather
+( const dcomplex* sbuf, int sc,
+        dcomplex* rbuf, int rc, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IAllGather");
+#endif
+#ifdef AVOID_COMPLEX_MPI
+    SafeMpi(
+        MPI_Iallgather
+        ( const_cast<dcomplex*>(sbuf), 2*sc, MPI_DOUBLE,
+          rbuf,                        2*rc, MPI_DOUBLE, comm, &request )
+    );
+#else
+    SafeMpi(
+        MPI_Iallgather
+        ( const_cast<dcomplex*>(sbuf), sc, MPI_DOUBLE_COMPLEX,
+          rbuf,                        rc, MPI_DOUBLE_COMPLEX, comm, &request )
+    );
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+#endif // ifdef HAVE_NONBLOCKING_COLLECTIVES
+
 void AllGather
 ( const byte* sbuf, int sc,
         byte* rbuf, const int* rcs, const int* rds, Comm comm )
@@ -2481,98 +2835,217 @@ void Scatter( dcomplex* buf, int sc, int rc, int root, Comm comm )
               buf, rc, MPI_DOUBLE_COMPLEX, root, comm )
         );
 #endif
-    }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void AllToAll
+( const byte* sbuf, int sc,
+        byte* rbuf, int rc, Comm comm )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::AllToAll");
+#endif
+    SafeMpi( 
+        MPI_Alltoall
+        ( const_cast<byte*>(sbuf), sc, MPI_UNSIGNED_CHAR,
+          rbuf,                    rc, MPI_UNSIGNED_CHAR, comm ) 
+    );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void AllToAll
+( const int* sbuf, int sc,
+        int* rbuf, int rc, Comm comm )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::AllToAll");
+#endif
+    SafeMpi( 
+        MPI_Alltoall
+        ( const_cast<int*>(sbuf), sc, MPI_INT,
+          rbuf,                   rc, MPI_INT, comm ) 
+    );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void AllToAll
+( const float* sbuf, int sc,
+        float* rbuf, int rc, Comm comm )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::AllToAll");
+#endif
+    SafeMpi( 
+        MPI_Alltoall
+        ( const_cast<float*>(sbuf), sc, MPI_FLOAT,
+          rbuf,                     rc, MPI_FLOAT, comm ) 
+    );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void AllToAll
+( const double* sbuf, int sc,
+        double* rbuf, int rc, Comm comm )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::AllToAll");
+#endif
+    SafeMpi( 
+        MPI_Alltoall
+        ( const_cast<double*>(sbuf), sc, MPI_DOUBLE,
+          rbuf,                      rc, MPI_DOUBLE, comm ) 
+    );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void AllToAll
+( const scomplex* sbuf, int sc,
+        scomplex* rbuf, int rc, Comm comm )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::AllToAll");
+#endif
+#ifdef AVOID_COMPLEX_MPI
+    SafeMpi(
+        MPI_Alltoall
+        ( const_cast<scomplex*>(sbuf), 2*sc, MPI_FLOAT,
+          rbuf,                        2*rc, MPI_FLOAT, comm )
+    );
+#else
+    SafeMpi( 
+        MPI_Alltoall
+        ( const_cast<scomplex*>(sbuf), sc, MPI_COMPLEX,
+          rbuf,                        rc, MPI_COMPLEX, comm ) 
+    );
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void AllToAll
+( const dcomplex* sbuf, int sc,
+        dcomplex* rbuf, int rc, Comm comm )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::AllToAll");
+#endif
+#ifdef AVOID_COMPLEX_MPI
+    SafeMpi(
+        MPI_Alltoall
+        ( const_cast<dcomplex*>(sbuf), 2*sc, MPI_DOUBLE,
+          rbuf,                        2*rc, MPI_DOUBLE, comm )
+    );
+#else
+    SafeMpi( 
+        MPI_Alltoall
+        ( const_cast<dcomplex*>(sbuf), sc, MPI_DOUBLE_COMPLEX,
+          rbuf,                        rc, MPI_DOUBLE_COMPLEX, comm ) 
+    );
+#endif
 #ifndef RELEASE
     PopCallStack();
 #endif
 }
 
-void AllToAll
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+void IAllToAll
 ( const byte* sbuf, int sc,
-        byte* rbuf, int rc, Comm comm )
+        byte* rbuf, int rc, Comm comm, Request& request )
 {
 #ifndef RELEASE
-    PushCallStack("mpi::AllToAll");
+    PushCallStack("mpi::IAllToAll");
 #endif
-    SafeMpi( 
-        MPI_Alltoall
+    SafeMpi(
+        MPI_Ialltoall
         ( const_cast<byte*>(sbuf), sc, MPI_UNSIGNED_CHAR,
-          rbuf,                    rc, MPI_UNSIGNED_CHAR, comm ) 
+          rbuf,                    rc, MPI_UNSIGNED_CHAR, comm, &request )
     );
 #ifndef RELEASE
     PopCallStack();
 #endif
 }
 
-void AllToAll
+void IAllToAll
 ( const int* sbuf, int sc,
-        int* rbuf, int rc, Comm comm )
+        int* rbuf, int rc, Comm comm, Request& request )
 {
 #ifndef RELEASE
-    PushCallStack("mpi::AllToAll");
+    PushCallStack("mpi::IAllToAll");
 #endif
-    SafeMpi( 
-        MPI_Alltoall
+    SafeMpi(
+        MPI_Ialltoall
         ( const_cast<int*>(sbuf), sc, MPI_INT,
-          rbuf,                   rc, MPI_INT, comm ) 
+          rbuf,                   rc, MPI_INT, comm, &request )
     );
 #ifndef RELEASE
     PopCallStack();
 #endif
 }
 
-void AllToAll
+void IAllToAll
 ( const float* sbuf, int sc,
-        float* rbuf, int rc, Comm comm )
+        float* rbuf, int rc, Comm comm, Request& request )
 {
 #ifndef RELEASE
-    PushCallStack("mpi::AllToAll");
+    PushCallStack("mpi::IAllToAll");
 #endif
-    SafeMpi( 
-        MPI_Alltoall
+    SafeMpi(
+        MPI_Ialltoall
         ( const_cast<float*>(sbuf), sc, MPI_FLOAT,
-          rbuf,                     rc, MPI_FLOAT, comm ) 
+          rbuf,                     rc, MPI_FLOAT, comm, &request )
     );
 #ifndef RELEASE
     PopCallStack();
 #endif
 }
 
-void AllToAll
+void IAllToAll
 ( const double* sbuf, int sc,
-        double* rbuf, int rc, Comm comm )
+        double* rbuf, int rc, Comm comm, Request& request )
 {
 #ifndef RELEASE
-    PushCallStack("mpi::AllToAll");
+    PushCallStack("mpi::IAllToAll");
 #endif
-    SafeMpi( 
-        MPI_Alltoall
+    SafeMpi(
+        MPI_Ialltoall
         ( const_cast<double*>(sbuf), sc, MPI_DOUBLE,
-          rbuf,                      rc, MPI_DOUBLE, comm ) 
+          rbuf,                      rc, MPI_DOUBLE, comm, &request )
     );
 #ifndef RELEASE
     PopCallStack();
 #endif
 }
 
-void AllToAll
+void IAllToAll
 ( const scomplex* sbuf, int sc,
-        scomplex* rbuf, int rc, Comm comm )
+        scomplex* rbuf, int rc, Comm comm, Request& request )
 {
 #ifndef RELEASE
-    PushCallStack("mpi::AllToAll");
+    PushCallStack("mpi::IAllToAll");
 #endif
 #ifdef AVOID_COMPLEX_MPI
     SafeMpi(
-        MPI_Alltoall
+        MPI_Ialltoall
         ( const_cast<scomplex*>(sbuf), 2*sc, MPI_FLOAT,
-          rbuf,                        2*rc, MPI_FLOAT, comm )
+          rbuf,                        2*rc, MPI_FLOAT, comm, &request )
     );
 #else
-    SafeMpi( 
-        MPI_Alltoall
+    SafeMpi(
+        MPI_Ialltoall
         ( const_cast<scomplex*>(sbuf), sc, MPI_COMPLEX,
-          rbuf,                        rc, MPI_COMPLEX, comm ) 
+          rbuf,                        rc, MPI_COMPLEX, comm, &request )
     );
 #endif
 #ifndef RELEASE
@@ -2580,30 +3053,31 @@ void AllToAll
 #endif
 }
 
-void AllToAll
+void IAllToAll
 ( const dcomplex* sbuf, int sc,
-        dcomplex* rbuf, int rc, Comm comm )
+        dcomplex* rbuf, int rc, Comm comm, Request& request )
 {
 #ifndef RELEASE
-    PushCallStack("mpi::AllToAll");
+    PushCallStack("mpi::IAllToAll");
 #endif
 #ifdef AVOID_COMPLEX_MPI
     SafeMpi(
-        MPI_Alltoall
+        MPI_Ialltoall
         ( const_cast<dcomplex*>(sbuf), 2*sc, MPI_DOUBLE,
-          rbuf,                        2*rc, MPI_DOUBLE, comm )
+          rbuf,                        2*rc, MPI_DOUBLE, comm, &request )
     );
 #else
-    SafeMpi( 
-        MPI_Alltoall
+    SafeMpi(
+        MPI_Ialltoall
         ( const_cast<dcomplex*>(sbuf), sc, MPI_DOUBLE_COMPLEX,
-          rbuf,                        rc, MPI_DOUBLE_COMPLEX, comm ) 
+          rbuf,                        rc, MPI_DOUBLE_COMPLEX, comm, &request )
     );
 #endif
 #ifndef RELEASE
     PopCallStack();
 #endif
 }
+#endif // ifdef HAVE_NONBLOCKING_COLLECTIVES
 
 void AllToAll
 ( const byte* sbuf, const int* scs, const int* sds, 
@@ -3776,6 +4250,112 @@ void ReduceScatter( dcomplex* sbuf, dcomplex* rbuf, int rc, Op op, Comm comm )
 #endif
 }
 
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+void IReduceScatter
+( byte* sbuf, byte* rbuf, int rc, Op op, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IReduceScatter");
+#endif
+    SafeMpi(
+        MPI_Ireduce_scatter_block
+        ( sbuf, rbuf, rc, MPI_UNSIGNED_CHAR, op, comm, &request )
+    );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void IReduceScatter
+( int* sbuf, int* rbuf, int rc, Op op, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IReduceScatter");
+#endif
+    SafeMpi(
+        MPI_Ireduce_scatter_block
+        ( sbuf, rbuf, rc, MPI_INT, op, comm, &request )
+    );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void IReduceScatter
+( float* sbuf, float* rbuf, int rc, Op op, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IReduceScatter");
+#endif
+    SafeMpi(
+        MPI_Ireduce_scatter_block
+        ( sbuf, rbuf, rc, MPI_FLOAT, op, comm, &request )
+    );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void IReduceScatter
+( double* sbuf, double* rbuf, int rc, Op op, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IReduceScatter");
+#endif
+    SafeMpi(
+        MPI_Ireduce_scatter_block
+        ( sbuf, rbuf, rc, MPI_DOUBLE, op, comm, &request )
+    );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void IReduceScatter
+( scomplex* sbuf, scomplex* rbuf, int rc, Op op, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IReduceScatter");
+#endif
+#ifdef AVOID_COMPLEX_MPI
+    SafeMpi(
+        MPI_Ireduce_scatter_block
+        ( sbuf, rbuf, 2*rc, MPI_FLOAT, op, comm, &request )
+    );
+#else
+    SafeMpi(
+        MPI_Ireduce_scatter_block
+        ( sbuf, rbuf, rc, MPI_COMPLEX, op, comm, &request )
+    );
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void IReduceScatter
+( dcomplex* sbuf, dcomplex* rbuf, int rc, Op op, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IReduceScatter");
+#endif
+#ifdef AVOID_COMPLEX_MPI
+    SafeMpi(
+        MPI_Ireduce_scatter_block
+        ( sbuf, rbuf, 2*rc, MPI_DOUBLE, op, comm, &request )
+    );
+#else
+    SafeMpi(
+        MPI_Ireduce_scatter_block
+        ( sbuf, rbuf, rc, MPI_DOUBLE_COMPLEX, op, comm, &request )
+    );
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+#endif // ifdef HAVE_NONBLOCKING_COLLECTIVES
+
 void ReduceScatter( byte* buf, int rc, Op op, Comm comm )
 {
 #ifndef RELEASE
@@ -4161,5 +4741,213 @@ void ReduceScatter
 #endif
 }
 
+//-------------------//
+// Derived datatypes //
+//-------------------//
+
+void TypeContiguous( int count, Datatype oldType, Datatype& newType )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::TypeContiguous");
+#endif
+    SafeMpi( MPI_Type_contiguous( count, oldType, &newType ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void TypeVector
+( int count, int blocklength, int stride, Datatype oldType, 
+  Datatype& newType )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::TypeVector");
+#endif
+    SafeMpi
+    ( MPI_Type_vector( count, blocklength, stride, oldType, &newType ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void TypeHVector
+( int count, int blocklength, Aint stride, Datatype oldType, 
+  Datatype& newType )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::TypeHVector");
+#endif
+    SafeMpi
+    ( MPI_Type_create_hvector
+      ( count, blocklength, stride, oldType, &newType ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void TypeCommit( Datatype& type )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::TypeCommit");
+#endif
+    SafeMpi( MPI_Type_commit( &type ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void TypeFree( Datatype& type )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::TypeFree");
+#endif
+    SafeMpi( MPI_Type_free( &type ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+//-------------------//
+// Parallel file I/O //
+//-------------------//
+
+void FileOpen( Comm comm, const std::string filename, int amode, File& fh )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileOpen");
+#endif
+    const int error = 
+        MPI_File_open
+        ( comm, const_cast<char*>(filename.c_str()), amode, MPI_INFO_NULL, 
+          &fh );
+    if( error != MPI_SUCCESS )
+    {
+        std::ostringstream msg;
+        msg << "Could not open " << filename;
+        throw std::runtime_error( msg.str() );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void FileClose( File& fh )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileClose");
+#endif
+    SafeMpi( MPI_File_close( &fh ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void FileSetSize( File fh, Offset size )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileSetSize");
+#endif
+    SafeMpi( MPI_File_set_size( fh, size ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void FileSetView( File fh, Offset disp, Datatype etype, Datatype filetype )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileSetView");
+#endif
+    SafeMpi
+    ( MPI_File_set_view
+      ( fh, disp, etype, filetype, const_cast<char*>("native"), 
+        MPI_INFO_NULL ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void FileWriteAt( File fh, Offset offset, const byte* buf, int count )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileWriteAt");
+#endif
+    Status status;
+    SafeMpi
+    ( MPI_File_write_at
+      ( fh, offset, const_cast<byte*>(buf), count, MPI_BYTE, &status ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void FileReadAt( File fh, Offset offset, byte* buf, int count )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileReadAt");
+#endif
+    Status status;
+    SafeMpi
+    ( MPI_File_read_at( fh, offset, buf, count, MPI_BYTE, &status ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void FileWriteAll( File fh, const byte* buf, int count, Datatype type )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileWriteAll");
+#endif
+    Status status;
+    SafeMpi
+    ( MPI_File_write_all
+      ( fh, const_cast<byte*>(buf), count, type, &status ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void FileReadAll( File fh, byte* buf, int count, Datatype type )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileReadAll");
+#endif
+    Status status;
+    SafeMpi( MPI_File_read_all( fh, buf, count, type, &status ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void FileIWriteAt
+( File fh, Offset offset, const byte* buf, int count, Datatype type, 
+  Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileIWriteAt");
+#endif
+    SafeMpi
+    ( MPI_File_iwrite_at
+      ( fh, offset, const_cast<byte*>(buf), count, type, &request ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void FileIReadAt
+( File fh, Offset offset, byte* buf, int count, Datatype type, 
+  Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileIReadAt");
+#endif
+    SafeMpi
+    ( MPI_File_iread_at( fh, offset, buf, count, type, &request ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 } // namespace mpi
 } // namespace elem
@@ -0,0 +1,200 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "elemental.hpp"
+#include <map>
+
+namespace {
+
+bool poolMemory = true;
+elem::MemoryPoolStatistics poolStats = { 0, 0, 0, 0, 0, 0 };
+
+// Cached buffers, keyed by their (rounded) size in bytes. This is allocated
+// on first use and never destroyed so that Memory objects with static 
+// storage duration may safely be destroyed after this translation unit.
+typedef std::map<std::size_t,std::vector<void*> > FreeLists;
+FreeLists* freeLists = 0;
+
+FreeLists& GetFreeLists()
+{
+    if( freeLists == 0 )
+        freeLists = new FreeLists;
+    return *freeLists;
+}
+
+// Over-allocate by the alignment and store the offset to the original 
+// address in the byte immediately preceding the returned pointer
+void* AlignedAllocate( std::size_t numBytes )
+{
+    const std::size_t alignment = elem::MEMORY_ALIGNMENT;
+    char* raw = static_cast<char*>(std::malloc( numBytes+alignment ));
+    if( raw == 0 )
+        throw std::bad_alloc();
+    const std::size_t address = reinterpret_cast<std::size_t>(raw);
+    const std::size_t offset = alignment - (address % alignment);
+    char* aligned = raw + offset;
+    aligned[-1] = static_cast<char>(offset-1);
+    return aligned;
+}
+
+void AlignedFree( void* ptr )
+{
+    char* aligned = static_cast<char*>(ptr);
+    const std::size_t offset = 
+        static_cast<std::size_t>(static_cast<unsigned char>(aligned[-1]))+1;
+    std::free( aligned-offset );
+}
+
+void UpdatePeaks()
+{
+    poolStats.peakBytesInUse = 
+        std::max( poolStats.peakBytesInUse, poolStats.bytesInUse );
+    poolStats.peakBytesHeld = 
+        std::max
+        ( poolStats.peakBytesHeld, poolStats.bytesInUse+poolStats.bytesCached );
+}
+
+void Trim()
+{
+    FreeLists& lists = GetFreeLists();
+    FreeLists::iterator it;
+    for( it=lists.begin(); it!=lists.end(); ++it )
+    {
+        std::vector<void*>& list = it->second;
+        for( std::size_t k=0; k<list.size(); ++k )
+            AlignedFree( list[k] );
+        poolStats.bytesCached -= list.size()*it->first;
+    }
+    lists.clear();
+}
+
+} // anonymous namespace
+
+namespace elem {
+
+void SetMemoryPooling( bool pool )
+{
+#ifdef HAVE_OPENMP
+    #pragma omp critical( elem_memory_pool )
+#endif
+    {
+        ::poolMemory = pool;
+        if( !pool )
+            ::Trim();
+    }
+}
+
+bool MemoryPooling()
+{ return ::poolMemory; }
+
+void TrimMemoryPool()
+{
+#ifdef HAVE_OPENMP
+    #pragma omp critical( elem_memory_pool )
+#endif
+    ::Trim();
+}
+
+MemoryPoolStatistics GetMemoryPoolStatistics()
+{
+    MemoryPoolStatistics stats;
+#ifdef HAVE_OPENMP
+    #pragma omp critical( elem_memory_pool )
+#endif
+    stats = ::poolStats;
+    return stats;
+}
+
+void ResetMemoryPoolStatistics()
+{
+#ifdef HAVE_OPENMP
+    #pragma omp critical( elem_memory_pool )
+#endif
+    {
+        ::poolStats.numAllocations = 0;
+        ::poolStats.numReuses = 0;
+        ::poolStats.peakBytesInUse = ::poolStats.bytesInUse;
+        ::poolStats.peakBytesHeld = 
+            ::poolStats.bytesInUse + ::poolStats.bytesCached;
+    }
+}
+
+namespace internal {
+
+// Requests of up to 256 bytes are rounded up to a multiple of the alignment,
+// and larger requests are rounded up to a multiple of a quarter of the 
+// largest power of two below them, so that no more than 25% is wasted.
+std::size_t PooledSize( std::size_t numBytes )
+{
+    const std::size_t alignment = MEMORY_ALIGNMENT;
+    if( numBytes <= 4*alignment )
+        return std::max(alignment,((numBytes+alignment-1)/alignment)*alignment);
+
+    std::size_t power = 4*alignment;
+    while( 2*power < numBytes )
+        power *= 2;
+    const std::size_t step = power / 4;
+    return ((numBytes+step-1)/step)*step;
+}
+
+void* PooledAllocate( std::size_t numBytes )
+{
+    if( numBytes == 0 )
+        return 0;
+    const std::size_t pooledSize = PooledSize( numBytes );
+    void* ptr = 0;
+#ifdef HAVE_OPENMP
+    #pragma omp critical( elem_memory_pool )
+#endif
+    {
+        if( ::poolMemory )
+        {
+            ::FreeLists& lists = ::GetFreeLists();
+            ::FreeLists::iterator it = lists.find( pooledSize );
+            if( it != lists.end() && !it->second.empty() )
+            {
+                ptr = it->second.back();
+                it->second.pop_back();
+                ::poolStats.bytesCached -= pooledSize;
+                ++::poolStats.numReuses;
+            }
+        }
+        if( ptr == 0 )
+        {
+            ptr = ::AlignedAllocate( pooledSize );
+            ++::poolStats.numAllocations;
+        }
+        ::poolStats.bytesInUse += pooledSize;
+        ::UpdatePeaks();
+    }
+    return ptr;
+}
+
+void PooledFree( void* ptr, std::size_t numBytes )
+{
+    if( ptr == 0 )
+        return;
+    const std::size_t pooledSize = PooledSize( numBytes );
+#ifdef HAVE_OPENMP
+    #pragma omp critical( elem_memory_pool )
+#endif
+    {
+        ::poolStats.bytesInUse -= pooledSize;
+        if( ::poolMemory )
+        {
+            ::GetFreeLists()[pooledSize].push_back( ptr );
+            ::poolStats.bytesCached += pooledSize;
+        }
+        else
+            ::AlignedFree( ptr );
+    }
+}
+
+} // namespace internal
+
+} // namespace elem
@@ -178,6 +178,35 @@ void TestGemm
             C.Print( msg.str() );
         }
     }
+
+    // Test the variant chosen by the Gemm front-end
+    if( g.Rank() == 0 )
+    {
+        cout << endl << "Automatically chosen algorithm ("
+             << ( GetLevel3Selection()==LEVEL3_COST_MODEL ? 
+                  "cost model" : "heuristic" ) << "):" << endl;
+    }
+    MakeUniform( A );
+    MakeUniform( B );
+    MakeUniform( C );
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting Gemm...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    Gemm( orientA, orientB, alpha, A, B, beta, C );
+    mpi::Barrier( g.Comm() );
+    runTime = mpi::Time() - startTime;
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = ( IsComplex<T>::val ? 4*realGFlops : realGFlops );
+    if( g.Rank() == 0 )
+    {
+        cout << "DONE. " << endl
+             << "  Time = " << runTime << " seconds. GFlops = " 
+             << gFlops << endl;
+    }
 }
 
 int 
@@ -198,6 +227,10 @@ main( int argc, char* argv[] )
         const int k = Input("--k","inner dimension",100);
         const int nb = Input("--nb","algorithmic blocksize",96);
         const bool print = Input("--print","print matrices?",false);
+        const bool costModel = Input
+            ("--costModel","choose the variant with a cost model?",true);
+        const std::string cacheFile = Input
+            ("--cacheFile","file caching the cost model",std::string(""));
         ProcessInput();
         PrintInputReport();
 
@@ -208,6 +241,20 @@ main( int argc, char* argv[] )
         const Orientation orientA = CharToOrientation( transA );
         const Orientation orientB = CharToOrientation( transB );
         SetBlocksize( nb );
+        if( costModel )
+        {
+            SetLevel3Selection( LEVEL3_COST_MODEL );
+            const CostModel model = 
+                ( cacheFile == "" ? CalibrateCostModel( g ) 
+                                  : CalibrateCostModel( g, cacheFile ) );
+            if( commRank == 0 )
+                cout << "Cost model: latency = " << model.latency 
+                     << " s, inverse bandwidth = " << model.inverseBandwidth
+                     << " s/byte, flop time = " << model.flopTime << " s" 
+                     << endl;
+        }
+        else
+            SetLevel3Selection( LEVEL3_HEURISTIC );
 
 #ifndef RELEASE
         if( commRank == 0 )
@@ -0,0 +1,179 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "elemental.hpp"
+using namespace std;
+using namespace elem;
+
+// Give every layer of the grid the copy of A held by the front layer
+template<typename T>
+void Replicate( DistMatrix<T>& A, const Grid3D& g )
+{
+    const int localSize = A.LocalLDim()*A.LocalWidth();
+    if( localSize != 0 )
+        mpi::Broadcast( A.LocalBuffer(), localSize, 0, g.DepthComm() );
+}
+
+template<typename T> 
+void TestGemm25D
+( bool print, Orientation orientA, Orientation orientB,
+  int m, int n, int k, T alpha, T beta, const Grid3D& g )
+{
+    typedef typename Base<T>::type R;
+    DistMatrix<T> A(g), B(g), C(g), CRef(g);
+
+    if( orientA == NORMAL )
+        Uniform( m, k, A );
+    else
+        Uniform( k, m, A );
+    if( orientB == NORMAL )
+        Uniform( k, n, B );
+    else
+        Uniform( n, k, B );
+    Uniform( m, n, C );
+    Replicate( A, g );
+    Replicate( B, g );
+    Replicate( C, g );
+    CRef = C;
+    if( print )
+    {
+        A.Print("A");
+        B.Print("B");
+        C.Print("C");
+    }
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting 2D Gemm within each layer...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    internal::Gemm2D( orientA, orientB, alpha, A, B, beta, CRef );
+    mpi::Barrier( g.Comm() );
+    double runTime = mpi::Time() - startTime;
+    double realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    double gFlops = ( IsComplex<T>::val ? 4*realGFlops : realGFlops );
+    if( g.Rank() == 0 )
+    {
+        cout << "DONE. " << endl
+             << "  Time = " << runTime << " seconds. GFlops = " 
+             << gFlops << endl;
+    }
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting 2.5D Gemm...";
+        cout.flush();
+    }
+    mpi::Barrier( mpi::COMM_WORLD );
+    startTime = mpi::Time();
+    Gemm25D( orientA, orientB, alpha, A, B, beta, C );
+    mpi::Barrier( mpi::COMM_WORLD );
+    runTime = mpi::Time() - startTime;
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = ( IsComplex<T>::val ? 4*realGFlops : realGFlops );
+    if( g.Rank() == 0 )
+    {
+        cout << "DONE. " << endl
+             << "  Time = " << runTime << " seconds. GFlops = " 
+             << gFlops << endl;
+    }
+    if( print )
+    {
+        ostringstream msg;
+        msg << "C := " << alpha << " A B + " << beta << " C";
+        C.Print( msg.str() );
+    }
+
+    // Compare against the result of the 2D algorithm on every layer
+    const R frobNormOfRef = Norm( CRef, FROBENIUS_NORM );
+    Axpy( T(-1), CRef, C );
+    const R frobNormOfError = Norm( C, FROBENIUS_NORM );
+    R maxError = frobNormOfError;
+    mpi::AllReduce( &maxError, 1, mpi::MAX, mpi::COMM_WORLD );
+    if( mpi::CommRank( mpi::COMM_WORLD ) == 0 )
+    {
+        cout << "  ||C_2D||_F                          = " 
+             << frobNormOfRef << "\n"
+             << "  max over layers ||C_2.5D - C_2D||_F = " << maxError
+             << endl;
+    }
+}
+
+int 
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const int depth = Input("--depth","number of layers of the grid",2);
+        const char transA = Input("--transA","orientation of A: N/T/C",'N');
+        const char transB = Input("--transB","orientation of B: N/T/C",'N');
+        const int m = Input("--m","height of result",100);
+        const int n = Input("--n","width of result",100);
+        const int k = Input("--k","inner dimension",100);
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid3D g( comm, depth );
+        const Orientation orientA = CharToOrientation( transA );
+        const Orientation orientB = CharToOrientation( transB );
+        SetBlocksize( nb );
+
+#ifndef RELEASE
+        if( commRank == 0 )
+        {
+            cout << "==========================================\n"
+                 << " In debug mode! Performance will be poor! \n"
+                 << "==========================================" << endl;
+        }
+#endif
+        if( commRank == 0 )
+            cout << "Will test Gemm25D" << transA << transB << " on " 
+                 << depth << " layers of " << g.Height() << " x " 
+                 << g.Width() << " grids" << endl;
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestGemm25D<double>
+        ( print, orientA, orientB, m, n, k, (double)3, (double)4, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestGemm25D<Complex<double> >
+        ( print, orientA, orientB, m, n, k, 
+          Complex<double>(3), Complex<double>(4), g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
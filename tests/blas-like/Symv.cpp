@@ -69,9 +69,10 @@ main( int argc, char* argv[] )
         const int m = Input("--m","height of matrix",100);
         const int nb = Input("--nb","algorithmic blocksize",96);
         const int nbLocalDouble = Input
-            ("--nbLocalDouble","local blocksize for real doubles",32);
+            ("--nbLocalDouble","local blocksize for real doubles",16384);
         const int nbLocalComplexDouble = Input
-            ("--nbLocalComplexDouble","local blocksize for complex doubles",32);
+            ("--nbLocalComplexDouble","local blocksize for complex doubles",
+             8192);
         const bool print = Input("--print","print matrices?",false);
         ProcessInput();
         PrintInputReport();
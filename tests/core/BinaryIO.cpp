@@ -0,0 +1,203 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <cstdio>
+#include <ctime>
+#include "elemental.hpp"
+using namespace elem;
+
+template<typename T,Distribution U,Distribution V>
+void
+Check
+( const DistMatrix<T,U,V>& B, const DistMatrix<T,STAR,STAR>& A_STAR_STAR,
+  std::string description )
+{
+#ifndef RELEASE
+    PushCallStack("Check");
+#endif
+    const Grid& g = B.Grid();
+    if( g.Rank() == 0 )
+    {
+        std::cout << "Testing " << description << "...";
+        std::cout.flush();
+    }
+    DistMatrix<T,STAR,STAR> B_STAR_STAR( B );
+    int myErrorFlag = 0;
+    if( B.Height() != A_STAR_STAR.Height() ||
+        B.Width() != A_STAR_STAR.Width() )
+        myErrorFlag = 1;
+    else
+        for( int j=0; j<B.Width(); ++j )
+            for( int i=0; i<B.Height(); ++i )
+                if( B_STAR_STAR.GetLocal(i,j) != A_STAR_STAR.GetLocal(i,j) )
+                    myErrorFlag = 1;
+    int summedErrorFlag;
+    mpi::AllReduce( &myErrorFlag, &summedErrorFlag, 1, mpi::SUM, g.Comm() );
+    if( summedErrorFlag == 0 )
+    {
+        if( g.Rank() == 0 )
+            std::cout << "PASSED" << std::endl;
+    }
+    else
+        throw std::logic_error("Binary I/O test failed");
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T>
+void
+BinaryIOTest( int m, int n, std::string filename, const Grid& g )
+{
+    const int commRank = g.Rank();
+    const int r = g.Height();
+    const int c = g.Width();
+    DistMatrix<T> A( g );
+    Uniform( m, n, A );
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+
+    // Write from [MC,MR] and time it
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    WriteBinary( A, filename );
+    mpi::Barrier( g.Comm() );
+    const double writeTime = mpi::Time() - startTime;
+
+    // Read into various distributions
+    DistMatrix<T> B( 0, 0, true, true, 1 % r, 1 % c, g );
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    ReadBinary( B, filename );
+    mpi::Barrier( g.Comm() );
+    const double readTime = mpi::Time() - startTime;
+    if( commRank == 0 )
+    {
+        const double gigabytes = double(m)*n*sizeof(T)/1.e9;
+        std::cout << "Wrote " << gigabytes/writeTime << " GB/s and read "
+                  << gigabytes/readTime << " GB/s" << std::endl;
+    }
+    Check( B, A_STAR_STAR, "[MC,MR] -> misaligned [MC,MR]" );
+
+    DistMatrix<T,VC,STAR> B_VC_STAR( g );
+    ReadBinary( B_VC_STAR, filename );
+    Check( B_VC_STAR, A_STAR_STAR, "[MC,MR] -> [VC,* ]" );
+
+    DistMatrix<T,STAR,VR> B_STAR_VR( g );
+    ReadBinary( B_STAR_VR, filename );
+    Check( B_STAR_VR, A_STAR_STAR, "[MC,MR] -> [* ,VR]" );
+
+    DistMatrix<T,MC,STAR> B_MC_STAR( g );
+    ReadBinary( B_MC_STAR, filename );
+    Check( B_MC_STAR, A_STAR_STAR, "[MC,MR] -> [MC,* ]" );
+
+    DistMatrix<T,STAR,STAR> B_STAR_STAR( g );
+    ReadBinary( B_STAR_STAR, filename );
+    Check( B_STAR_STAR, A_STAR_STAR, "[MC,MR] -> [* ,* ]" );
+
+    if( commRank == 0 )
+    {
+        std::cout << "Testing [MC,MR] -> MappedMatrix...";
+        std::cout.flush();
+        MappedMatrix<T> mappedA( filename );
+        const Matrix<T>& ALoc = mappedA.LockedMatrix();
+        if( ALoc.Height() != m || ALoc.Width() != n )
+            throw std::logic_error("Mapped matrix had the wrong size");
+        for( int j=0; j<n; ++j )
+            for( int i=0; i<m; ++i )
+                if( ALoc.Get(i,j) != A_STAR_STAR.GetLocal(i,j) )
+                    throw std::logic_error("Mapped matrix was incorrect");
+        std::cout << "PASSED" << std::endl;
+    }
+    mpi::Barrier( g.Comm() );
+
+    // Write from views (with nonzero alignments and leading dimensions which
+    // differ from the local heights) and from redundant distributions
+    if( m > 2 && n > 2 )
+    {
+        DistMatrix<T> AView( g );
+        View( AView, A, 1, 1, m-2, n-2 );
+        DistMatrix<T,STAR,STAR> AView_STAR_STAR( AView );
+        WriteBinary( AView, filename );
+        ReadBinary( B, filename );
+        Check( B, AView_STAR_STAR, "[MC,MR] view -> [MC,MR]" );
+    }
+
+    B_VC_STAR = A;
+    WriteBinary( B_VC_STAR, filename );
+    ReadBinary( B, filename );
+    Check( B, A_STAR_STAR, "[VC,* ] -> [MC,MR]" );
+
+    B_MC_STAR = A;
+    WriteBinary( B_MC_STAR, filename );
+    ReadBinary( B, filename );
+    Check( B, A_STAR_STAR, "[MC,* ] -> [MC,MR]" );
+
+    if( commRank == 0 )
+        WriteBinary( A_STAR_STAR.LockedLocalMatrix(), filename );
+    mpi::Barrier( g.Comm() );
+    ReadBinary( B, filename );
+    Check( B, A_STAR_STAR, "Matrix -> [MC,MR]" );
+
+    mpi::Barrier( g.Comm() );
+    if( commRank == 0 )
+        std::remove( filename.c_str() );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int m = Input("--height","height of matrix",100);
+        const int n = Input("--width","width of matrix",100);
+        const std::string filename =
+            Input("--filename","scratch file",std::string("BinaryIO.bin"));
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+
+        if( commRank == 0 )
+        {
+            std::cout << "---------------------\n"
+                      << "Testing with doubles:\n"
+                      << "---------------------" << std::endl;
+        }
+        BinaryIOTest<double>( m, n, filename, g );
+
+        if( commRank == 0 )
+        {
+            std::cout << "--------------------------------------\n"
+                      << "Testing with double-precision complex:\n"
+                      << "--------------------------------------" << std::endl;
+        }
+        BinaryIOTest<Complex<double> >( m, n, filename, g );
+    }
+    catch( ArgException& e ) { }
+    catch( std::exception& e )
+    {
+        std::ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << std::endl;
+        std::cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
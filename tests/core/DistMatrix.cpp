@@ -59,8 +59,10 @@ Check( DistMatrix<T,AColDist,ARowDist>& A,
     mpi::AllReduce( &myErrorFlag, &summedErrorFlag, 1, mpi::SUM, g.Comm() );
 
     if( summedErrorFlag == 0 )
+    {
         if( commRank == 0 )
             std::cout << "PASSED" << std::endl;
+    }
     else
         throw std::logic_error("Redistribution failed");
 #ifndef RELEASE
@@ -68,6 +70,127 @@ Check( DistMatrix<T,AColDist,ARowDist>& A,
 #endif
 }
 
+template<typename T, Distribution AColDist, Distribution ARowDist,
+                     Distribution BColDist, Distribution BRowDist>
+void
+CheckPlan( DistMatrix<T,AColDist,ARowDist>& A, 
+           DistMatrix<T,BColDist,BRowDist>& B,
+           RedistPlan<T,AColDist,ARowDist,BColDist,BRowDist>& plan )
+{
+#ifndef RELEASE
+    PushCallStack("CheckPlan");
+#endif
+    const Grid& g = A.Grid();
+
+    const int commRank = g.Rank();
+    const int height = B.Height();
+    const int width = B.Width();
+    DistMatrix<T,STAR,STAR> A_STAR_STAR(g);
+    DistMatrix<T,STAR,STAR> B_STAR_STAR(g);
+
+    if( commRank == 0 )
+    {
+        std::cout << "Testing planned [" 
+                  << DistToString(AColDist) << ","
+                  << DistToString(ARowDist) << "]"
+                  << " <- ["     << DistToString(BColDist) << ","
+                                 << DistToString(BRowDist) << "]...";
+        std::cout.flush();
+    }
+
+    // Execute the plan twice so that the second execution reuses it, the
+    // second time through the nonblocking interface
+    B_STAR_STAR = B;
+    int myErrorFlag = 0;
+    for( int repeat=0; repeat<2; ++repeat )
+    {
+        MakeZeros( A );
+        if( repeat == 0 )
+            plan.Execute( A, B );
+        else
+        {
+            StartRedistribute( plan, A, B );
+            plan.Wait();
+        }
+        A_STAR_STAR = A;
+        for( int j=0; j<width; ++j )
+            for( int i=0; i<height; ++i )
+                if( A_STAR_STAR.GetLocal(i,j) != B_STAR_STAR.GetLocal(i,j) )
+                    myErrorFlag = 1;
+    }
+
+    int summedErrorFlag;
+    mpi::AllReduce( &myErrorFlag, &summedErrorFlag, 1, mpi::SUM, g.Comm() );
+
+    if( summedErrorFlag == 0 )
+    {
+        if( commRank == 0 )
+            std::cout << "PASSED" << std::endl;
+    }
+    else
+        throw std::logic_error("Planned redistribution failed");
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// Check that A can view the portion of B which it would own, and that the
+// view shares B's storage rather than copying it
+template<typename T, Distribution AColDist, Distribution ARowDist,
+                     Distribution BColDist, Distribution BRowDist>
+void
+CheckView( DistMatrix<T,AColDist,ARowDist>& A, 
+           DistMatrix<T,BColDist,BRowDist>& B )
+{
+#ifndef RELEASE
+    PushCallStack("CheckView");
+#endif
+    const Grid& g = A.Grid();
+
+    const int commRank = g.Rank();
+    const int height = B.Height();
+    const int width = B.Width();
+    DistMatrix<T,STAR,STAR> A_STAR_STAR(g);
+    DistMatrix<T,STAR,STAR> B_STAR_STAR(g);
+
+    if( commRank == 0 )
+    {
+        std::cout << "Testing view of [" 
+                  << DistToString(AColDist) << ","
+                  << DistToString(ARowDist) << "]"
+                  << " <- ["     << DistToString(BColDist) << ","
+                                 << DistToString(BRowDist) << "]...";
+        std::cout.flush();
+    }
+
+    // Since A aliases B, assigning B to A should be a no-op and scaling B
+    // should also scale A
+    View( A, B );
+    A = B;
+    Scale( T(2), B );
+    A_STAR_STAR = A;
+    B_STAR_STAR = B;
+    int myErrorFlag = 0;
+    for( int j=0; j<width; ++j )
+        for( int i=0; i<height; ++i )
+            if( A_STAR_STAR.GetLocal(i,j) != B_STAR_STAR.GetLocal(i,j) )
+                myErrorFlag = 1;
+
+    int summedErrorFlag;
+    mpi::AllReduce( &myErrorFlag, &summedErrorFlag, 1, mpi::SUM, g.Comm() );
+
+    if( summedErrorFlag == 0 )
+    {
+        if( commRank == 0 )
+            std::cout << "PASSED" << std::endl;
+    }
+    else
+        throw std::logic_error("View failed");
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 template<typename T>
 void
 DistMatrixTest( int m, int n, const Grid& g )
@@ -100,6 +223,36 @@ DistMatrixTest( int m, int n, const Grid& g )
     Check( A_STAR_VR,   A_MC_MR );
     Check( A_STAR_STAR, A_MC_MR );
 
+    // Redistribute from A[MC,MR] with reused plans and every alignment
+    RedistPlan<T,MC,STAR,MC,MR> planMCStar;
+    RedistPlan<T,STAR,MR,MC,MR> planStarMR;
+    RedistPlan<T,VC,STAR,MC,MR> planVCStar;
+    RedistPlan<T,STAR,VR,MC,MR> planStarVR;
+    const int numAlignments = g.Size();
+    for( int alignment=0; alignment<numAlignments; ++alignment )
+    {
+        A_MC_STAR.Empty();
+        A_MC_STAR.Align( alignment % g.Height() );
+        A_MC_STAR.ResizeTo( m, n );
+        CheckPlan( A_MC_STAR, A_MC_MR, planMCStar );
+        A_STAR_MR.Empty();
+        A_STAR_MR.Align( alignment % g.Width() );
+        A_STAR_MR.ResizeTo( m, n );
+        CheckPlan( A_STAR_MR, A_MC_MR, planStarMR );
+        A_VC_STAR.Empty();
+        A_VC_STAR.Align( alignment );
+        A_VC_STAR.ResizeTo( m, n );
+        CheckPlan( A_VC_STAR, A_MC_MR, planVCStar );
+        A_STAR_VR.Empty();
+        A_STAR_VR.Align( alignment );
+        A_STAR_VR.ResizeTo( m, n );
+        CheckPlan( A_STAR_VR, A_MC_MR, planStarVR );
+    }
+    A_MC_STAR.Empty();
+    A_STAR_MR.Empty();
+    A_VC_STAR.Empty();
+    A_STAR_VR.Empty();
+
     // Communicate from A[MC,*]
     Uniform( m, n, A_MC_STAR );
     Check( A_MC_MR,     A_MC_STAR );
@@ -229,6 +382,19 @@ DistMatrixTest( int m, int n, const Grid& g )
     Check( A_STAR_VC, A_STAR_STAR );
     Check( A_VR_STAR, A_STAR_STAR );
     Check( A_STAR_VR, A_STAR_STAR );
+
+    // View without communicating
+    DistMatrix<T,MC,  MR  > B_MC_MR(g);
+    DistMatrix<T,MR,  MC  > B_MR_MC(g);
+    DistMatrix<T,STAR,MR  > B_STAR_MR(g);
+    DistMatrix<T,STAR,MC  > B_STAR_MC(g);
+    Uniform( m, n, A_MC_STAR );
+    CheckView( B_MC_MR,   A_MC_STAR );
+    Uniform( m, n, A_MR_STAR );
+    CheckView( B_MR_MC,   A_MR_STAR );
+    Uniform( m, n, A_STAR_STAR );
+    CheckView( B_STAR_MR, A_STAR_STAR );
+    CheckView( B_STAR_MC, A_STAR_STAR );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -0,0 +1,177 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "elemental.hpp"
+using namespace std;
+using namespace elem;
+
+// Check against the known-answer tests of Random123
+void
+CheckPhilox()
+{
+    const philox::UInt32 counters[3][4] =
+    { { 0U, 0U, 0U, 0U },
+      { 0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU },
+      { 0x243f6a88U, 0x85a308d3U, 0x13198a2eU, 0x03707344U } };
+    const philox::UInt32 keys[3][2] =
+    { { 0U, 0U },
+      { 0xffffffffU, 0xffffffffU },
+      { 0xa4093822U, 0x299f31d0U } };
+    const philox::UInt32 answers[3][4] =
+    { { 0x6627e8d5U, 0xe169c58dU, 0xbc57ac4cU, 0x9b00dbd8U },
+      { 0x408f276dU, 0x41c83b0eU, 0xa20bc7c6U, 0x6d5451fdU },
+      { 0xd16cfe09U, 0x94fdccebU, 0x5001e420U, 0x24126ea1U } };
+    for( int test=0; test<3; ++test )
+    {
+        philox::Counter counter;
+        philox::Key key;
+        for( int i=0; i<4; ++i )
+            counter[i] = counters[test][i];
+        key[0] = keys[test][0];
+        key[1] = keys[test][1];
+        const philox::Counter result = philox::Philox4x32( counter, key );
+        for( int i=0; i<4; ++i )
+            if( result[i] != answers[test][i] )
+                throw logic_error("Philox4x32 failed a known-answer test");
+    }
+}
+
+// Regenerate the matrix with the distribution [U,V] and ensure that every
+// local entry (including redundant copies) matches the [MC,MR] version
+template<typename T,Distribution U,Distribution V>
+void
+Check
+( const DistMatrix<T,STAR,STAR>& AFull, unsigned seed, string label )
+{
+    const Grid& g = AFull.Grid();
+    const int m = AFull.Height();
+    const int n = AFull.Width();
+    if( g.Rank() == 0 )
+    {
+        cout << "  Testing " << label << "...";
+        cout.flush();
+    }
+    DistMatrix<T,U,V> A(g);
+    SetRandomSeed( seed );
+    Uniform( m, n, A );
+
+    const int colShift = A.ColShift();
+    const int rowShift = A.RowShift();
+    const int colStride = A.ColStride();
+    const int rowStride = A.RowStride();
+    int localErrors = 0, errors;
+    for( int jLocal=0; jLocal<A.LocalWidth(); ++jLocal )
+    {
+        const int j = rowShift + jLocal*rowStride;
+        for( int iLocal=0; iLocal<A.LocalHeight(); ++iLocal )
+        {
+            const int i = colShift + iLocal*colStride;
+            if( A.GetLocal(iLocal,jLocal) != AFull.GetLocal(i,j) )
+                ++localErrors;
+        }
+    }
+    mpi::AllReduce( &localErrors, &errors, 1, mpi::SUM, g.Comm() );
+    if( errors != 0 )
+    {
+        ostringstream msg;
+        msg << label << " had " << errors << " mismatched entries";
+        throw logic_error( msg.str() );
+    }
+    if( g.Rank() == 0 )
+        cout << "PASSED" << endl;
+}
+
+template<typename T>
+void
+TestRandom( int m, int n, unsigned seed, const Grid& g )
+{
+    DistMatrix<T> A(g);
+    SetRandomSeed( seed );
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    Uniform( m, n, A );
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "  Generated [MC,MR] matrix in " << runTime << " seconds ("
+             << double(m)*double(n)/(1.e6*runTime) << " million entries per "
+             << "second)" << endl;
+
+    // Successive matrices should differ
+    DistMatrix<T> B(g);
+    Uniform( m, n, B );
+    Axpy( T(-1), A, B );
+    if( m*n > 0 && Norm( B ) == 0 )
+        throw logic_error("Successive random matrices were identical");
+
+    DistMatrix<T,STAR,STAR> AFull( A );
+    Check<T,MC,  MR  >( AFull, seed, "[MC,MR]" );
+    Check<T,MC,  STAR>( AFull, seed, "[MC,* ]" );
+    Check<T,STAR,MR  >( AFull, seed, "[* ,MR]" );
+    Check<T,MR,  MC  >( AFull, seed, "[MR,MC]" );
+    Check<T,MR,  STAR>( AFull, seed, "[MR,* ]" );
+    Check<T,STAR,MC  >( AFull, seed, "[* ,MC]" );
+    Check<T,MD,  STAR>( AFull, seed, "[MD,* ]" );
+    Check<T,STAR,MD  >( AFull, seed, "[* ,MD]" );
+    Check<T,VC,  STAR>( AFull, seed, "[VC,* ]" );
+    Check<T,STAR,VC  >( AFull, seed, "[* ,VC]" );
+    Check<T,VR,  STAR>( AFull, seed, "[VR,* ]" );
+    Check<T,STAR,VR  >( AFull, seed, "[* ,VR]" );
+    Check<T,STAR,STAR>( AFull, seed, "[* ,* ]" );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int m = Input("--height","height of matrix",500);
+        const int n = Input("--width","width of matrix",300);
+        const unsigned seed = Input("--seed","random seed",17U);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+
+        if( commRank == 0 )
+            cout << "Testing Philox4x32...";
+        CheckPhilox();
+        if( commRank == 0 )
+            cout << "PASSED" << endl;
+
+        if( commRank == 0 )
+            cout << "Testing with doubles:" << endl;
+        TestRandom<double>( m, n, seed, g );
+
+        if( commRank == 0 )
+            cout << "Testing with double-precision complex:" << endl;
+        TestRandom<Complex<double> >( m, n, seed, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
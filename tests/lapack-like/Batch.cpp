@@ -0,0 +1,298 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "elemental.hpp"
+using namespace std;
+using namespace elem;
+
+// Fill each local matrix of the batch with a random HPD matrix
+template<typename F>
+void MakeHPDBatch( DistMatrixBatch<F>& A )
+{
+    MatrixBatch<F>& ALocal = A.LocalBatch();
+    Matrix<F> AMat;
+    for( int l=0; l<ALocal.Count(); ++l )
+    {
+        View( AMat, ALocal, l );
+        MakeHermitianUniformSpectrum( AMat, 1, 10 );
+    }
+}
+
+template<typename F>
+void MakeUniformBatch( DistMatrixBatch<F>& A )
+{
+    MatrixBatch<F>& ALocal = A.LocalBatch();
+    Matrix<F> AMat;
+    for( int l=0; l<ALocal.Count(); ++l )
+    {
+        View( AMat, ALocal, l );
+        MakeUniform( AMat );
+    }
+}
+
+// Copy the local matrices of A into B
+template<typename F>
+void CopyBatch( const DistMatrixBatch<F>& A, DistMatrixBatch<F>& B )
+{
+    B.ResizeTo( A.Height(), A.Width(), A.Count() );
+    const MatrixBatch<F>& ALocal = A.LockedLocalBatch();
+    MatrixBatch<F>& BLocal = B.LocalBatch();
+    Matrix<F> AMat, BMat;
+    for( int l=0; l<ALocal.Count(); ++l )
+    {
+        LockedView( AMat, ALocal, l );
+        View( BMat, BLocal, l );
+        BMat = AMat;
+    }
+}
+
+// The maximum over the entire batch of || A_l - B_l ||_F / || B_l ||_F
+template<typename F>
+typename Base<F>::type
+MaxRelativeError( const DistMatrixBatch<F>& A, const DistMatrixBatch<F>& B )
+{
+    typedef typename Base<F>::type R;
+    const MatrixBatch<F>& ALocal = A.LockedLocalBatch();
+    const MatrixBatch<F>& BLocal = B.LockedLocalBatch();
+    Matrix<F> AMat, BMat, E;
+    R maxError = 0;
+    for( int l=0; l<ALocal.Count(); ++l )
+    {
+        LockedView( AMat, ALocal, l );
+        LockedView( BMat, BLocal, l );
+        E = AMat;
+        Axpy( F(-1), BMat, E );
+        const R error = Norm( E, FROBENIUS_NORM )/Norm( BMat, FROBENIUS_NORM );
+        maxError = std::max( maxError, error );
+    }
+    mpi::AllReduce( &maxError, 1, mpi::MAX, A.Grid().Comm() );
+    return maxError;
+}
+
+template<typename F>
+void ReportTime( const Grid& g, const char* name, double batchTime, 
+                 double loopTime, typename Base<F>::type error )
+{
+    if( g.Rank() == 0 )
+        cout << "  " << name << ": batched time = " << batchTime 
+             << " seconds, looped time = " << loopTime 
+             << " seconds, max relative difference = " << error << endl;
+}
+
+template<typename F>
+void TestBatch( int n, int numRhs, int count, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+    DistMatrixBatch<F> A(n,n,count,g), ACopy(g), B(n,numRhs,count,g), 
+                       X(g), C(n,numRhs,count,g), CCopy(g);
+    MatrixBatch<F>& ALocal = ACopy.LocalBatch();
+    const int localCount = A.LocalCount();
+    Matrix<F> AMat, BMat, CMat;
+
+    // Gemm
+    MakeUniformBatch( A );
+    MakeUniformBatch( B );
+    MakeUniformBatch( C );
+    CopyBatch( C, CCopy );
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    Gemm( NORMAL, NORMAL, F(2), A, B, F(-1), C );
+    mpi::Barrier( g.Comm() );
+    const double gemmBatchTime = mpi::Time() - startTime;
+    startTime = mpi::Time();
+    for( int l=0; l<localCount; ++l )
+    {
+        LockedView( AMat, A.LockedLocalBatch(), l );
+        LockedView( BMat, B.LockedLocalBatch(), l );
+        View( CMat, CCopy.LocalBatch(), l );
+        Gemm( NORMAL, NORMAL, F(2), AMat, BMat, F(-1), CMat );
+    }
+    mpi::Barrier( g.Comm() );
+    const double gemmLoopTime = mpi::Time() - startTime;
+    ReportTime<F>
+    ( g, "Gemm         ", gemmBatchTime, gemmLoopTime, 
+      MaxRelativeError( C, CCopy ) );
+
+    // Cholesky
+    MakeHPDBatch( A );
+    CopyBatch( A, ACopy );
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    Cholesky( LOWER, A );
+    mpi::Barrier( g.Comm() );
+    const double cholBatchTime = mpi::Time() - startTime;
+    startTime = mpi::Time();
+    for( int l=0; l<localCount; ++l )
+    {
+        View( AMat, ALocal, l );
+        Cholesky( LOWER, AMat );
+        MakeTrapezoidal( LEFT, LOWER, 0, AMat );
+    }
+    mpi::Barrier( g.Comm() );
+    const double cholLoopTime = mpi::Time() - startTime;
+    for( int l=0; l<localCount; ++l )
+    {
+        View( AMat, A.LocalBatch(), l );
+        MakeTrapezoidal( LEFT, LOWER, 0, AMat );
+    }
+    ReportTime<F>
+    ( g, "Cholesky     ", cholBatchTime, cholLoopTime, 
+      MaxRelativeError( A, ACopy ) );
+
+    // CholeskySolve (and check the residuals of the solutions)
+    MakeHPDBatch( A );
+    CopyBatch( A, ACopy );
+    MakeUniformBatch( B );
+    CopyBatch( B, X );
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    CholeskySolve( UPPER, A, X );
+    mpi::Barrier( g.Comm() );
+    const double solveTime = mpi::Time() - startTime;
+    for( int l=0; l<localCount; ++l )
+    {
+        LockedView( AMat, ALocal, l );
+        View( BMat, B.LocalBatch(), l );
+        LockedView( CMat, X.LockedLocalBatch(), l );
+        Hemm( LEFT, UPPER, F(-1), AMat, CMat, F(1), BMat );
+    }
+    R maxResidual = 0;
+    for( int l=0; l<localCount; ++l )
+    {
+        LockedView( BMat, B.LockedLocalBatch(), l );
+        maxResidual = std::max( maxResidual, Norm( BMat, FROBENIUS_NORM ) );
+    }
+    mpi::AllReduce( &maxResidual, 1, mpi::MAX, g.Comm() );
+    if( g.Rank() == 0 )
+        cout << "  CholeskySolve: batched time = " << solveTime 
+             << " seconds, max ||B - A X||_F = " << maxResidual << endl;
+
+    // LU
+    DistMatrixBatch<int> p(g);
+    MakeUniformBatch( A );
+    CopyBatch( A, ACopy );
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    LU( A, p );
+    mpi::Barrier( g.Comm() );
+    const double luBatchTime = mpi::Time() - startTime;
+    Matrix<int> pMat;
+    startTime = mpi::Time();
+    for( int l=0; l<localCount; ++l )
+    {
+        View( AMat, ALocal, l );
+        LU( AMat, pMat );
+    }
+    mpi::Barrier( g.Comm() );
+    const double luLoopTime = mpi::Time() - startTime;
+    ReportTime<F>
+    ( g, "LU           ", luBatchTime, luLoopTime, 
+      MaxRelativeError( A, ACopy ) );
+
+    // HermitianEig (and check the residuals of the eigenpairs)
+    DistMatrixBatch<R> w(g), wLoop(n,1,count,g);
+    DistMatrixBatch<F> Z(g);
+    MakeHPDBatch( A );
+    CopyBatch( A, ACopy );
+    CopyBatch( A, CCopy );
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    HermitianEig( LOWER, A, w, Z );
+    mpi::Barrier( g.Comm() );
+    const double eigBatchTime = mpi::Time() - startTime;
+    Matrix<R> wMat;
+    startTime = mpi::Time();
+    for( int l=0; l<localCount; ++l )
+    {
+        View( AMat, ALocal, l );
+        View( wMat, wLoop.LocalBatch(), l );
+        HermitianEig( LOWER, AMat, wMat );
+    }
+    mpi::Barrier( g.Comm() );
+    const double eigLoopTime = mpi::Time() - startTime;
+    ReportTime<R>
+    ( g, "HermitianEig ", eigBatchTime, eigLoopTime, 
+      MaxRelativeError( w, wLoop ) );
+    Matrix<F> ZMat, E;
+    maxResidual = 0;
+    for( int l=0; l<localCount; ++l )
+    {
+        LockedView( AMat, CCopy.LockedLocalBatch(), l );
+        LockedView( wMat, w.LockedLocalBatch(), l );
+        LockedView( ZMat, Z.LockedLocalBatch(), l );
+        E = ZMat;
+        DiagonalScale( RIGHT, NORMAL, wMat, E );
+        Hemm( LEFT, LOWER, F(-1), AMat, ZMat, F(1), E );
+        maxResidual = 
+            std::max( maxResidual, Norm( E, FROBENIUS_NORM )/
+                                   Norm( AMat, FROBENIUS_NORM ) );
+    }
+    mpi::AllReduce( &maxResidual, 1, mpi::MAX, g.Comm() );
+    if( g.Rank() == 0 )
+        cout << "  HermitianEig: max ||A Z - Z diag(w)||_F / ||A||_F = " 
+             << maxResidual << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const int n = Input("--n","size of each matrix",32);
+        const int numRhs = Input("--numRhs","number of right-hand sides",1);
+        const int count = Input("--count","number of matrices",1000);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+#ifndef RELEASE
+        if( commRank == 0 )
+        {
+            cout << "==========================================\n"
+                 << " In debug mode! Performance will be poor! \n"
+                 << "==========================================" << endl;
+        }
+#endif
+        if( commRank == 0 )
+            cout << "Will test batches of " << count << " " << n << " x " 
+                 << n << " matrices" << endl;
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestBatch<double>( n, numRhs, count, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestBatch<Complex<double> >( n, numRhs, count, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,160 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "elemental.hpp"
+using namespace std;
+using namespace elem;
+
+// Estimates must be lower bounds and should be within a small factor of the
+// exact values
+template<typename R>
+void
+CheckEstimate( const string label, R estimate, R exact, R estimateTime,
+               R exactTime, bool print )
+{
+    if( print )
+        cout << "  " << label << ": estimate=" << estimate << " ("
+             << estimateTime << " secs), exact=" << exact << " ("
+             << exactTime << " secs)" << endl;
+    // The 'exact' values are themselves computed with relative errors on the
+    // order of kappa eps
+    const R eps = lapack::MachineEpsilon<R>();
+    if( estimate > exact*(1+Sqrt(eps)) || estimate < exact/10 )
+    {
+        ostringstream msg;
+        msg << label << " estimate of " << estimate << " was not a reasonable "
+            << "lower bound for " << exact;
+        throw logic_error( msg.str() );
+    }
+}
+
+template<typename F>
+void
+TestConditionEstimate( int m, double tol, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+    const bool print = ( g.Rank() == 0 );
+    DistMatrix<F> A(g), B(g);
+    DistMatrix<int,VC,STAR> p(g);
+    Uniform( m, m, A );
+
+    // The two-norm via Lanczos bidiagonalization versus an SVD
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    const R twoNormEst = TwoNormEstimate( A, R(tol) );
+    mpi::Barrier( g.Comm() );
+    const double estTime = mpi::Time() - startTime;
+    startTime = mpi::Time();
+    const R twoNorm = Norm( A, TWO_NORM );
+    mpi::Barrier( g.Comm() );
+    const double exactTime = mpi::Time() - startTime;
+    if( print )
+        cout << "  ||A||_2: estimate=" << twoNormEst << " (" << estTime
+             << " secs), exact=" << twoNorm << " (" << exactTime << " secs)"
+             << endl;
+    if( Abs(twoNormEst-twoNorm) > 10*tol*twoNorm ||
+        twoNormEst > twoNorm*(1+Sqrt(lapack::MachineEpsilon<R>())) )
+        throw logic_error("Two-norm estimate was inaccurate");
+
+    // The one-norm condition number after an LU factorization
+    const R oneNorm = Norm( A, ONE_NORM );
+    B = A;
+    LU( B, p );
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    const R luEst = ConditionEstimateAfterLU( B, p, oneNorm );
+    mpi::Barrier( g.Comm() );
+    const double luEstTime = mpi::Time() - startTime;
+    B = A;
+    startTime = mpi::Time();
+    Inverse( B );
+    const R luExact = oneNorm*Norm( B, ONE_NORM );
+    mpi::Barrier( g.Comm() );
+    const double luExactTime = mpi::Time() - startTime;
+    CheckEstimate
+    ( "kappa_1(A) after LU", luEst, luExact, R(luEstTime), R(luExactTime),
+      print );
+
+    // The sequential implementation should agree
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( A );
+    Matrix<int> pSeq;
+    LU( A_STAR_STAR.LocalMatrix(), pSeq );
+    startTime = mpi::Time();
+    const R luEstSeq =
+        ConditionEstimateAfterLU( A_STAR_STAR.LockedLocalMatrix(), pSeq,
+                                  oneNorm );
+    CheckEstimate
+    ( "kappa_1(A) after sequential LU", luEstSeq, luExact,
+      R(mpi::Time()-startTime), R(luExactTime), print );
+
+    // The one-norm condition number after a Cholesky factorization
+    HermitianUniformSpectrum( m, A, 1, 1000 );
+    const R hpdOneNorm = HermitianNorm( LOWER, A, ONE_NORM );
+    B = A;
+    Cholesky( LOWER, B );
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    const R cholEst = ConditionEstimateAfterCholesky( LOWER, B, hpdOneNorm );
+    mpi::Barrier( g.Comm() );
+    const double cholEstTime = mpi::Time() - startTime;
+    B = A;
+    startTime = mpi::Time();
+    HPDInverse( LOWER, B );
+    const R cholExact = hpdOneNorm*HermitianNorm( LOWER, B, ONE_NORM );
+    mpi::Barrier( g.Comm() );
+    CheckEstimate
+    ( "kappa_1(A) after Cholesky", cholEst, cholExact, R(cholEstTime),
+      R(mpi::Time()-startTime), print );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int m = Input("--height","height of matrix",300);
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        const double tol =
+            Input("--tol","relative tolerance for two-norm estimate",1e-6);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+        SetBlocksize( nb );
+
+        if( commRank == 0 )
+            cout << "Testing with doubles:" << endl;
+        TestConditionEstimate<double>( m, tol, g );
+
+        if( commRank == 0 )
+            cout << "Testing with double-precision complex:" << endl;
+        TestConditionEstimate<Complex<double> >( m, tol, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
@@ -328,7 +328,9 @@ main( int argc, char* argv[] )
         const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
         const int m = Input("--height","height of matrix",100);
         const int nb = Input("--nb","algorithmic blocksize",96);
-        const int nbLocal = Input("--nbLocal","local blocksize",32);
+        const int nbLocal = Input("--nbLocal","local blocksize",8192);
+        const int bandwidth = 
+            Input("--bandwidth","bandwidth of two-stage tridiag",16);
         const bool testCorrectness = Input
             ("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
@@ -395,6 +397,18 @@ main( int argc, char* argv[] )
         ( testCorrectness, print, 
           onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, g );
 
+        if( commRank == 0 )
+        {
+            cout << "---------------------------------------------\n"
+                 << "Double-precision two-stage tridiag algorithm:\n"
+                 << "---------------------------------------------" << endl;
+        }
+        SetHermitianTridiagApproach( HERMITIAN_TRIDIAG_TWO_STAGE );
+        SetHermitianTridiagBandwidth( bandwidth );
+        TestHermitianEigDouble
+        ( testCorrectness, print, 
+          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, g );
+
         if( commRank == 0 )
         {
             cout << "--------------------------------------------------\n"
@@ -434,6 +448,18 @@ main( int argc, char* argv[] )
         TestHermitianEigDoubleComplex
         ( testCorrectness, print, 
           onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, g );
+
+        if( commRank == 0 )
+        {
+            cout << "-----------------------------------------------------\n"
+                 << "Double-precision complex two-stage tridiag algorithm:\n"
+                 << "-----------------------------------------------------" 
+                 << endl;
+        }
+        SetHermitianTridiagApproach( HERMITIAN_TRIDIAG_TWO_STAGE );
+        TestHermitianEigDoubleComplex
+        ( testCorrectness, print, 
+          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, g );
     }
     catch( ArgException& e ) { }
     catch( exception& e )
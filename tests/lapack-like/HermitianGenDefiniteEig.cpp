@@ -673,7 +673,7 @@ main( int argc, char* argv[] )
         const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
         const int m = Input("--height","height of matrix",100);
         const int nb = Input("--nb","algorithmic blocksize",96);
-        const int nbLocal = Input("--nbLocal","local blocksize",32);
+        const int nbLocal = Input("--nbLocal","local blocksize",8192);
         const bool testCorrectness = Input
             ("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
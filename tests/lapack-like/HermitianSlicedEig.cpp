@@ -0,0 +1,208 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <ctime>
+#include "elemental.hpp"
+using namespace std;
+using namespace elem;
+
+template<typename F>
+void TestCorrectness
+( bool print,
+  UpperOrLower uplo,
+  const DistMatrix<typename Base<F>::type,VR,STAR>& w,
+  const DistMatrix<F>& Z,
+  const DistMatrix<F>& AOrig,
+  double vl, double vu )
+{
+    typedef typename Base<F>::type R;
+    const Grid& g = Z.Grid();
+    const int n = Z.Height();
+    const int k = Z.Width();
+
+    if( g.Rank() == 0 )
+        cout << "  Testing the eigenvalue count..." << endl;
+    const int numBelowLower = HermitianInertia( uplo, AOrig, vl ).numNegative;
+    const int numBelowUpper = HermitianInertia( uplo, AOrig, vu ).numNegative;
+    DistMatrix<R,STAR,STAR> w_STAR_STAR( w );
+    bool inInterval = true;
+    for( int j=0; j<k; ++j )
+    {
+        const R omega = w_STAR_STAR.GetLocal(j,0);
+        if( omega <= vl || omega > vu )
+            inInterval = false;
+    }
+    if( g.Rank() == 0 )
+    {
+        cout << "    expected count    = " << numBelowUpper-numBelowLower
+             << "\n"
+             << "    computed count    = " << k << "\n"
+             << "    all within (a,b]? = " << inInterval << endl;
+    }
+
+    if( g.Rank() == 0 )
+        cout << "  Testing orthogonality of eigenvectors..." << endl;
+    DistMatrix<F> X(g);
+    Identity( k, k, X );
+    Herk( uplo, ADJOINT, F(-1), Z, F(1), X );
+    const R frobNormOfOrthError = HermitianNorm( uplo, X, FROBENIUS_NORM );
+    if( g.Rank() == 0 )
+    {
+        cout << "    ||Z^H Z - I||_F  = " << frobNormOfOrthError << "\n\n"
+             << "  Testing for deviation of AZ from ZW..." << endl;
+    }
+
+    // X := AZ - ZW
+    DistMatrix<R,MR,STAR> w_MR_STAR(true,Z.RowAlignment(),g);
+    w_MR_STAR = w;
+    X.AlignWith( Z );
+    Zeros( n, k, X );
+    Hemm( LEFT, uplo, F(1), AOrig, Z, F(0), X );
+    for( int jLocal=0; jLocal<X.LocalWidth(); ++jLocal )
+    {
+        const R omega = w_MR_STAR.GetLocal(jLocal,0);
+        for( int iLocal=0; iLocal<X.LocalHeight(); ++iLocal )
+        {
+            const F chi = X.GetLocal(iLocal,jLocal);
+            const F zeta = Z.GetLocal(iLocal,jLocal);
+            X.SetLocal(iLocal,jLocal,chi-omega*zeta);
+        }
+    }
+    const R frobNormOfA = HermitianNorm( uplo, AOrig, FROBENIUS_NORM );
+    const R frobNormOfError = Norm( X, FROBENIUS_NORM );
+    if( g.Rank() == 0 )
+    {
+        cout << "    ||A||_F            = " << frobNormOfA << "\n"
+             << "    ||A Z - Z W||_F    = " << frobNormOfError << endl;
+    }
+}
+
+template<typename F>
+void TestHermitianSlicedEig
+( bool testCorrectness, bool print, UpperOrLower uplo, int m,
+  double vl, double vu, int numSubgrids, int slicesPerSubgrid,
+  const Grid& g )
+{
+    typedef typename Base<F>::type R;
+    DistMatrix<F> A(g), AOrig(g), Z(g);
+    DistMatrix<R,VR,STAR> w(g);
+    HermitianUniformSpectrum( m, A, -10, 10 );
+    if( testCorrectness )
+    {
+        if( g.Rank() == 0 )
+        {
+            cout << "  Making copy of original matrix...";
+            cout.flush();
+        }
+        AOrig = A;
+        if( g.Rank() == 0 )
+            cout << "DONE" << endl;
+    }
+    if( print )
+        A.Print("A");
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting spectrum slicing...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    HermitianSlicedEig
+    ( uplo, A, w, Z, R(vl), R(vu), numSubgrids, slicesPerSubgrid );
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+    {
+        cout << "DONE. " << endl
+             << "  Time = " << runTime << " seconds." << endl;
+    }
+    if( print )
+    {
+        w.Print("eigenvalues:");
+        Z.Print("eigenvectors:");
+    }
+    if( testCorrectness )
+        TestCorrectness( print, uplo, w, Z, AOrig, vl, vu );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const double vl = Input("--vl","lower bound of value range",-1.);
+        const double vu = Input("--vu","upper bound of value range",1.);
+        const int numSubgrids = Input("--numSubgrids","number of subgrids",1);
+        const int slicesPerSubgrid =
+            Input("--slicesPerSubgrid","number of slices per subgrid",2);
+        const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
+        const int m = Input("--height","height of matrix",100);
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        const bool testCorrectness = Input
+            ("--correctness","test correctness?",true);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
+        SetBlocksize( nb );
+#ifndef RELEASE
+        if( commRank == 0 )
+        {
+            cout << "==========================================\n"
+                 << " In debug mode! Performance will be poor! \n"
+                 << "==========================================" << endl;
+        }
+#endif
+        if( commRank == 0 )
+            cout << "Will test HermitianSlicedEig " << uploChar << endl;
+
+        if( commRank == 0 )
+        {
+            cout << "-----------------\n"
+                 << "Double-precision:\n"
+                 << "-----------------" << endl;
+        }
+        TestHermitianSlicedEig<double>
+        ( testCorrectness, print, uplo, m, vl, vu,
+          numSubgrids, slicesPerSubgrid, g );
+
+        if( commRank == 0 )
+        {
+            cout << "-------------------------\n"
+                 << "Double-precision complex:\n"
+                 << "-------------------------" << endl;
+        }
+        TestHermitianSlicedEig<Complex<double> >
+        ( testCorrectness, print, uplo, m, vl, vu,
+          numSubgrids, slicesPerSubgrid, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
@@ -254,6 +254,68 @@ void TestComplexHermitianTridiag
         TestCorrectness( print, uplo, A, t, AOrig );
 }
 
+template<typename F>
+void TestHermitianTridiagTwoStage
+( bool testCorrectness, bool print,
+  UpperOrLower uplo, int m, int bandwidth, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+    DistMatrix<F> A(g), AOrig(g);
+    DistMatrix<F,STAR,STAR> t(g);
+    DistMatrix<F,STAR,VR> V(g), tau(g);
+
+    HermitianUniformSpectrum( m, A, -10, 10 );
+    if( testCorrectness )
+        AOrig = A;
+    if( print )
+        A.Print("A");
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting two-stage tridiagonalization...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    HermitianTridiagTwoStage( uplo, bandwidth, A, t, V, tau );
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "DONE. " << endl
+             << "  Time = " << runTime << " seconds." << endl;
+    if( print )
+        A.Print("A after HermitianTridiagTwoStage");
+    if( !testCorrectness )
+        return;
+
+    // Form Q T Q^H as (Q (Q T)^H)^H and compare against the original matrix
+    DistMatrix<F> T(g), TAdj(g);
+    T.AlignWith( A );
+    Zeros( m, m, T );
+    for( int j=0; j<m; ++j )
+    {
+        T.Set( j, j, A.Get(j,j) );
+        if( j < m-1 )
+        {
+            T.Set( j+1, j, A.Get(j+1,j) );
+            T.Set( j, j+1, A.Get(j+1,j) );
+        }
+    }
+    ApplyTwoStageReflectors( bandwidth, A, t, V, tau, T );
+    Adjoint( T, TAdj );
+    ApplyTwoStageReflectors( bandwidth, A, t, V, tau, TAdj );
+    MakeHermitian( uplo, AOrig );
+    Adjoint( TAdj, T );
+    Axpy( F(-1), AOrig, T );
+    const R frobNormOfAOrig = Norm( AOrig, FROBENIUS_NORM );
+    const R frobNormOfError = Norm( T, FROBENIUS_NORM );
+    if( g.Rank() == 0 )
+    {
+        cout << "    ||AOrig||_F                = " << frobNormOfAOrig << "\n"
+             << "    ||A - Q^H T Q||_F          = " << frobNormOfError << endl;
+    }
+}
+
 int 
 main( int argc, char* argv[] )
 {
@@ -268,7 +330,9 @@ main( int argc, char* argv[] )
         const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
         const int m = Input("--height","height of matrix",100);
         const int nb = Input("--nb","algorithmic blocksize",96);
-        const int nbLocal = Input("--nbLocal","local blocksize",32);
+        const int nbLocal = Input("--nbLocal","local blocksize",8192);
+        const int bandwidth = 
+            Input("--bandwidth","bandwidth of two-stage approach",16);
         const bool testCorrectness = Input
             ("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
@@ -361,6 +425,24 @@ main( int argc, char* argv[] )
         SetHermitianTridiagGridOrder( COLUMN_MAJOR );
         TestComplexHermitianTridiag<double>
         ( testCorrectness, print, uplo, m, g );
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------------------------\n"
+                 << "Double-precision two-stage algorithm:\n"
+                 << "---------------------------------------" << endl;
+        }
+        TestHermitianTridiagTwoStage<double>
+        ( testCorrectness, print, uplo, m, bandwidth, g );
+
+        if( commRank == 0 )
+        {
+            cout << "-----------------------------------------------\n"
+                 << "Double-precision complex two-stage algorithm:\n"
+                 << "-----------------------------------------------" << endl;
+        }
+        TestHermitianTridiagTwoStage<Complex<double> >
+        ( testCorrectness, print, uplo, m, bandwidth, g );
     }
     catch( ArgException& e ) { }
     catch( exception& e )
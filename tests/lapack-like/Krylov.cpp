@@ -0,0 +1,276 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <ctime>
+#include "elemental.hpp"
+using namespace std;
+using namespace elem;
+
+// The entry (i,j) of the 7-point finite-difference discretization of
+// -Laplacian(u) + convection d/dx(u) on an nx x ny x nz grid. If 'dropZ' is
+// true, the couplings in the z direction are dropped, which yields the dense
+// (block-diagonal) approximation used as a preconditioner.
+template<typename F>
+F Stencil
+( int i, int j, int nx, int ny, int nz, double convection, bool dropZ=false )
+{
+    if( i == j )
+        return 6;
+    const int xi = i % nx, yi = (i/nx) % ny, zi = i/(nx*ny);
+    const int xj = j % nx, yj = (j/nx) % ny, zj = j/(nx*ny);
+    const int dist = std::abs(xi-xj) + std::abs(yi-yj) + std::abs(zi-zj);
+    if( dist != 1 )
+        return 0;
+    if( xi != xj )
+        return ( xj > xi ? -1+convection : -1-convection );
+    if( zi != zj && dropZ )
+        return 0;
+    return -1;
+}
+
+template<typename F>
+void MakeStencil
+( DistSparseMatrix<F>& A, int nx, int ny, int nz, double convection )
+{
+    const int n = nx*ny*nz;
+    A.ResizeTo( n, n );
+    const int localHeight = A.LocalHeight();
+    A.Reserve( 7*localHeight );
+    for( int iLocal=0; iLocal<localHeight; ++iLocal )
+    {
+        const int i = A.GlobalRow( iLocal );
+        const int x = i % nx, y = (i/nx) % ny, z = i/(nx*ny);
+        A.Update( i, i, Stencil<F>( i, i, nx, ny, nz, convection ) );
+        if( x > 0 )
+            A.Update( i, i-1, Stencil<F>( i, i-1, nx, ny, nz, convection ) );
+        if( x+1 < nx )
+            A.Update( i, i+1, Stencil<F>( i, i+1, nx, ny, nz, convection ) );
+        if( y > 0 )
+            A.Update( i, i-nx, Stencil<F>( i, i-nx, nx, ny, nz, convection ) );
+        if( y+1 < ny )
+            A.Update( i, i+nx, Stencil<F>( i, i+nx, nx, ny, nz, convection ) );
+        if( z > 0 )
+            A.Update
+            ( i, i-nx*ny, Stencil<F>( i, i-nx*ny, nx, ny, nz, convection ) );
+        if( z+1 < nz )
+            A.Update
+            ( i, i+nx*ny, Stencil<F>( i, i+nx*ny, nx, ny, nz, convection ) );
+    }
+    A.MakeConsistent();
+}
+
+template<typename F>
+void MakeDenseStencil
+( DistMatrix<F>& A, int nx, int ny, int nz, double convection, bool dropZ )
+{
+    const int n = nx*ny*nz;
+    Zeros( n, n, A );
+    const int colShift = A.ColShift();
+    const int rowShift = A.RowShift();
+    const int colStride = A.ColStride();
+    const int rowStride = A.RowStride();
+    for( int jLocal=0; jLocal<A.LocalWidth(); ++jLocal )
+    {
+        const int j = rowShift + jLocal*rowStride;
+        for( int iLocal=0; iLocal<A.LocalHeight(); ++iLocal )
+        {
+            const int i = colShift + iLocal*colStride;
+            A.SetLocal
+            ( iLocal, jLocal,
+              Stencil<F>( i, j, nx, ny, nz, convection, dropZ ) );
+        }
+    }
+}
+
+template<typename F>
+typename Base<F>::type
+RelativeResidual
+( const DistSparseMatrix<F>& A, const DistMatrix<F,VC,STAR>& B,
+  const DistMatrix<F,VC,STAR>& X )
+{
+    DistMatrix<F,VC,STAR> R( B );
+    Multiply( F(-1), A, X, F(1), R );
+    return Norm( R, FROBENIUS_NORM ) / Norm( B, FROBENIUS_NORM );
+}
+
+template<typename F>
+void TestMultiply
+( const DistSparseMatrix<F>& A, int nx, int ny, int nz, double convection,
+  int numRhs )
+{
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    DistMatrix<F> ADense(g), X(g), Y(g);
+    MakeDenseStencil( ADense, nx, ny, nz, convection, false );
+    Uniform( n, numRhs, X );
+    Zeros( n, numRhs, Y );
+    Gemm( NORMAL, NORMAL, F(1), ADense, X, F(0), Y );
+
+    DistMatrix<F,VC,STAR> X_VC_STAR( X ), Y_VC_STAR( g );
+    Zeros( n, numRhs, Y_VC_STAR );
+    Multiply( F(1), A, X_VC_STAR, F(0), Y_VC_STAR );
+    DistMatrix<F> YSparse( Y_VC_STAR );
+    Axpy( F(-1), Y, YSparse );
+    const R frobNormOfY = Norm( Y, FROBENIUS_NORM );
+    const R frobNormOfError = Norm( YSparse, FROBENIUS_NORM );
+    if( g.Rank() == 0 )
+    {
+        cout << "  Testing the sparse product against Gemm...\n"
+             << "    ||A X||_F                = " << frobNormOfY << "\n"
+             << "    ||A X - Multiply(A,X)||_F = " << frobNormOfError << "\n"
+             << endl;
+    }
+}
+
+template<typename F>
+void TestKrylov
+( bool testCorrectness, int nx, int ny, int nz, int numRhs,
+  double tol, int restart, int maxIts, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+    const int n = nx*ny*nz;
+    const double convection = 0.5;
+    DistSparseMatrix<F> A(g), ANonsym(g);
+    MakeStencil( A, nx, ny, nz, 0. );
+    MakeStencil( ANonsym, nx, ny, nz, convection );
+    if( testCorrectness )
+        TestMultiply( ANonsym, nx, ny, nz, convection, numRhs );
+
+    // Factor the dense approximations which drop the z couplings
+    DistMatrix<F> M(g), MNonsym(g);
+    DistMatrix<int,VC,STAR> p(g);
+    MakeDenseStencil( M, nx, ny, nz, 0., true );
+    MakeDenseStencil( MNonsym, nx, ny, nz, convection, true );
+    Cholesky( LOWER, M );
+    LU( MNonsym, p );
+    CholeskyPreconditioner<F> cholPrec( LOWER, M );
+    LUPreconditioner<F> luPrec( MNonsym, p );
+
+    DistMatrix<F> BDense(g);
+    Uniform( n, numRhs, BDense );
+    DistMatrix<F,VC,STAR> B( BDense ), X(g);
+
+    for( int test=0; test<6; ++test )
+    {
+        std::string name;
+        Zeros( n, numRhs, X );
+        mpi::Barrier( g.Comm() );
+        const double startTime = mpi::Time();
+        int numIts;
+        switch( test )
+        {
+        case 0:
+            name = "CG";
+            numIts = CG( A, B, X, R(tol), maxIts );
+            break;
+        case 1:
+            name = "CG with Cholesky preconditioner";
+            numIts = CG( A, B, X, cholPrec, R(tol), maxIts );
+            break;
+        case 2:
+            name = "BlockCG";
+            numIts = BlockCG( A, B, X, R(tol), maxIts );
+            break;
+        case 3:
+            name = "BlockCG with Cholesky preconditioner";
+            numIts = BlockCG( A, B, X, cholPrec, R(tol), maxIts );
+            break;
+        case 4:
+            name = "GMRES";
+            numIts = GMRES( ANonsym, B, X, R(tol), restart, maxIts );
+            break;
+        default:
+            name = "GMRES with LU preconditioner";
+            numIts = GMRES( ANonsym, B, X, luPrec, R(tol), restart, maxIts );
+            break;
+        }
+        mpi::Barrier( g.Comm() );
+        const double runTime = mpi::Time() - startTime;
+        const R resid =
+            RelativeResidual( test < 4 ? A : ANonsym, B, X );
+        if( g.Rank() == 0 )
+        {
+            cout << "  " << name << ":\n"
+                 << "    iterations          = " << numIts << "\n"
+                 << "    time                = " << runTime << " seconds\n"
+                 << "    ||B - A X||_F/||B||_F = " << resid << endl;
+        }
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int nx = Input("--nx","size of grid in x direction",10);
+        const int ny = Input("--ny","size of grid in y direction",10);
+        const int nz = Input("--nz","size of grid in z direction",10);
+        const int numRhs = Input("--numRhs","number of right-hand sides",4);
+        const double tol = Input("--tol","relative residual tolerance",1e-8);
+        const int restart = Input("--restart","GMRES restart length",30);
+        const int maxIts = Input("--maxIts","maximum iterations",1000);
+        const bool testCorrectness = Input
+            ("--correctness","test correctness?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+#ifndef RELEASE
+        if( commRank == 0 )
+        {
+            cout << "==========================================\n"
+                 << " In debug mode! Performance will be poor! \n"
+                 << "==========================================" << endl;
+        }
+#endif
+        if( commRank == 0 )
+            cout << "Will test the Krylov solvers" << endl;
+
+        if( commRank == 0 )
+        {
+            cout << "-----------------\n"
+                 << "Double-precision:\n"
+                 << "-----------------" << endl;
+        }
+        TestKrylov<double>
+        ( testCorrectness, nx, ny, nz, numRhs, tol, restart, maxIts, g );
+
+        if( commRank == 0 )
+        {
+            cout << "-------------------------\n"
+                 << "Double-precision complex:\n"
+                 << "-------------------------" << endl;
+        }
+        TestKrylov<Complex<double> >
+        ( testCorrectness, nx, ny, nz, numRhs, tol, restart, maxIts, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
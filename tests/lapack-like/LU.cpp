@@ -130,6 +130,10 @@ main( int argc, char* argv[] )
         const int m = Input("--height","height of matrix",100);
         const int nb = Input("--nb","algorithmic blocksize",96);
         const bool pivot = Input("--pivot","pivoted LU?",true);
+        const bool lookAhead = 
+            Input("--lookAhead","look-ahead pivoted LU?",false);
+        const bool tournament = 
+            Input("--tournament","tournament pivoting?",false);
         const bool testCorrectness = Input
             ("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
@@ -141,6 +145,9 @@ main( int argc, char* argv[] )
         const int c = commSize / r;
         const Grid g( comm, r, c );
         SetBlocksize( nb );
+        SetLUApproach( lookAhead ? LU_LOOK_AHEAD : LU_BULK_SYNCHRONOUS );
+        SetLUPanelPivoting
+        ( tournament ? LU_PANEL_TOURNAMENT : LU_PANEL_PARTIAL );
 #ifndef RELEASE
         if( commRank == 0 )
         {
@@ -151,7 +158,9 @@ main( int argc, char* argv[] )
 #endif
         if( commRank == 0 )
             cout << "Will test LU" 
-                 << ( pivot ? " with partial pivoting" : " " ) << endl;
+                 << ( pivot ? " with partial pivoting" : " " ) 
+                 << ( pivot && tournament ? " (tournament)" : "" )
+                 << ( pivot && lookAhead ? " and look-ahead" : "" ) << endl;
 
         if( commRank == 0 )
         {
@@ -0,0 +1,176 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <ctime>
+#include "elemental.hpp"
+using namespace std;
+using namespace elem;
+
+// Print || B - A X ||_oo / (|| A ||_oo || X ||_oo eps n)
+template<typename F>
+void
+ReportResidual
+( const string label, double runTime, const DistMatrix<F>& A,
+  const DistMatrix<F>& B, const DistMatrix<F>& X, bool hermitian,
+  UpperOrLower uplo=LOWER )
+{
+    typedef typename Base<F>::type R;
+    const int n = A.Height();
+    DistMatrix<F> Residual( B );
+    R ANorm;
+    if( hermitian )
+    {
+        Hemm( LEFT, uplo, F(-1), A, X, F(1), Residual );
+        ANorm = HermitianNorm( uplo, A, INFINITY_NORM );
+    }
+    else
+    {
+        Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), Residual );
+        ANorm = Norm( A, INFINITY_NORM );
+    }
+    const R XNorm = Norm( X, INFINITY_NORM );
+    const R residualNorm = Norm( Residual, INFINITY_NORM );
+    const R eps = lapack::MachineEpsilon<R>();
+    if( A.Grid().Rank() == 0 )
+        cout << "  " << label << ": " << runTime << " seconds, "
+             << "||B - A X||_oo / (||A||_oo ||X||_oo eps n) = "
+             << residualNorm/(ANorm*XNorm*eps*n) << endl;
+}
+
+template<typename F>
+void TestMixedPrecisionSolve
+( bool print, int m, int numRhs, int maxIts, double conditioning,
+  const Grid& g )
+{
+    const int commRank = g.Rank();
+    DistMatrix<F> A(g), ACopy(g), B(g), X(g);
+
+    // Shifting a uniform matrix by a multiple of the identity larger than m
+    // makes it diagonally dominant (and well-conditioned)
+    Uniform( m, m, A );
+    for( int j=0; j<m; ++j )
+        A.Update( j, j, F(conditioning) );
+    Uniform( m, numRhs, B );
+    if( print )
+    {
+        A.Print("A");
+        B.Print("B");
+    }
+
+    ACopy = A;
+    X = B;
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    GaussianElimination( ACopy, X );
+    mpi::Barrier( g.Comm() );
+    ReportResidual
+    ( "GaussianElimination", mpi::Time()-startTime, A, B, X, false );
+
+    ACopy = A;
+    X = B;
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    int its = LinearSolveMixed( ACopy, X, maxIts );
+    mpi::Barrier( g.Comm() );
+    ReportResidual
+    ( "LinearSolveMixed   ", mpi::Time()-startTime, A, B, X, false );
+    if( commRank == 0 )
+        cout << "    refinement steps: " << its << endl;
+    if( print )
+        X.Print("X");
+
+    HermitianUniformSpectrum( m, A, 1, conditioning );
+    ACopy = A;
+    X = B;
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    CholeskySolve( LOWER, ACopy, X );
+    mpi::Barrier( g.Comm() );
+    ReportResidual
+    ( "CholeskySolve      ", mpi::Time()-startTime, A, B, X, true );
+
+    ACopy = A;
+    X = B;
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    its = CholeskySolveMixed( LOWER, ACopy, X, maxIts );
+    mpi::Barrier( g.Comm() );
+    ReportResidual
+    ( "CholeskySolveMixed ", mpi::Time()-startTime, A, B, X, true );
+    if( commRank == 0 )
+        cout << "    refinement steps: " << its << endl;
+    if( print )
+        X.Print("X");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int m = Input("--height","height of matrix",300);
+        const int numRhs = Input("--numRhs","number of right-hand sides",10);
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        const int maxIts = Input("--maxIts","maximum refinement steps",30);
+        const double conditioning =
+            Input("--conditioning","shift (or max eigenvalue) of A",1000.);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+        SetBlocksize( nb );
+#ifndef RELEASE
+        if( commRank == 0 )
+        {
+            cout << "==========================================\n"
+                 << " In debug mode! Performance will be poor! \n"
+                 << "==========================================" << endl;
+        }
+#endif
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestMixedPrecisionSolve<double>
+        ( print, m, numRhs, maxIts, conditioning, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestMixedPrecisionSolve<Complex<double> >
+        ( print, m, numRhs, maxIts, conditioning, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
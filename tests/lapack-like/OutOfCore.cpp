@@ -0,0 +1,171 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <cstdio>
+#include <ctime>
+#include "elemental.hpp"
+using namespace std;
+using namespace elem;
+
+// Write A to disk one panel at a time (the views of A are already aligned
+// with the panels of the out-of-core matrix)
+template<typename F>
+void
+StoreOutOfCore( const DistMatrix<F>& A, OutOfCoreMatrix<F>& AOOC )
+{
+    const Grid& g = A.Grid();
+    const int n = A.Width();
+    const int bsize = Blocksize();
+    DistMatrix<F> AView(g);
+    for( int j=0; j<n; j+=bsize )
+    {
+        const int nb = std::min(bsize,n-j);
+        LockedView( AView, A, 0, j, A.Height(), nb );
+        AOOC.WritePanel( j, AView );
+    }
+}
+
+template<typename F>
+typename Base<F>::type
+RelativeDifference( const DistMatrix<F>& A, OutOfCoreMatrix<F>& AOOC )
+{
+    DistMatrix<F> B( A.Grid() );
+    AOOC.ReadPanel( 0, AOOC.Width(), B );
+    Axpy( F(-1), A, B );
+    return Norm( B, FROBENIUS_NORM ) / Norm( A, FROBENIUS_NORM );
+}
+
+template<typename F>
+void TestOutOfCore( int m, string basename, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+    const int commRank = g.Rank();
+    OutOfCoreMatrix<F> AOOC( m, m, basename, g );
+    DistMatrix<F> A(g);
+
+    for( int uploInt=0; uploInt<2; ++uploInt )
+    {
+        const UpperOrLower uplo = ( uploInt == 0 ? LOWER : UPPER );
+        HermitianUniformSpectrum( m, A, 1, 10 );
+        StoreOutOfCore( A, AOOC );
+        mpi::Barrier( g.Comm() );
+        double startTime = mpi::Time();
+        Cholesky( uplo, AOOC );
+        mpi::Barrier( g.Comm() );
+        const double oocTime = mpi::Time() - startTime;
+        startTime = mpi::Time();
+        Cholesky( uplo, A );
+        mpi::Barrier( g.Comm() );
+        const double inCoreTime = mpi::Time() - startTime;
+        const R diff = RelativeDifference( A, AOOC );
+        if( commRank == 0 )
+        {
+            cout << "  Cholesky" << UpperOrLowerToChar(uplo) << ":\n"
+                 << "    out-of-core time = " << oocTime << " seconds\n"
+                 << "    in-core time     = " << inCoreTime << " seconds\n"
+                 << "    ||A_ooc - A||_F / ||A||_F = " << diff << endl;
+        }
+    }
+
+    Uniform( m, m, A );
+    StoreOutOfCore( A, AOOC );
+    DistMatrix<int,VC,STAR> p(g), pOOC(g);
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    LU( AOOC, pOOC );
+    mpi::Barrier( g.Comm() );
+    const double oocTime = mpi::Time() - startTime;
+    startTime = mpi::Time();
+    LU( A, p );
+    mpi::Barrier( g.Comm() );
+    const double inCoreTime = mpi::Time() - startTime;
+    const R diff = RelativeDifference( A, AOOC );
+    int localPivotDiff = 0, pivotDiff;
+    for( int iLocal=0; iLocal<p.LocalHeight(); ++iLocal )
+        localPivotDiff = std::max
+        ( localPivotDiff, Abs(p.GetLocal(iLocal,0)-pOOC.GetLocal(iLocal,0)) );
+    mpi::AllReduce( &localPivotDiff, &pivotDiff, 1, mpi::MAX, g.Comm() );
+    if( commRank == 0 )
+    {
+        cout << "  LU:\n"
+             << "    out-of-core time = " << oocTime << " seconds\n"
+             << "    in-core time     = " << inCoreTime << " seconds\n"
+             << "    ||A_ooc - A||_F / ||A||_F = " << diff << "\n"
+             << "    max |p_ooc - p|           = " << pivotDiff << endl;
+    }
+
+    mpi::Barrier( g.Comm() );
+    if( g.InGrid() )
+        std::remove( AOOC.Filename().c_str() );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","process grid height",0);
+        const int m = Input("--height","height of matrix",300);
+        const int nb = Input("--nb","algorithmic blocksize",32);
+        const string basename =
+            Input("--basename","base name of the tile files",
+                  string("OutOfCore"));
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+        SetBlocksize( nb );
+#ifndef RELEASE
+        if( commRank == 0 )
+        {
+            cout << "==========================================\n"
+                 << " In debug mode! Performance will be poor! \n"
+                 << "==========================================" << endl;
+        }
+#endif
+        if( commRank == 0 )
+            cout << "Will test out-of-core Cholesky and LU" << endl;
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestOutOfCore<double>( m, basename, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestOutOfCore<Complex<double> >( m, basename, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,230 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "elemental.hpp"
+using namespace std;
+using namespace elem;
+
+template<typename R>
+void
+ApplyPlain
+( LeftOrRight side, ForwardOrBackward order, const PackedReflectors<R>& Q,
+  DistMatrix<R>& A )
+{
+    ApplyPackedReflectors
+    ( side, Q.Uplo(), Q.Dir(), order, Q.Offset(), Q.H(), A );
+}
+
+template<typename R>
+void
+ApplyPlain
+( LeftOrRight side, ForwardOrBackward order,
+  const PackedReflectors<Complex<R> >& Q, DistMatrix<Complex<R> >& A )
+{
+    ApplyPackedReflectors
+    ( side, Q.Uplo(), Q.Dir(), order, CONJUGATED, Q.Offset(), Q.H(), Q.t(),
+      A );
+}
+
+template<typename R>
+void
+ApplyCached
+( LeftOrRight side, ForwardOrBackward order, const PackedReflectors<R>& Q,
+  DistMatrix<R>& A )
+{ ApplyPackedReflectors( side, order, Q, A ); }
+
+template<typename R>
+void
+ApplyCached
+( LeftOrRight side, ForwardOrBackward order,
+  const PackedReflectors<Complex<R> >& Q, DistMatrix<Complex<R> >& A )
+{ ApplyPackedReflectors( side, order, CONJUGATED, Q, A ); }
+
+// Ensure that the cached application agrees with the standard one, both
+// when filling the cache and when reusing it
+template<typename F>
+void
+CheckVariant
+( LeftOrRight side, ForwardOrBackward order, const PackedReflectors<F>& Q,
+  const DistMatrix<F>& B, string label )
+{
+    typedef typename Base<F>::type R;
+    const Grid& g = B.Grid();
+    const R eps = lapack::MachineEpsilon<R>();
+    const bool print = ( g.Rank() == 0 );
+    DistMatrix<F> APlain(g), ACached(g);
+    for( int pass=0; pass<2; ++pass )
+    {
+        APlain = B;
+        ACached = B;
+        ApplyPlain( side, order, Q, APlain );
+        ApplyCached( side, order, Q, ACached );
+        Axpy( F(-1), APlain, ACached );
+        const R error = Norm( ACached, FROBENIUS_NORM ) /
+                        Norm( APlain, FROBENIUS_NORM );
+        if( error > 10*eps )
+        {
+            ostringstream msg;
+            msg << label << " had relative error " << error << " on pass "
+                << pass;
+            throw logic_error( msg.str() );
+        }
+    }
+    if( print )
+        cout << "    " << label << ": " << Q.NumCachedPanels()
+             << " cached panels" << endl;
+}
+
+template<typename F>
+void
+TestVariants( int m, const Grid& g )
+{
+    const bool print = ( g.Rank() == 0 );
+    const UpperOrLower uplos[2] = { LOWER, UPPER };
+    const VerticalOrHorizontal dirs[2] = { VERTICAL, HORIZONTAL };
+    const LeftOrRight sides[2] = { LEFT, RIGHT };
+    const ForwardOrBackward orders[2] = { FORWARD, BACKWARD };
+    const char* uploNames[2] = { "L", "U" };
+    const char* dirNames[2] = { "V", "H" };
+    const char* sideNames[2] = { "L", "R" };
+    const char* orderNames[2] = { "F", "B" };
+
+    DistMatrix<F> H(g), B(g);
+    DistMatrix<F,MD,STAR> t(g);
+    Uniform( m, m, H );
+    t.AlignWithDiagonal( H );
+    Uniform( m, 1, t );
+    Uniform( m, m, B );
+    if( print )
+        cout << "  Comparing all 16 variants:" << endl;
+    for( int s=0; s<2; ++s )
+    {
+        for( int u=0; u<2; ++u )
+        {
+            for( int d=0; d<2; ++d )
+            {
+                PackedReflectors<F> Q(g);
+                Q.Attach( uplos[u], dirs[d], 0, H, t );
+                for( int o=0; o<2; ++o )
+                {
+                    const string label = string(sideNames[s]) + uploNames[u] +
+                                         dirNames[d] + orderNames[o];
+                    CheckVariant( sides[s], orders[o], Q, B, label );
+                }
+            }
+        }
+    }
+}
+
+template<typename F>
+void
+TestFactorizations( int m, int n, int numApps, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+    const bool print = ( g.Rank() == 0 );
+    DistMatrix<F> A(g), B(g), X(g);
+    Uniform( m, n, A );
+    Uniform( m, n, B );
+
+    PackedReflectors<F> Q(g);
+    QR( A, Q );
+    if( print )
+        cout << "  Applying Q from QR " << numApps << " times...";
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    for( int k=0; k<numApps; ++k )
+    {
+        X = B;
+        ApplyPlain( LEFT, BACKWARD, Q, X );
+    }
+    mpi::Barrier( g.Comm() );
+    const double plainTime = mpi::Time() - startTime;
+    startTime = mpi::Time();
+    for( int k=0; k<numApps; ++k )
+    {
+        X = B;
+        ApplyCached( LEFT, BACKWARD, Q, X );
+    }
+    mpi::Barrier( g.Comm() );
+    const double cachedTime = mpi::Time() - startTime;
+    if( print )
+        cout << "DONE\n"
+             << "    uncached: " << plainTime << " secs, cached: "
+             << cachedTime << " secs" << endl;
+
+    // The remaining factorizations should attach the correct offsets
+    HermitianUniformSpectrum( m, A, 1, 10 );
+    B = A;
+    HermitianTridiag( LOWER, A, Q );
+    CheckVariant( LEFT, BACKWARD, Q, B, "HermitianTridiag(LOWER)" );
+    A = B;
+    HermitianTridiag( UPPER, A, Q );
+    CheckVariant( LEFT, FORWARD, Q, B, "HermitianTridiag(UPPER)" );
+
+    PackedReflectors<F> P(g);
+    Uniform( m, n, A );
+    Bidiag( A, P, Q );
+    Uniform( m, m, B );
+    CheckVariant( LEFT, BACKWARD, Q, B, "Bidiag Q" );
+    Uniform( n, n, B );
+    CheckVariant( LEFT, BACKWARD, P, B, "Bidiag P" );
+
+    Uniform( n, m, A );
+    LQ( A, Q );
+    Uniform( n, m, B );
+    CheckVariant( RIGHT, BACKWARD, Q, B, "LQ" );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int m = Input("--height","height of matrix",300);
+        const int n = Input("--width","width of matrix",200);
+        const int numApps = Input("--numApps","number of applications",10);
+        const int nb = Input("--nb","algorithmic blocksize",32);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+        SetBlocksize( nb );
+
+        if( commRank == 0 )
+            cout << "Testing with doubles:" << endl;
+        TestVariants<double>( m, g );
+        TestFactorizations<double>( m, n, numApps, g );
+
+        if( commRank == 0 )
+            cout << "Testing with double-precision complex:" << endl;
+        TestVariants<Complex<double> >( m, g );
+        TestFactorizations<Complex<double> >( m, n, numApps, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
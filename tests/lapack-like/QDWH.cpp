@@ -0,0 +1,157 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "elemental.hpp"
+using namespace std;
+using namespace elem;
+
+// Check that Q has orthonormal columns and that Q^H A is Hermitian, i.e., 
+// that A = Q P with P = Q^H A being the Hermitian polar factor
+template<typename F>
+void
+CheckPolar
+( const DistMatrix<F>& A, const DistMatrix<F>& Q, const DistMatrix<F>& QTrue,
+  string label, bool print )
+{
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    const int n = A.Width();
+    const R eps = lapack::MachineEpsilon<R>();
+    const R frobA = Norm( A, FROBENIUS_NORM );
+
+    DistMatrix<F> Z( g );
+    Identity( n, n, Z );
+    Herk( LOWER, ADJOINT, F(-1), Q, F(1), Z );
+    const R orthogError = HermitianNorm( LOWER, Z, FROBENIUS_NORM );
+
+    DistMatrix<F> P( g ), PAdj( g );
+    Zeros( n, n, P );
+    Gemm( ADJOINT, NORMAL, F(1), Q, A, F(0), P );
+    Adjoint( P, PAdj );
+    Axpy( F(-1), P, PAdj );
+    const R hermError = Norm( PAdj, FROBENIUS_NORM ) / frobA;
+
+    DistMatrix<F> QDiff( Q );
+    Axpy( F(-1), QTrue, QDiff );
+    const R diff = Norm( QDiff, FROBENIUS_NORM );
+    if( print )
+        cout << "    " << label << ":\n"
+             << "      ||I - Q^H Q||_F = " << orthogError << "\n"
+             << "      ||P - P^H||_F / ||A||_F = " << hermError << "\n"
+             << "      ||Q - QSVD||_F = " << diff << endl;
+    if( orthogError > 100*n*eps )
+        throw logic_error("Polar factor was not orthonormal");
+    if( hermError > 100*n*eps )
+        throw logic_error("Hermitian polar factor was not Hermitian");
+    if( diff > Sqrt(eps) )
+        throw logic_error("Polar factor did not match the SVD-based one");
+}
+
+template<typename F>
+void
+TestQDWH( int m, int n, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+    const bool print = ( g.Rank() == 0 );
+    if( print )
+        cout << "  " << m << " x " << n << ":" << endl;
+    DistMatrix<F> A( g ), QSVD( g ), Q( g ), P( g );
+    Uniform( m, n, A );
+
+    QSVD = A;
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    Polar( QSVD, P );
+    mpi::Barrier( g.Comm() );
+    const double svdTime = mpi::Time() - startTime;
+    if( print )
+        cout << "    SVD-based polar decomposition: " << svdTime << " secs"
+             << endl;
+
+    // The bounds are estimated from an initial QR factorization
+    Q = A;
+    mpi::Barrier( g.Comm() );
+    const QDWHInfo info = QDWH( Q );
+    if( print )
+        cout << "    QDWH: " << info.numIts << " iterations ("
+             << info.numQRIts << " QR, " << info.numCholIts << " Cholesky)\n"
+             << "      estimate: " << info.estimateTime << " secs\n"
+             << "      QR iterations: " << info.qrTime << " secs\n"
+             << "      Cholesky iterations: " << info.cholTime << " secs\n"
+             << "      total: " << info.totalTime << " secs" << endl;
+    if( info.numIts != info.numQRIts+info.numCholIts )
+        throw logic_error("Inconsistent iteration counts");
+    CheckPolar( A, Q, QSVD, "estimated bounds", print );
+
+    // Explicitly-provided bounds
+    Q = A;
+    const R lowerBound = 1e-7;
+    const R upperBound = TwoNormUpperBound( A );
+    const int numIts = QDWH( Q, lowerBound, upperBound );
+    if( print )
+        cout << "    QDWH with lowerBound=" << lowerBound << ": " << numIts 
+             << " iterations" << endl;
+    CheckPolar( A, Q, QSVD, "explicit bounds", print );
+
+    // The sequential implementation should agree
+    DistMatrix<F,STAR,STAR> Q_STAR_STAR( A );
+    const QDWHInfo seqInfo = QDWH( Q_STAR_STAR.LocalMatrix() );
+    if( print )
+        cout << "    Sequential QDWH: " << seqInfo.numIts << " iterations"
+             << endl;
+    Q = Q_STAR_STAR;
+    CheckPolar( A, Q, QSVD, "sequential", print );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int m = Input("--height","height of tall matrix",300);
+        const int n = Input("--width","width of matrices",150);
+        const int nb = Input("--nb","algorithmic blocksize",32);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+        SetBlocksize( nb );
+
+        if( commRank == 0 )
+            cout << "Testing with doubles:" << endl;
+        TestQDWH<double>( m, n, g );
+        TestQDWH<double>( n, n, g );
+
+        if( commRank == 0 )
+            cout << "Testing with double-precision complex:" << endl;
+        TestQDWH<Complex<double> >( m, n, g );
+        TestQDWH<Complex<double> >( n, n, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
@@ -263,6 +263,8 @@ main( int argc, char* argv[] )
         const int m = Input("--height","height of matrix",100);
         const int n = Input("--width","width of matrix",100);
         const int nb = Input("--nb","algorithmic blocksize",96);
+        const bool tsqrPanel = Input
+            ("--tsqrPanel","factor panels with TSQR?",false);
         const bool testCorrectness = Input
             ("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
@@ -274,6 +276,8 @@ main( int argc, char* argv[] )
         const int c = commSize / r;
         const Grid g( comm, r, c );
         SetBlocksize( nb );
+        if( tsqrPanel )
+            SetQRPanelApproach( QR_PANEL_TSQR );
 #ifndef RELEASE
         if( commRank == 0 )
         {
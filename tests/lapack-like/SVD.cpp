@@ -0,0 +1,153 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "elemental.hpp"
+using namespace std;
+using namespace elem;
+
+template<typename F>
+void
+CheckOrthonormality( const DistMatrix<F>& Q, string label, bool print )
+{
+    typedef typename Base<F>::type R;
+    const int k = Q.Width();
+    DistMatrix<F> Z( Q.Grid() );
+    Identity( k, k, Z );
+    Herk( LOWER, ADJOINT, F(-1), Q, F(1), Z );
+    const R error = HermitianNorm( LOWER, Z, MAX_NORM );
+    if( print )
+        cout << "    ||I - " << label << "^H " << label << "||_max = " 
+             << error << endl;
+    const R eps = lapack::MachineEpsilon<R>();
+    if( error > 100*k*eps )
+        throw logic_error(label+" was not orthonormal");
+}
+
+template<typename F>
+void
+TestSVD( const DistMatrix<F>& AOrig, string label )
+{
+    typedef typename Base<F>::type R;
+    const Grid& g = AOrig.Grid();
+    const bool print = ( g.Rank() == 0 );
+    const int m = AOrig.Height();
+    const int n = AOrig.Width();
+    const int k = std::min( m, n );
+    if( print )
+        cout << "  " << label << ":" << endl;
+
+    DistMatrix<F> U( AOrig ), V( g );
+    DistMatrix<R,VR,STAR> s( g );
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    SVD( U, s, V );
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+    if( print )
+        cout << "    SVD time: " << runTime << " secs" << endl;
+
+    // Ensure that the singular values are sorted and agree with those 
+    // computed without the singular vectors
+    DistMatrix<R,STAR,STAR> s_STAR_STAR( s );
+    for( int j=1; j<k; ++j )
+        if( s_STAR_STAR.GetLocal(j,0) > s_STAR_STAR.GetLocal(j-1,0) )
+            throw logic_error("Singular values were not sorted");
+    DistMatrix<F> B( AOrig );
+    DistMatrix<R,VR,STAR> sOnly( g );
+    SingularValues( B, sOnly );
+    Axpy( R(-1), s, sOnly );
+    const R twoNorm = s_STAR_STAR.GetLocal(0,0);
+    const R sError = Norm( sOnly, MAX_NORM ) / twoNorm;
+    if( print )
+        cout << "    max |s - sOnly| / ||A||_2 = " << sError << endl;
+    const R eps = lapack::MachineEpsilon<R>();
+    if( sError > 100*k*eps )
+        throw logic_error("Singular values did not match");
+
+    // Check the residual, || A - U diag(s) V^H ||_F / || A ||_F
+    DistMatrix<F> UTrunc( g ), VTrunc( g );
+    LockedView( UTrunc, U, 0, 0, m, k );
+    LockedView( VTrunc, V, 0, 0, n, k );
+    DistMatrix<F> US( UTrunc );
+    DiagonalScale( RIGHT, NORMAL, s, US );
+    B = AOrig;
+    Gemm( NORMAL, ADJOINT, F(-1), US, VTrunc, F(1), B );
+    const R residual = Norm( B, FROBENIUS_NORM ) / Norm( AOrig );
+    if( print )
+        cout << "    ||A - U diag(s) V^H||_F / ||A||_F = " << residual << endl;
+    if( residual > 100*k*eps )
+        throw logic_error("SVD residual was too large");
+
+    CheckOrthonormality( UTrunc, "U", print );
+    CheckOrthonormality( VTrunc, "V", print );
+}
+
+template<typename F>
+void
+TestSVDs( int m, int n, const Grid& g )
+{
+    DistMatrix<F> A( g );
+    Uniform( m, n, A );
+    TestSVD( A, "tall matrix" );
+
+    DistMatrix<F> AAdj( g );
+    Adjoint( A, AAdj );
+    TestSVD( AAdj, "wide matrix" );
+
+    // A matrix with a zero column has a zero singular value
+    DistMatrix<F> AL( g ), AR( g );
+    PartitionRight( A, AL, AR, n/2 );
+    MakeZeros( AR );
+    TestSVD( A, "rank-deficient matrix" );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int m = Input("--height","height of matrix",300);
+        const int n = Input("--width","width of matrix",200);
+        const int nb = Input("--nb","algorithmic blocksize",32);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+        SetBlocksize( nb );
+
+        if( commRank == 0 )
+            cout << "Testing with doubles:" << endl;
+        TestSVDs<double>( m, n, g );
+
+        if( commRank == 0 )
+            cout << "Testing with double-precision complex:" << endl;
+        TestSVDs<Complex<double> >( m, n, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,193 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <ctime>
+#include "elemental.hpp"
+using namespace std;
+using namespace elem;
+
+template<typename F>
+void TestCorrectness
+( bool print,
+  const DistMatrix<F,VC,STAR>& Q,
+  const DistMatrix<F,STAR,STAR>& R,
+  const DistMatrix<F,VC,STAR>& AOrig )
+{
+    typedef typename Base<F>::type Real;
+    const Grid& g = Q.Grid();
+    const int m = Q.Height();
+    const int n = Q.Width();
+
+    if( g.Rank() == 0 )
+        cout << "  Testing orthogonality of Q..." << endl;
+
+    // Form X := I - Q^H Q
+    DistMatrix<F> QFull(g);
+    QFull = Q;
+    DistMatrix<F> X(g);
+    Identity( n, n, X );
+    Gemm( ADJOINT, NORMAL, F(-1), QFull, QFull, F(1), X );
+
+    Real oneNormOfError = Norm( X, ONE_NORM );
+    Real infNormOfError = Norm( X, INFINITY_NORM );
+    Real frobNormOfError = Norm( X, FROBENIUS_NORM );
+    if( g.Rank() == 0 )
+    {
+        cout << "    ||Q^H Q - I||_1  = " << oneNormOfError << "\n"
+             << "    ||Q^H Q - I||_oo = " << infNormOfError << "\n"
+             << "    ||Q^H Q - I||_F  = " << frobNormOfError << endl;
+    }
+
+    if( g.Rank() == 0 )
+        cout << "  Testing if A = QR..." << endl;
+
+    // Form Q R - A
+    DistMatrix<F> RFull(g), E(g);
+    RFull = R;
+    E = AOrig;
+    Gemm( NORMAL, NORMAL, F(1), QFull, RFull, F(-1), E );
+
+    DistMatrix<F> AFull(g);
+    AFull = AOrig;
+    const Real oneNormOfA = Norm( AFull, ONE_NORM );
+    const Real infNormOfA = Norm( AFull, INFINITY_NORM );
+    const Real frobNormOfA = Norm( AFull, FROBENIUS_NORM );
+    oneNormOfError = Norm( E, ONE_NORM );
+    infNormOfError = Norm( E, INFINITY_NORM );
+    frobNormOfError = Norm( E, FROBENIUS_NORM );
+    if( g.Rank() == 0 )
+    {
+        cout << "    ||A||_1       = " << oneNormOfA << "\n"
+             << "    ||A||_oo      = " << infNormOfA << "\n"
+             << "    ||A||_F       = " << frobNormOfA << "\n"
+             << "    ||A - QR||_1  = " << oneNormOfError << "\n"
+             << "    ||A - QR||_oo = " << infNormOfError << "\n"
+             << "    ||A - QR||_F  = " << frobNormOfError << endl;
+    }
+}
+
+template<typename F>
+void TestTSQR
+( bool testCorrectness, bool print,
+  int m, int n, const Grid& g )
+{
+    DistMatrix<F,VC,STAR> A(g), AOrig(g);
+    DistMatrix<F,STAR,STAR> R(g);
+
+    Uniform( m, n, A );
+    if( testCorrectness )
+    {
+        if( g.Rank() == 0 )
+        {
+            cout << "  Making copy of original matrix...";
+            cout.flush();
+        }
+        AOrig = A;
+        if( g.Rank() == 0 )
+            cout << "DONE" << endl;
+    }
+    if( print )
+        A.Print("A");
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting TSQR factorization...";
+        cout.flush();
+    }
+    TSQRTree<F> tree;
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    TSQR( A, R, tree );
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+    {
+        cout << "DONE. " << endl
+             << "  Time = " << runTime << " seconds." << endl;
+    }
+    if( print )
+        R.Print("R");
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  Expanding Q...";
+        cout.flush();
+    }
+    ExpandTSQR( A, tree );
+    if( g.Rank() == 0 )
+        cout << "DONE" << endl;
+    if( print )
+        A.Print("Q");
+    if( testCorrectness )
+        TestCorrectness( print, A, R, AOrig );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int m = Input("--height","height of matrix",1000);
+        const int n = Input("--width","width of matrix",20);
+        const bool testCorrectness = Input
+            ("--correctness","test correctness?",true);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+#ifndef RELEASE
+        if( commRank == 0 )
+        {
+            cout << "==========================================\n"
+                 << " In debug mode! Performance will be poor! \n"
+                 << "==========================================" << endl;
+        }
+#endif
+        if( commRank == 0 )
+            cout << "Will test TSQR" << endl;
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestTSQR<double>( testCorrectness, print, m, n, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestTSQR<Complex<double> >( testCorrectness, print, m, n, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,199 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "elemental.hpp"
+using namespace std;
+using namespace elem;
+
+template<typename F>
+void
+CheckOrthonormality( const DistMatrix<F>& Q, string label, bool print )
+{
+    typedef typename Base<F>::type R;
+    const int k = Q.Width();
+    DistMatrix<F> Z( Q.Grid() );
+    Identity( k, k, Z );
+    Herk( LOWER, ADJOINT, F(-1), Q, F(1), Z );
+    const R error = HermitianNorm( LOWER, Z, MAX_NORM );
+    if( print )
+        cout << "      ||I - " << label << "^H " << label << "||_max = "
+             << error << endl;
+    const R eps = lapack::MachineEpsilon<R>();
+    if( error > 100*k*eps )
+        throw logic_error(label+" was not orthonormal");
+}
+
+// Return max( ||A V - U S||_F, ||A^H U - V S||_F ) / ||A||_2
+template<typename F>
+typename Base<F>::type
+TripletResidual
+( const DistMatrix<F>& A, const DistMatrix<typename Base<F>::type,VR,STAR>& s,
+  const DistMatrix<F>& U, const DistMatrix<F>& V,
+  typename Base<F>::type twoNorm )
+{
+    typedef typename Base<F>::type R;
+    DistMatrix<F> US( U ), VS( V );
+    DiagonalScale( RIGHT, NORMAL, s, US );
+    DiagonalScale( RIGHT, NORMAL, s, VS );
+    Gemm( NORMAL, NORMAL, F(1), A, V, F(-1), US );
+    Gemm( ADJOINT, NORMAL, F(1), A, U, F(-1), VS );
+    const R leftResidual = Norm( US );
+    const R rightResidual = Norm( VS );
+    return std::max( leftResidual, rightResidual ) / twoNorm;
+}
+
+template<typename F>
+void
+TestTruncatedSVD
+( const DistMatrix<F>& A, const DistMatrix<typename Base<F>::type,VR,STAR>& s,
+  int k, int oversample, int powerIters, typename Base<F>::type sTol,
+  typename Base<F>::type residualTol, string label )
+{
+    typedef typename Base<F>::type R;
+    const R eps = lapack::MachineEpsilon<R>();
+    const Grid& g = A.Grid();
+    const bool print = ( g.Rank() == 0 );
+    if( print )
+        cout << "  " << label << ":" << endl;
+    DistMatrix<R,STAR,STAR> s_STAR_STAR( s );
+    const R twoNorm = s_STAR_STAR.GetLocal(0,0);
+    DistMatrix<R,VR,STAR> sTrue( g );
+    LockedView( sTrue, s, 0, 0, k, 1 );
+
+    DistMatrix<F> U( g ), V( g );
+    DistMatrix<R,VR,STAR> sApprox( g );
+    for( int variant=0; variant<2; ++variant )
+    {
+        mpi::Barrier( g.Comm() );
+        const double startTime = mpi::Time();
+        int numSteps = 0;
+        if( variant == 0 )
+            RandomizedSVD( A, sApprox, U, V, k, oversample, powerIters );
+        else
+            numSteps = PartialSVD( A, sApprox, U, V, k );
+        mpi::Barrier( g.Comm() );
+        const double runTime = mpi::Time() - startTime;
+        if( print )
+        {
+            if( variant == 0 )
+                cout << "    RandomizedSVD time: " << runTime << " secs"
+                     << endl;
+            else
+                cout << "    PartialSVD time: " << runTime << " secs ("
+                     << numSteps << " Lanczos steps)" << endl;
+        }
+
+        DistMatrix<R,VR,STAR> sError( sApprox );
+        Axpy( R(-1), sTrue, sError );
+        const R sRelError = Norm( sError, MAX_NORM ) / twoNorm;
+        const R residual = TripletResidual( A, sApprox, U, V, twoNorm );
+        if( print )
+            cout << "      max |s - sTrue| / ||A||_2 = " << sRelError << "\n"
+                 << "      triplet residual / ||A||_2 = " << residual
+                 << endl;
+        // Lanczos is run to convergence (with the default tolerance of 
+        // sqrt(eps)), whereas the accuracy of the sketch depends upon the 
+        // decay of the spectrum
+        if( sRelError > ( variant==0 ? sTol : Sqrt(eps) ) )
+            throw logic_error("Singular values were not accurate");
+        if( residual > ( variant==0 ? residualTol : 10*Sqrt(eps) ) )
+            throw logic_error("Singular triplets were not accurate");
+        CheckOrthonormality( U, "U", print );
+        CheckOrthonormality( V, "V", print );
+    }
+}
+
+template<typename F>
+void
+TestTruncatedSVDs
+( int m, int n, int k, int oversample, int powerIters, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+    const R eps = lapack::MachineEpsilon<R>();
+    const int r = std::min( m, n );
+
+    // A = X diag(s) Y^H with s_i = 2^{-i}, so that the sketch captures the
+    // dominant subspace to nearly working precision
+    DistMatrix<F> X( g ), Y( g ), A( g );
+    Gaussian( m, r, X );
+    Gaussian( n, r, Y );
+    ExplicitQR( X );
+    ExplicitQR( Y );
+    DistMatrix<R,VR,STAR> s( g );
+    s.ResizeTo( r, 1 );
+    for( int iLocal=0; iLocal<s.LocalHeight(); ++iLocal )
+    {
+        const int i = s.ColShift() + iLocal*s.ColStride();
+        s.SetLocal( iLocal, 0, Pow(R(2),R(-i)) );
+    }
+    DiagonalScale( RIGHT, NORMAL, s, X );
+    Zeros( m, n, A );
+    Gemm( NORMAL, ADJOINT, F(1), X, Y, F(0), A );
+    TestTruncatedSVD
+    ( A, s, k, oversample, powerIters, 100*k*eps,
+      Sqrt(eps), "rapidly decaying spectrum" );
+
+    // The singular values of a uniform random matrix decay slowly, so the
+    // sketch is only accurate to about sigma_{k+oversample} / sigma_k
+    Uniform( m, n, A );
+    DistMatrix<F> B( A );
+    SingularValues( B, s );
+    TestTruncatedSVD
+    ( A, s, k, oversample, powerIters, R(0.1), R(1),
+      "slowly decaying spectrum" );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int m = Input("--height","height of matrix",400);
+        const int n = Input("--width","width of matrix",300);
+        const int k = Input("--k","number of singular triplets",10);
+        const int oversample = Input("--oversample","oversampling",10);
+        const int powerIters = Input("--powerIters","power iterations",2);
+        const int nb = Input("--nb","algorithmic blocksize",32);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+        SetBlocksize( nb );
+
+        if( commRank == 0 )
+            cout << "Testing with doubles:" << endl;
+        TestTruncatedSVDs<double>( m, n, k, oversample, powerIters, g );
+
+        if( commRank == 0 )
+            cout << "Testing with double-precision complex:" << endl;
+        TestTruncatedSVDs<Complex<double> >
+        ( m, n, k, oversample, powerIters, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}